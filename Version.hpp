@@ -25,6 +25,7 @@
 #define OT_CRYPTO_WITH_BIP32 @BIP32_EXPORT@
 #define OT_CRYPTO_WITH_BIP39 @BIP39_EXPORT@
 #define OT_DHT @DHT_EXPORT@
+#define OT_LOG_MAX_LEVEL @OT_LOG_MAX_LEVEL@
 #define OT_SCRIPT_CHAI @SCRIPT_CHAI_EXPORT@
 #define OT_STORAGE_FS @FS_EXPORT@
 #define OT_STORAGE_SQLITE @SQLITE_EXPORT@
@@ -0,0 +1,77 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Helpers.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace opentxs;
+
+namespace
+{
+void Armor_SetString(benchmark::State& state)
+{
+    const String input(benchmarks::RandomText(state.range(0)));
+
+    for (auto _ : state) {
+        OTASCIIArmor armor;
+        benchmark::DoNotOptimize(armor.SetString(input));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.GetLength());
+}
+
+void Armor_GetString(benchmark::State& state)
+{
+    const String input(benchmarks::RandomText(state.range(0)));
+    OTASCIIArmor armor;
+    armor.SetString(input);
+
+    for (auto _ : state) {
+        String output;
+        benchmark::DoNotOptimize(armor.GetString(output));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.GetLength());
+}
+}  // namespace
+
+BENCHMARK(Armor_SetString)->RangeMultiplier(16)->Range(1 << 10, 4 << 20);
+BENCHMARK(Armor_GetString)->RangeMultiplier(16)->Range(1 << 10, 4 << 20);
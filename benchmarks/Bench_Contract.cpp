@@ -0,0 +1,74 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Helpers.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace opentxs;
+
+namespace
+{
+void Contract_LoadContractFromString(benchmark::State& state)
+{
+    const auto nym = benchmarks::BenchmarkNym();
+    Message message;
+    message.m_strCommand = "pingNotary";
+    message.m_strNymID = String(nym->ID());
+    message.m_ascPayload.SetString(
+        String(benchmarks::RandomText(state.range(0))));
+    message.SignContract(*nym);
+    message.SaveContract();
+    String serialized;
+    message.SaveContractRaw(serialized);
+
+    for (auto _ : state) {
+        Message loaded;
+        benchmark::DoNotOptimize(loaded.LoadContractFromString(serialized));
+    }
+
+    state.SetBytesProcessed(state.iterations() * serialized.GetLength());
+}
+}  // namespace
+
+// From a bare signed message up to one carrying a large ledger
+BENCHMARK(Contract_LoadContractFromString)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 20);
@@ -0,0 +1,105 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/api/crypto/Encode.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+std::string random_bytes(const std::size_t size)
+{
+    std::mt19937 generator{size};
+    std::string output(size, 0x0);
+
+    for (auto& byte : output) { byte = static_cast<char>(generator()); }
+
+    return output;
+}
+
+void Encode_DataEncode(benchmark::State& state)
+{
+    const auto& encode = OT::App().Crypto().Encode();
+    const auto input = random_bytes(state.range(0));
+
+    for (auto _ : state) { benchmark::DoNotOptimize(encode.DataEncode(input)); }
+
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void Encode_DataDecode(benchmark::State& state)
+{
+    const auto& encode = OT::App().Crypto().Encode();
+    const auto input = encode.DataEncode(random_bytes(state.range(0)));
+
+    for (auto _ : state) { benchmark::DoNotOptimize(encode.DataDecode(input)); }
+
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void Encode_IdentifierEncode(benchmark::State& state)
+{
+    const auto& encode = OT::App().Crypto().Encode();
+    const auto input = Identifier::Random();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(encode.IdentifierEncode(input));
+    }
+}
+
+void Encode_IdentifierDecode(benchmark::State& state)
+{
+    const auto& encode = OT::App().Crypto().Encode();
+    const auto input = encode.IdentifierEncode(Identifier::Random());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(encode.IdentifierDecode(input));
+    }
+}
+}  // namespace
+
+BENCHMARK(Encode_DataEncode)->RangeMultiplier(16)->Range(1 << 10, 4 << 20);
+BENCHMARK(Encode_DataDecode)->RangeMultiplier(16)->Range(1 << 10, 4 << 20);
+BENCHMARK(Encode_IdentifierEncode);
+BENCHMARK(Encode_IdentifierDecode);
@@ -0,0 +1,101 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+OTData random_data(const std::size_t size)
+{
+    std::mt19937 generator{size};
+    std::vector<unsigned char> output(size, 0x0);
+
+    for (auto& byte : output) {
+        byte = static_cast<unsigned char>(generator());
+    }
+
+    return Data::Factory(output);
+}
+
+void digest(benchmark::State& state, const proto::HashType type)
+{
+    const auto& hash = OT::App().Crypto().Hash();
+    const auto input = random_data(state.range(0));
+    auto output = Data::Factory();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash.Digest(type, input, output));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input->GetSize());
+}
+
+void Hash_SHA256(benchmark::State& state)
+{
+    digest(state, proto::HASHTYPE_SHA256);
+}
+
+void Hash_SHA512(benchmark::State& state)
+{
+    digest(state, proto::HASHTYPE_SHA512);
+}
+
+void Hash_BLAKE2B256(benchmark::State& state)
+{
+    digest(state, proto::HASHTYPE_BLAKE2B256);
+}
+
+void Hash_RIPEMD160(benchmark::State& state)
+{
+    digest(state, proto::HASHTYPE_RIMEMD160);
+}
+}  // namespace
+
+// From a single identifier preimage up to a large serialized ledger
+BENCHMARK(Hash_SHA256)->RangeMultiplier(16)->Range(32, 1 << 20);
+BENCHMARK(Hash_SHA512)->RangeMultiplier(16)->Range(32, 1 << 20);
+BENCHMARK(Hash_BLAKE2B256)->RangeMultiplier(16)->Range(32, 1 << 20);
+BENCHMARK(Hash_RIPEMD160)->RangeMultiplier(16)->Range(32, 1 << 20);
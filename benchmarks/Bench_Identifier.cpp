@@ -0,0 +1,129 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+std::vector<OTIdentifier> random_ids(const std::size_t count)
+{
+    std::vector<OTIdentifier> output{};
+    output.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        output.emplace_back(Identifier::Random());
+    }
+
+    return output;
+}
+
+void Identifier_Compare(benchmark::State& state)
+{
+    const auto ids = random_ids(2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ids[0].get() < ids[1].get());
+        benchmark::DoNotOptimize(ids[0].get() == ids[1].get());
+    }
+}
+
+void Identifier_MapFind(benchmark::State& state)
+{
+    const auto ids = random_ids(state.range(0));
+    std::map<OTIdentifier, std::size_t> map{};
+
+    for (std::size_t i = 0; i < ids.size(); ++i) { map.emplace(ids[i], i); }
+
+    for (auto _ : state) {
+        for (const auto& id : ids) {
+            benchmark::DoNotOptimize(map.find(id));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+
+void Identifier_UnorderedMapFind(benchmark::State& state)
+{
+    const auto ids = random_ids(state.range(0));
+    std::unordered_map<OTIdentifier, std::size_t> map{};
+
+    for (std::size_t i = 0; i < ids.size(); ++i) { map.emplace(ids[i], i); }
+
+    for (auto _ : state) {
+        for (const auto& id : ids) {
+            benchmark::DoNotOptimize(map.find(id));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ids.size());
+}
+
+void Identifier_Str(benchmark::State& state)
+{
+    const auto id = Identifier::Random();
+
+    for (auto _ : state) { benchmark::DoNotOptimize(id->str()); }
+}
+
+void Identifier_StrUncached(benchmark::State& state)
+{
+    const auto id = Identifier::Random();
+    auto copy = Identifier::Factory();
+
+    for (auto _ : state) {
+        // Assign discards the cached encoding
+        copy->Assign(id.get());
+        benchmark::DoNotOptimize(copy->str());
+    }
+}
+}  // namespace
+
+BENCHMARK(Identifier_Compare);
+BENCHMARK(Identifier_MapFind)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK(Identifier_UnorderedMapFind)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK(Identifier_Str);
+BENCHMARK(Identifier_StrUncached);
@@ -0,0 +1,88 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/crypto/Letter.hpp"
+
+#include "Helpers.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace opentxs;
+
+namespace
+{
+void Letter_Seal(benchmark::State& state)
+{
+    const auto nym = benchmarks::BenchmarkNym();
+    const String input(benchmarks::RandomText(state.range(0)));
+    mapOfAsymmetricKeys recipients{};
+    recipients.emplace(
+        "", const_cast<OTAsymmetricKey*>(&nym->GetPublicEncrKey()));
+
+    for (auto _ : state) {
+        auto output = Data::Factory();
+        benchmark::DoNotOptimize(Letter::Seal(recipients, input, output));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.GetLength());
+}
+
+void Letter_Open(benchmark::State& state)
+{
+    const auto nym = benchmarks::BenchmarkNym();
+    const String input(benchmarks::RandomText(state.range(0)));
+    mapOfAsymmetricKeys recipients{};
+    recipients.emplace(
+        "", const_cast<OTAsymmetricKey*>(&nym->GetPublicEncrKey()));
+    auto ciphertext = Data::Factory();
+    Letter::Seal(recipients, input, ciphertext);
+    const OTPasswordData reason("Letter_Open benchmark");
+
+    for (auto _ : state) {
+        String output;
+        benchmark::DoNotOptimize(
+            Letter::Open(ciphertext, *nym, reason, output));
+    }
+
+    state.SetBytesProcessed(state.iterations() * input.GetLength());
+}
+}  // namespace
+
+BENCHMARK(Letter_Seal)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(Letter_Open)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
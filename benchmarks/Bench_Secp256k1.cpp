@@ -0,0 +1,96 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Helpers.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace opentxs;
+
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+namespace
+{
+void Secp256k1_Sign(benchmark::State& state)
+{
+    const auto& secp256k1 = OT::App().Crypto().SECP256K1();
+    const auto nym = benchmarks::BenchmarkNym();
+    const auto& key = nym->GetPrivateSignKey();
+    const auto text = benchmarks::RandomText(state.range(0));
+    const auto plaintext = Data::Factory(text.data(), text.size());
+    const OTPasswordData reason("Secp256k1_Sign benchmark");
+
+    for (auto _ : state) {
+        auto signature = Data::Factory();
+        benchmark::DoNotOptimize(secp256k1.Sign(
+            plaintext, key, proto::HASHTYPE_SHA256, signature, &reason));
+    }
+
+    state.SetBytesProcessed(state.iterations() * plaintext->GetSize());
+}
+
+void Secp256k1_Verify(benchmark::State& state)
+{
+    const auto& secp256k1 = OT::App().Crypto().SECP256K1();
+    const auto nym = benchmarks::BenchmarkNym();
+    const auto text = benchmarks::RandomText(state.range(0));
+    const auto plaintext = Data::Factory(text.data(), text.size());
+    const OTPasswordData reason("Secp256k1_Verify benchmark");
+    auto signature = Data::Factory();
+    secp256k1.Sign(
+        plaintext,
+        nym->GetPrivateSignKey(),
+        proto::HASHTYPE_SHA256,
+        signature,
+        &reason);
+    const auto& key = nym->GetPublicSignKey();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(secp256k1.Verify(
+            plaintext, key, signature, proto::HASHTYPE_SHA256, &reason));
+    }
+
+    state.SetBytesProcessed(state.iterations() * plaintext->GetSize());
+}
+}  // namespace
+
+// Signatures cover everything from a short credential to a full contract
+BENCHMARK(Secp256k1_Sign)->RangeMultiplier(16)->Range(32, 1 << 16);
+BENCHMARK(Secp256k1_Verify)->RangeMultiplier(16)->Range(32, 1 << 16);
+#endif  // OT_CRYPTO_SUPPORTED_KEY_SECP256K1
@@ -0,0 +1,65 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Helpers.hpp"
+
+#include <random>
+
+namespace opentxs::benchmarks
+{
+ConstNym BenchmarkNym()
+{
+    static const auto id = OT::App().API().Exec().CreateNymHD(
+        proto::CITEMTYPE_INDIVIDUAL, "benchmark");
+
+    return OT::App().Wallet().Nym(Identifier::Factory(id));
+}
+
+std::string RandomText(const std::size_t size)
+{
+    static const std::string alphabet{
+        "<>=\"/ \nabcdefghijklmnopqrstuvwxyz0123456789"};
+    std::mt19937 generator{size};
+    std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+    std::string output(size, 0x0);
+
+    for (auto& character : output) { character = alphabet[pick(generator)]; }
+
+    return output;
+}
+}  // namespace opentxs::benchmarks
@@ -0,0 +1,56 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_BENCHMARKS_HELPERS_HPP
+#define OPENTXS_BENCHMARKS_HELPERS_HPP
+
+#include "opentxs/opentxs.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace opentxs::benchmarks
+{
+/** An HD nym shared by every benchmark that needs keys. It is created on
+ *  first use so that benchmarks which don't need it are not slowed down. */
+ConstNym BenchmarkNym();
+/** Deterministic printable text, which compresses roughly as well as the
+ *  serialized contracts OT passes through these primitives. */
+std::string RandomText(const std::size_t size);
+}  // namespace opentxs::benchmarks
+#endif  // OPENTXS_BENCHMARKS_HELPERS_HPP
@@ -0,0 +1,769 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "NotaryBenchmark.hpp"
+
+#include "opentxs/api/client/Wallet.hpp"
+#include "opentxs/api/Native.hpp"
+#include "opentxs/api/Server.hpp"
+#include "opentxs/consensus/ClientContext.hpp"
+#include "opentxs/consensus/ServerContext.hpp"
+#include "opentxs/core/contract/UnitDefinition.hpp"
+#include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/crypto/NymParameters.hpp"
+#include "opentxs/core/crypto/OTASCIIArmor.hpp"
+#include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OTTrade.hpp"
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/Account.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Item.hpp"
+#include "opentxs/core/Ledger.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/Nym.hpp"
+#include "opentxs/core/OTTransaction.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "api/Server.hpp"
+#include "server/Server.hpp"
+#include "server/Transactor.hpp"
+#include "server/UserCommandProcessor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <set>
+
+#define BENCHMARK_AMOUNT 100
+#define BENCHMARK_OFFER_PRICE 10
+#define BENCHMARK_OFFER_SIZE 1
+
+#define OT_METHOD "opentxs::server::NotaryBenchmark::"
+
+namespace opentxs::server
+{
+NotaryBenchmark::NotaryBenchmark(
+    const api::Native& ot,
+    const std::size_t iterations)
+    : wallet_(ot.Wallet())
+    , server_(get_server(ot))
+    , iterations_(iterations)
+    , server_id_(Identifier::Factory(ot.Server().ID()))
+    , server_nym_id_(Identifier::Factory(ot.Server().NymID()))
+    , results_()
+{
+}
+
+bool NotaryBenchmark::accepted(const Message& reply) const
+{
+    if (false == reply.m_bSuccess) { return false; }
+
+    Ledger ledger(
+        Identifier::Factory(reply.m_strNymID),
+        Identifier::Factory(reply.m_strAcctID),
+        server_id_);
+
+    if (false == ledger.LoadLedgerFromString(String(reply.m_ascPayload))) {
+
+        return false;
+    }
+
+    auto transaction = ledger.GetTransactionByIndex(0);
+
+    if (nullptr == transaction) { return false; }
+
+    return transaction->GetSuccess();
+}
+
+ConstNym NotaryBenchmark::create_nym(const std::string& name) const
+{
+#if OT_CRYPTO_SUPPORTED_KEY_HD
+    NymParameters parameters(proto::CREDTYPE_HD);
+#else
+    NymParameters parameters(proto::CREDTYPE_LEGACY);
+#endif
+
+    return wallet_.Nym(parameters, proto::CITEMTYPE_INDIVIDUAL, name);
+}
+
+Server& NotaryBenchmark::get_server(const api::Native& ot)
+{
+    auto api = dynamic_cast<const api::implementation::Server*>(&ot.Server());
+
+    OT_ASSERT(nullptr != api);
+
+    return api->GetServer();
+}
+
+bool NotaryBenchmark::issue_numbers(
+    const Identifier& nymID,
+    const std::size_t count)
+{
+    auto server = wallet_.mutable_ClientContext(server_nym_id_, nymID);
+    auto client = wallet_.mutable_ServerContext(nymID, server_id_);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        TransactionNumber number{0};
+
+        if (false ==
+            server_.GetTransactor().issueNextTransactionNumber(number)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Unable to issue transaction number." << std::endl;
+
+            return false;
+        }
+
+        server.It().IssueNumber(number);
+        client.It().AddTentativeNumber(number);
+        client.It().AcceptIssuedNumber(number);
+    }
+
+    return true;
+}
+
+bool NotaryBenchmark::market_offer(
+    const Identifier& nymID,
+    const Identifier& assetAccountID,
+    const Identifier& currencyAccountID)
+{
+    auto editor = wallet_.mutable_ServerContext(nymID, server_id_);
+    auto& context = editor.It();
+    const auto& nym = *context.Nym();
+    std::unique_ptr<Account> assetAccount(
+        Account::LoadExistingAccount(assetAccountID, server_id_));
+    std::unique_ptr<Account> currencyAccount(
+        Account::LoadExistingAccount(currencyAccountID, server_id_));
+
+    if ((false == bool(assetAccount)) || (false == bool(currencyAccount))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load accounts."
+              << std::endl;
+
+        return false;
+    }
+
+    const auto& assetUnitID = assetAccount->GetInstrumentDefinitionID();
+    const auto& currencyUnitID = currencyAccount->GetInstrumentDefinitionID();
+    auto opening =
+        context.NextTransactionNumber(MessageType::notarizeTransaction);
+    auto assetClosing =
+        context.NextTransactionNumber(MessageType::notarizeTransaction);
+    auto currencyClosing =
+        context.NextTransactionNumber(MessageType::notarizeTransaction);
+
+    if ((false == opening.Valid()) || (false == assetClosing.Valid()) ||
+        (false == currencyClosing.Valid())) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Not enough transaction numbers." << std::endl;
+
+        return false;
+    }
+
+    const auto validFrom = OTTimeGetCurrentTime();
+    const auto validTo = OTTimeAddTimeInterval(
+        validFrom, OTTimeGetSecondsFromTime(OT_TIME_DAY_IN_SECONDS));
+    OTOffer offer(server_id_, assetUnitID, currencyUnitID, 1);
+    OTTrade trade(
+        server_id_,
+        assetUnitID,
+        assetAccountID,
+        nymID,
+        currencyUnitID,
+        currencyAccountID);
+    bool built = offer.MakeOffer(
+        true,
+        BENCHMARK_OFFER_PRICE,
+        BENCHMARK_OFFER_SIZE,
+        BENCHMARK_OFFER_SIZE,
+        opening,
+        validFrom,
+        validTo);
+    built &= (built && offer.SignContract(nym));
+    built &= (built && offer.SaveContract());
+    built &= (built && trade.IssueTrade(offer));
+    trade.AddClosingTransactionNo(assetClosing);
+    trade.AddClosingTransactionNo(currencyClosing);
+    built &= (built && trade.SignContract(nym));
+    built &= (built && trade.SaveContract());
+
+    if (false == built) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to create offer."
+              << std::endl;
+
+        return false;
+    }
+
+    std::unique_ptr<OTTransaction> transaction(
+        OTTransaction::GenerateTransaction(
+            nymID,
+            assetAccountID,
+            server_id_,
+            OTTransaction::marketOffer,
+            originType::origin_market_offer,
+            opening));
+    std::unique_ptr<Item> item(Item::CreateItemFromTransaction(
+        *transaction, Item::marketOffer, &currencyAccountID));
+    String attachment;
+    trade.SaveContractRaw(attachment);
+    item->SetAttachment(attachment);
+    item->SignContract(nym);
+    item->SaveContract();
+    transaction->AddItem(*item.release());
+    auto statement = context.Statement(*transaction);
+
+    if (false == bool(statement)) { return false; }
+
+    transaction->AddItem(*statement.release());
+    const bool success = notarize(
+        context,
+        MessageType::notarizeTransaction,
+        assetAccountID,
+        transaction,
+        "marketOffer");
+    opening.SetSuccess(success);
+    assetClosing.SetSuccess(success);
+    currencyClosing.SetSuccess(success);
+
+    return success;
+}
+
+bool NotaryBenchmark::notarize(
+    ServerContext& context,
+    const MessageType type,
+    const Identifier& accountID,
+    std::unique_ptr<OTTransaction>& transaction,
+    const std::string& label)
+{
+    const auto& nym = *context.Nym();
+    transaction->SignContract(nym);
+    transaction->SaveContract();
+    Ledger ledger(nym.ID(), accountID, server_id_);
+    ledger.GenerateLedger(accountID, server_id_, Ledger::message);
+    ledger.AddTransaction(*transaction.release());
+    ledger.SignContract(nym);
+    ledger.SaveContract();
+    const auto requestNumber = sync(context);
+    auto [number, request] = context.InitializeServerCommand(
+        type, OTASCIIArmor(String(ledger)), accountID, requestNumber);
+
+    if (false == bool(request)) { return false; }
+
+    if (false == context.FinalizeServerCommand(*request)) { return false; }
+
+    Message reply;
+
+    return process(label, *request, reply, true);
+}
+
+double NotaryBenchmark::percentile(
+    const std::vector<std::chrono::nanoseconds>& sorted,
+    const double fraction)
+{
+    if (sorted.empty()) { return 0.0; }
+
+    const auto rank = static_cast<std::size_t>(
+        std::ceil(fraction * static_cast<double>(sorted.size())));
+    const auto& sample = sorted.at((0 == rank) ? 0 : rank - 1);
+
+    return std::chrono::duration<double, std::micro>(sample).count();
+}
+
+bool NotaryBenchmark::process(
+    const std::string& label,
+    const Message& request,
+    Message& reply,
+    const bool transaction)
+{
+    auto& processor = server_.GetUserCommandProcessor();
+    const auto start = std::chrono::steady_clock::now();
+    const bool processed = processor.ProcessUserCommand(request, reply);
+    const auto finish = std::chrono::steady_clock::now();
+    const bool success =
+        processed && (transaction ? accepted(reply) : reply.m_bSuccess);
+
+    if (label.empty()) { return success; }
+
+    auto& output = samples(label);
+    output.latency_.emplace_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start));
+
+    if (false == success) { ++output.failed_; }
+
+    return success;
+}
+
+bool NotaryBenchmark::process_inbox(
+    const Identifier& nymID,
+    const Identifier& accountID)
+{
+    auto editor = wallet_.mutable_ServerContext(nymID, server_id_);
+    auto& context = editor.It();
+    const auto& nym = *context.Nym();
+    std::unique_ptr<Account> account(
+        Account::LoadExistingAccount(accountID, server_id_));
+    Ledger inbox(nymID, accountID, server_id_);
+    Ledger outbox(nymID, accountID, server_id_);
+
+    if ((false == bool(account)) || (false == inbox.LoadInbox()) ||
+        (false == outbox.LoadOutbox())) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to load account or boxes." << std::endl;
+
+        return false;
+    }
+
+    OTTransaction* pending{nullptr};
+
+    for (std::int32_t i = 0; i < inbox.GetTransactionCount(); ++i) {
+        auto receipt = inbox.GetTransactionByIndex(i);
+
+        if ((nullptr != receipt) &&
+            (OTTransaction::pending == receipt->GetType())) {
+            pending = receipt;
+            break;
+        }
+    }
+
+    if (nullptr == pending) {
+        otErr << OT_METHOD << __FUNCTION__ << ": No pending transfers."
+              << std::endl;
+
+        return false;
+    }
+
+    auto number = context.NextTransactionNumber(MessageType::processInbox);
+
+    if (false == number.Valid()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Not enough transaction numbers." << std::endl;
+
+        return false;
+    }
+
+    std::unique_ptr<OTTransaction> transaction(
+        OTTransaction::GenerateTransaction(
+            nymID,
+            accountID,
+            server_id_,
+            OTTransaction::processInbox,
+            originType::not_applicable,
+            number));
+    std::unique_ptr<Item> item(
+        Item::CreateItemFromTransaction(*transaction, Item::acceptPending));
+    const auto pendingNumber = pending->GetTransactionNum();
+    const auto amount = pending->GetReceiptAmount();
+    item->SetNumberOfOrigin(pending->GetNumberOfOrigin());
+    item->SetReferenceToNum(pendingNumber);
+    item->SetAmount(amount);
+    item->SignContract(nym);
+    item->SaveContract();
+    transaction->AddItem(*item.release());
+    inbox.RemoveTransaction(pendingNumber);
+    std::unique_ptr<Item> balance(inbox.GenerateBalanceStatement(
+        amount, *transaction, context, *account, outbox));
+
+    if (false == bool(balance)) { return false; }
+
+    transaction->AddItem(*balance.release());
+    const bool success = notarize(
+        context,
+        MessageType::processInbox,
+        accountID,
+        transaction,
+        "processInbox");
+    number.SetSuccess(success);
+
+    if (success) { context.ConsumeIssued(number); }
+
+    return success;
+}
+
+OTIdentifier NotaryBenchmark::register_account(
+    const Identifier& nymID,
+    const Identifier& unitID)
+{
+    auto editor = wallet_.mutable_ServerContext(nymID, server_id_);
+    auto& context = editor.It();
+    const auto requestNumber = sync(context);
+    auto [number, request] = context.InitializeServerCommand(
+        MessageType::registerAccount, requestNumber);
+
+    if (false == bool(request)) { return Identifier::Factory(); }
+
+    request->m_strInstrumentDefinitionID = String(unitID);
+
+    if (false == context.FinalizeServerCommand(*request)) {
+
+        return Identifier::Factory();
+    }
+
+    Message reply;
+
+    if (false == process("", *request, reply)) { return Identifier::Factory(); }
+
+    return Identifier::Factory(reply.m_strAcctID);
+}
+
+bool NotaryBenchmark::register_nym(
+    const Identifier& nymID,
+    const std::string& label)
+{
+    auto editor = wallet_.mutable_ServerContext(nymID, server_id_);
+    auto& context = editor.It();
+    auto [number, request] =
+        context.InitializeServerCommand(MessageType::registerNym, 1);
+
+    if (false == bool(request)) { return false; }
+
+    request->m_ascPayload.SetData(
+        proto::ProtoAsData(context.Nym()->asPublicNym()));
+
+    if (false == context.FinalizeServerCommand(*request)) { return false; }
+
+    Message reply;
+
+    return process(label, *request, reply);
+}
+
+OTIdentifier NotaryBenchmark::register_unit(
+    const Identifier& nymID,
+    const std::string& name,
+    const std::string& tla,
+    OTIdentifier& unitID)
+{
+    auto unit = wallet_.UnitDefinition(
+        nymID.str(), name, name, tla, "Notary benchmark unit", tla, 2, "");
+
+    if (false == bool(unit)) { return Identifier::Factory(); }
+
+    // The notary shares this wallet, and it refuses to register a unit
+    // definition it already knows about.
+    const auto serialized = unit->PublicContract();
+    unitID = Identifier::Factory(unit->ID());
+    unit.reset();
+    wallet_.RemoveUnitDefinition(unitID);
+    auto editor = wallet_.mutable_ServerContext(nymID, server_id_);
+    auto& context = editor.It();
+    const auto requestNumber = sync(context);
+    auto [number, request] = context.InitializeServerCommand(
+        MessageType::registerInstrumentDefinition, requestNumber);
+
+    if (false == bool(request)) { return Identifier::Factory(); }
+
+    request->m_strInstrumentDefinitionID = String(unitID);
+    request->m_ascPayload.SetData(proto::ProtoAsData(serialized));
+
+    if (false == context.FinalizeServerCommand(*request)) {
+
+        return Identifier::Factory();
+    }
+
+    Message reply;
+
+    if (false == process("", *request, reply)) { return Identifier::Factory(); }
+
+    return Identifier::Factory(reply.m_strAcctID);
+}
+
+void NotaryBenchmark::Report(std::ostream& out) const
+{
+    out << std::left << std::setw(24) << "command" << std::right
+        << std::setw(8) << "ops" << std::setw(8) << "failed" << std::setw(12)
+        << "ops/sec" << std::setw(12) << "p50 (us)" << std::setw(12)
+        << "p90 (us)" << std::setw(12) << "p99 (us)" << std::setw(12)
+        << "max (us)" << std::endl;
+
+    for (const auto& [command, samples] : results_) {
+        auto sorted = samples.latency_;
+        std::sort(sorted.begin(), sorted.end());
+        std::chrono::nanoseconds total{0};
+
+        for (const auto& sample : sorted) { total += sample; }
+
+        const auto seconds = std::chrono::duration<double>(total).count();
+        const auto rate =
+            (0.0 < seconds) ? static_cast<double>(sorted.size()) / seconds
+                            : 0.0;
+        out << std::left << std::setw(24) << command << std::right
+            << std::setw(8) << sorted.size() << std::setw(8)
+            << samples.failed_ << std::fixed << std::setprecision(1)
+            << std::setw(12) << rate << std::setw(12)
+            << percentile(sorted, 0.50) << std::setw(12)
+            << percentile(sorted, 0.90) << std::setw(12)
+            << percentile(sorted, 0.99) << std::setw(12)
+            << percentile(sorted, 1.00) << std::endl;
+    }
+}
+
+void NotaryBenchmark::ReportJSON(std::ostream& out) const
+{
+    out << "{\n  \"iterations\": " << iterations_ << ",\n  \"commands\": [";
+    bool first{true};
+
+    for (const auto& [command, samples] : results_) {
+        auto sorted = samples.latency_;
+        std::sort(sorted.begin(), sorted.end());
+        std::chrono::nanoseconds total{0};
+
+        for (const auto& sample : sorted) { total += sample; }
+
+        const auto seconds = std::chrono::duration<double>(total).count();
+        const auto rate =
+            (0.0 < seconds) ? static_cast<double>(sorted.size()) / seconds
+                            : 0.0;
+        out << (first ? "\n" : ",\n") << std::fixed << std::setprecision(3)
+            << "    {\"name\": \"" << command
+            << "\", \"operations\": " << sorted.size()
+            << ", \"failed\": " << samples.failed_
+            << ", \"ops_per_sec\": " << rate
+            << ", \"p50_us\": " << percentile(sorted, 0.50)
+            << ", \"p90_us\": " << percentile(sorted, 0.90)
+            << ", \"p99_us\": " << percentile(sorted, 0.99)
+            << ", \"max_us\": " << percentile(sorted, 1.00) << "}";
+        first = false;
+    }
+
+    out << "\n  ]\n}" << std::endl;
+}
+
+bool NotaryBenchmark::Run()
+{
+    // Nym creation costs far more than registration, so every nym is
+    // generated before anything is timed.
+    std::vector<ConstNym> newcomers{};
+
+    for (std::size_t i = 0; i < iterations_; ++i) {
+        newcomers.emplace_back(create_nym("newcomer " + std::to_string(i)));
+    }
+
+    const auto issuer = create_nym("issuer");
+    const auto recipient = create_nym("recipient");
+    const auto trader = create_nym("trader");
+    const auto requester = create_nym("requester");
+
+    for (const auto& nym : newcomers) {
+        OT_ASSERT(nym);
+
+        register_nym(nym->ID(), "registerNym");
+    }
+
+    for (const auto& nym : {issuer, recipient, trader, requester}) {
+        OT_ASSERT(nym);
+
+        if (false == register_nym(nym->ID())) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Unable to register nym."
+                  << std::endl;
+
+            return false;
+        }
+    }
+
+    auto assetUnitID = Identifier::Factory();
+    auto currencyUnitID = Identifier::Factory();
+    const auto issuerAccountID =
+        register_unit(issuer->ID(), "Benchmark asset", "BNA", assetUnitID);
+    register_unit(issuer->ID(), "Benchmark currency", "BNC", currencyUnitID);
+    const auto recipientAccountID =
+        register_account(recipient->ID(), assetUnitID);
+    const auto assetAccountID = register_account(trader->ID(), assetUnitID);
+    const auto currencyAccountID =
+        register_account(trader->ID(), currencyUnitID);
+
+    if (issuerAccountID->empty() || recipientAccountID->empty() ||
+        assetAccountID->empty() || currencyAccountID->empty()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to register accounts."
+              << std::endl;
+
+        return false;
+    }
+
+    bool issued = issue_numbers(issuer->ID(), iterations_);
+    issued &= issue_numbers(recipient->ID(), iterations_);
+    issued &= issue_numbers(trader->ID(), 3 * iterations_);
+
+    if (false == issued) { return false; }
+
+    OTCron::SetCronMaxItemsPerNym(std::max<std::int32_t>(
+        OTCron::GetCronMaxItemsPerNym(),
+        static_cast<std::int32_t>(iterations_ + 1)));
+
+    for (std::size_t i = 0; i < iterations_; ++i) {
+        transaction_numbers(requester->ID());
+    }
+
+    for (std::size_t i = 0; i < iterations_; ++i) {
+        transfer(
+            issuer->ID(),
+            issuerAccountID,
+            recipientAccountID,
+            BENCHMARK_AMOUNT);
+    }
+
+    for (std::size_t i = 0; i < iterations_; ++i) {
+        if (false == process_inbox(recipient->ID(), recipientAccountID)) {
+            break;
+        }
+    }
+
+    for (std::size_t i = 0; i < iterations_; ++i) {
+        market_offer(trader->ID(), assetAccountID, currencyAccountID);
+    }
+
+    return true;
+}
+
+NotaryBenchmark::Samples& NotaryBenchmark::samples(const std::string& label)
+{
+    for (auto& [command, samples] : results_) {
+        if (command == label) { return samples; }
+    }
+
+    results_.emplace_back(label, Samples{});
+
+    return results_.back().second;
+}
+
+RequestNumber NotaryBenchmark::sync(ServerContext& context) const
+{
+    // Stands in for the client processing the notary's replies: the request
+    // number and nymbox hash are copied from the notary's side of the
+    // relationship.
+    const auto server =
+        wallet_.ClientContext(server_nym_id_, context.Nym()->ID());
+
+    if (false == bool(server)) { return 1; }
+
+    if (server->HaveLocalNymboxHash()) {
+        context.SetLocalNymboxHash(server->LocalNymboxHash());
+    }
+
+    return std::max<RequestNumber>(1, server->Request());
+}
+
+bool NotaryBenchmark::transaction_numbers(const Identifier& nymID)
+{
+    auto editor = wallet_.mutable_ServerContext(nymID, server_id_);
+    auto& context = editor.It();
+    const auto requestNumber = sync(context);
+    auto [number, request] = context.InitializeServerCommand(
+        MessageType::getTransactionNumbers, requestNumber, true, true);
+
+    if (false == bool(request)) { return false; }
+
+    if (false == context.FinalizeServerCommand(*request)) { return false; }
+
+    Message reply;
+
+    return process("getTransactionNumbers", *request, reply);
+}
+
+bool NotaryBenchmark::transfer(
+    const Identifier& nymID,
+    const Identifier& fromAccountID,
+    const Identifier& toAccountID,
+    const Amount amount)
+{
+    auto editor = wallet_.mutable_ServerContext(nymID, server_id_);
+    auto& context = editor.It();
+    const auto& nym = *context.Nym();
+    std::unique_ptr<Account> account(
+        Account::LoadExistingAccount(fromAccountID, server_id_));
+    Ledger inbox(nymID, fromAccountID, server_id_);
+    Ledger outbox(nymID, fromAccountID, server_id_);
+
+    if ((false == bool(account)) || (false == inbox.LoadInbox()) ||
+        (false == outbox.LoadOutbox())) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to load account or boxes." << std::endl;
+
+        return false;
+    }
+
+    auto number =
+        context.NextTransactionNumber(MessageType::notarizeTransaction);
+
+    if (false == number.Valid()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Not enough transaction numbers." << std::endl;
+
+        return false;
+    }
+
+    std::unique_ptr<OTTransaction> transaction(
+        OTTransaction::GenerateTransaction(
+            nymID,
+            fromAccountID,
+            server_id_,
+            OTTransaction::transfer,
+            originType::not_applicable,
+            number));
+    std::unique_ptr<Item> item(Item::CreateItemFromTransaction(
+        *transaction, Item::transfer, &toAccountID));
+    item->SetAmount(amount);
+    item->SignContract(nym);
+    item->SaveContract();
+
+    // The balance statement must account for the pending transfer the notary
+    // is about to add to the outbox.
+    std::unique_ptr<OTTransaction> pending(OTTransaction::GenerateTransaction(
+        outbox, OTTransaction::pending, originType::not_applicable, 1));
+
+    OT_ASSERT(pending);
+
+    pending->SetReferenceString(String(*item));
+    pending->SetReferenceToNum(item->GetTransactionNum());
+    outbox.AddTransaction(*pending.release());
+    transaction->AddItem(*item.release());
+    std::unique_ptr<Item> balance(inbox.GenerateBalanceStatement(
+        amount * (-1), *transaction, context, *account, outbox));
+
+    if (false == bool(balance)) { return false; }
+
+    transaction->AddItem(*balance.release());
+    const bool success = notarize(
+        context,
+        MessageType::notarizeTransaction,
+        fromAccountID,
+        transaction,
+        "transfer");
+    number.SetSuccess(success);
+
+    return success;
+}
+}  // namespace opentxs::server
@@ -0,0 +1,136 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_BENCHMARKS_NOTARY_NOTARYBENCHMARK_HPP
+#define OPENTXS_BENCHMARKS_NOTARY_NOTARYBENCHMARK_HPP
+
+#include "Internal.hpp"
+
+#include "opentxs/api/client/Wallet.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opentxs::server
+{
+/** Drives an in-process notary through UserCommandProcessor, skipping the
+ *  network layer, and records how long the notary spends on each command.
+ *
+ *  Only the call to ProcessUserCommand is timed. Building and signing the
+ *  requests, and the setup shortcuts used to issue transaction numbers, are
+ *  excluded from the measurements. */
+class NotaryBenchmark
+{
+public:
+    NotaryBenchmark(const api::Native& ot, const std::size_t iterations);
+
+    bool Run();
+    void Report(std::ostream& out) const;
+    void ReportJSON(std::ostream& out) const;
+
+    ~NotaryBenchmark() = default;
+
+private:
+    struct Samples {
+        std::vector<std::chrono::nanoseconds> latency_{};
+        std::size_t failed_{0};
+    };
+
+    const api::client::Wallet& wallet_;
+    Server& server_;
+    const std::size_t iterations_;
+    const OTIdentifier server_id_;
+    const OTIdentifier server_nym_id_;
+    std::vector<std::pair<std::string, Samples>> results_;
+
+    static double percentile(
+        const std::vector<std::chrono::nanoseconds>& sorted,
+        const double fraction);
+    static Server& get_server(const api::Native& ot);
+
+    bool accepted(const Message& reply) const;
+    ConstNym create_nym(const std::string& name) const;
+    RequestNumber sync(ServerContext& context) const;
+
+    bool issue_numbers(const Identifier& nymID, const std::size_t count);
+    bool market_offer(
+        const Identifier& nymID,
+        const Identifier& assetAccountID,
+        const Identifier& currencyAccountID);
+    bool notarize(
+        ServerContext& context,
+        const MessageType type,
+        const Identifier& accountID,
+        std::unique_ptr<OTTransaction>& transaction,
+        const std::string& label);
+    bool process(
+        const std::string& label,
+        const Message& request,
+        Message& reply,
+        const bool transaction = false);
+    bool process_inbox(const Identifier& nymID, const Identifier& accountID);
+    OTIdentifier register_account(
+        const Identifier& nymID,
+        const Identifier& unitID);
+    bool register_nym(const Identifier& nymID, const std::string& label = "");
+    OTIdentifier register_unit(
+        const Identifier& nymID,
+        const std::string& name,
+        const std::string& tla,
+        OTIdentifier& unitID);
+    Samples& samples(const std::string& label);
+    bool transaction_numbers(const Identifier& nymID);
+    bool transfer(
+        const Identifier& nymID,
+        const Identifier& fromAccountID,
+        const Identifier& toAccountID,
+        const Amount amount);
+
+    NotaryBenchmark() = delete;
+    NotaryBenchmark(const NotaryBenchmark&) = delete;
+    NotaryBenchmark(NotaryBenchmark&&) = delete;
+    NotaryBenchmark& operator=(const NotaryBenchmark&) = delete;
+    NotaryBenchmark& operator=(NotaryBenchmark&&) = delete;
+};
+}  // namespace opentxs::server
+#endif  // OPENTXS_BENCHMARKS_NOTARY_NOTARYBENCHMARK_HPP
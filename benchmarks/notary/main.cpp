@@ -0,0 +1,138 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "NotaryBenchmark.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <ftw.h>
+#include <unistd.h>
+
+namespace
+{
+int remove_entry(const char* path, const struct stat*, int, struct FTW*)
+{
+    return ::remove(path);
+}
+
+// Deletes the data directory and everything the notary wrote to it
+class TemporaryDirectory
+{
+public:
+    char path_[37] = "/tmp/opentxs-notary-benchmark-XXXXXX";
+
+    bool Create() { return created_ = (nullptr != ::mkdtemp(path_)); }
+
+    ~TemporaryDirectory()
+    {
+        if (false == created_) { return; }
+
+        if (0 != ::nftw(path_, remove_entry, 16, FTW_DEPTH | FTW_PHYS)) {
+            std::cerr << "Unable to remove data directory " << path_ << ": "
+                      << std::strerror(errno) << std::endl;
+        }
+    }
+
+private:
+    bool created_{false};
+};
+}  // namespace
+
+// Usage: benchmarks-opentxs-notary [--iterations=<n>] [--json]
+//
+// The notary is started with a fresh data directory, so results are not
+// affected by whatever state a previous run left behind. The directory is
+// removed on exit.
+int main(int argc, char** argv)
+{
+    std::size_t iterations{100};
+    bool json{false};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        const std::string prefix("--iterations=");
+
+        if ("--json" == arg) {
+            json = true;
+        } else if (0 == arg.compare(0, prefix.size(), prefix)) {
+            iterations = std::stoul(arg.substr(prefix.size()));
+        } else {
+            std::cerr << "Unrecognized argument: " << arg << std::endl;
+
+            return 1;
+        }
+    }
+
+    TemporaryDirectory home{};
+
+    if (false == home.Create()) {
+        std::cerr << "Unable to create data directory: "
+                  << std::strerror(errno) << std::endl;
+
+        return 1;
+    }
+
+    ::setenv("HOME", home.path_, 1);
+    std::cerr << "Notary data directory: " << home.path_ << std::endl;
+    opentxs::ArgList args;
+    args[OPENTXS_ARG_BINDIP].emplace("127.0.0.1");
+    args[OPENTXS_ARG_COMMANDPORT].emplace("27085");
+    args[OPENTXS_ARG_EXTERNALIP].emplace("127.0.0.1");
+    args[OPENTXS_ARG_NAME].emplace("notary benchmark");
+    args[OPENTXS_ARG_NOTIFICATIONPORT].emplace("27086");
+    opentxs::OT::ServerFactory(args);
+    opentxs::server::NotaryBenchmark benchmark(opentxs::OT::App(), iterations);
+    const bool finished = benchmark.Run();
+
+    if (json) {
+        benchmark.ReportJSON(std::cout);
+    } else {
+        benchmark.Report(std::cout);
+    }
+
+    opentxs::OT::Cleanup();
+
+    return finished ? 0 : 1;
+}
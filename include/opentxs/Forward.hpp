@@ -69,6 +69,7 @@ class Util;
 
 namespace storage
 {
+class Driver;
 class Storage;
 }  // namespace storage
 
@@ -115,6 +116,7 @@ class PushSocket;
 class ReplyCallback;
 class ReplySocket;
 class RequestSocket;
+class RouterSocket;
 class Socket;
 class SubscribeSocket;
 }  // namespace zeromq
@@ -277,6 +279,7 @@ using OTZMQPushSocket = Pimpl<network::zeromq::PushSocket>;
 using OTZMQReplyCallback = Pimpl<network::zeromq::ReplyCallback>;
 using OTZMQReplySocket = Pimpl<network::zeromq::ReplySocket>;
 using OTZMQRequestSocket = Pimpl<network::zeromq::RequestSocket>;
+using OTZMQRouterSocket = Pimpl<network::zeromq::RouterSocket>;
 using OTZMQSubscribeSocket = Pimpl<network::zeromq::SubscribeSocket>;
 
 using OTUIActivitySummaryItem = SharedPimpl<ui::ActivitySummaryItem>;
@@ -312,6 +315,7 @@ extern template class opentxs::Pimpl<opentxs::network::zeromq::PushSocket>;
 extern template class opentxs::Pimpl<opentxs::network::zeromq::ReplyCallback>;
 extern template class opentxs::Pimpl<opentxs::network::zeromq::ReplySocket>;
 extern template class opentxs::Pimpl<opentxs::network::zeromq::RequestSocket>;
+extern template class opentxs::Pimpl<opentxs::network::zeromq::RouterSocket>;
 // extern template class
 // opentxs::Pimpl<opentxs::network::zeromq::SubscribeSocket>;
 
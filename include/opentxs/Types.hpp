@@ -190,6 +190,13 @@ enum class StorageBox : std::uint8_t {
     UNKNOWN = 255,
 };
 
+enum class ThreadChange : std::uint8_t {
+    RELOAD = 0,
+    ADDED = 1,
+    UPDATED = 2,
+    REMOVED = 3,
+};
+
 enum class Bip43Purpose : std::uint32_t {
     HDWALLET = 44,    // BIP-44
     PAYCODE = 47,     // BIP-47
@@ -445,6 +452,7 @@ enum class SocketType : std::uint8_t {
     Push = 5,
     Pull = 6,
     Pair = 7,
+    Router = 8,
 };
 
 enum class RemoteBoxType : std::int8_t {
@@ -59,6 +59,13 @@ public:
     using ChequeData = std::pair<
         std::unique_ptr<const class Cheque>,
         std::shared_ptr<const UnitDefinition>>;
+    /** Thread id, sequence number, type of change, and the affected item
+     *  (which is not set if the change is RELOAD) */
+    using ThreadUpdate = std::tuple<
+        std::string,
+        std::uint64_t,
+        ThreadChange,
+        std::shared_ptr<const proto::StorageThreadItem>>;
 
     EXPORT virtual bool AddBlockchainTransaction(
         const Identifier& nymID,
@@ -154,6 +161,19 @@ public:
         const Identifier& nymId,
         const Identifier& threadId,
         const Identifier& itemId) const = 0;
+    /**   Decode a message received from the ThreadPublisher endpoint
+     *
+     *    Every update published for a nym has a sequence number one higher
+     *    than the previous update. A subscriber which sees a gap has missed an
+     *    update and should reload whatever it built from the thread.
+     *
+     *    \param[in] message a message received from ThreadPublisher
+     *    \param[out] output the decoded update
+     *    \return False if the message is not a valid update
+     */
+    EXPORT virtual bool ParseThreadUpdate(
+        const opentxs::network::zeromq::Message& message,
+        ThreadUpdate& output) const = 0;
 
     EXPORT virtual ChequeData Cheque(
         const Identifier& nym,
@@ -210,7 +230,18 @@ public:
      */
     EXPORT virtual std::size_t UnreadCount(const Identifier& nym) const = 0;
 
+    /**   Endpoint on which changes to a nym's threads are published
+     *
+     *    Each change is published as one ThreadUpdate. (See ParseThreadUpdate)
+     */
     EXPORT virtual std::string ThreadPublisher(const Identifier& nym) const = 0;
+    /**   Sequence number of the last update published for a nym
+     *
+     *    Subscribers created after updates have been published start from
+     *    this value instead of treating the next update as a gap.
+     */
+    EXPORT virtual std::uint64_t ThreadSequence(
+        const Identifier& nym) const = 0;
 
     virtual ~Activity() = default;
 
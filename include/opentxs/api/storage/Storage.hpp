@@ -178,6 +178,11 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const = 0;
+    virtual bool Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::string& itemId,
+        std::shared_ptr<proto::StorageThreadItem>& item) const = 0;
     virtual bool Load(
         const std::string& id,
         std::shared_ptr<proto::UnitDefinition>& contract,
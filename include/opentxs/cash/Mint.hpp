@@ -47,6 +47,7 @@
 #include <cstdint>
 #include <ctime>
 #include <map>
+#include <mutex>
 
 namespace opentxs
 {
@@ -73,6 +74,9 @@ protected:
     // Encrypted.
     mapOfArmor m_mapPublic;  // An Ascii-armored string of the mint Public
                              // information. Base64-encoded only.
+    // Guards m_mapPrivate, m_mapPublic and m_nDenominationCount while
+    // GenerateNewMint adds denominations from several threads.
+    std::mutex m_lockDenominations;
 
     // The Notary ID, (a hash of the server contract whose public key is
     // m_keyPublic)
@@ -49,8 +49,10 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 #include <mutex>
+#include <utility>
 
 namespace opentxs
 {
@@ -182,9 +184,44 @@ private:
     list_of_strings m_accounts;
     list_of_strings m_nyms;
     vec_OTRecordList m_contents;
+    /** The box receipt of an abbreviated receipt, which was not available
+     * when its record was built: notary id, nym id, account id, box type and
+     * transaction number. */
+    typedef std::tuple<
+        std::string,
+        std::string,
+        std::string,
+        std::int32_t,
+        TransactionNumber>
+        MissingReceipt;
+    /** Records built on a previous Populate from one box, along with the
+     * state they depend on. The records are reused while the box file has the
+     * same digest, Populate runs in the same mode and none of the missing box
+     * receipts have been downloaded, since those would resolve more names. */
+    struct CachedBox {
+        std::string digest_{};
+        bool fast_{false};
+        std::vector<MissingReceipt> missing_{};
+        vec_OTRecordList records_{};
+    };
+
+    // Keyed by box location
+    std::map<std::string, CachedBox> m_cache;
     static const std::string s_blank;
     static const std::string s_message_type;
 
+    void cache_box(
+        const std::string& key,
+        const std::string& digest,
+        const Ledger* box,
+        const std::size_t first);
+    bool load_cached_box(
+        const String& folder,
+        const std::string& notaryID,
+        const std::string& ownerID,
+        std::string& key,
+        std::string& digest);
+
 public:  // ADDRESS BOOK CALLBACK
     static bool setAddrBookCaller(OTLookupCaller& theCaller);
     static OTLookupCaller* getAddrBookCaller();
@@ -330,6 +367,10 @@ public:
     /** Clears m_contents (NOT nyms, accounts, servers, or instrument
      * definitions.) */
     EXPORT void ClearContents();
+    /** Populate reuses the records of any box whose file is unchanged since
+     * the previous call. Clears those cached records, for example after
+     * contact names change. */
+    EXPORT void ClearCache();
     /** Populate already sorts. But if you have to add some external records
      * after Populate, then you can sort again. P.S. sorting is performed based
      * on the "from" date. */
@@ -353,6 +394,10 @@ public:
     // RETRIEVE:
     EXPORT std::int32_t size() const;
     EXPORT OTRecord GetRecord(std::int32_t nIndex);
+    /** Returns up to nCount records starting at nStart */
+    EXPORT std::vector<OTRecord> GetRecords(
+        std::int32_t nStart,
+        std::int32_t nCount) const;
     EXPORT bool RemoveRecord(std::int32_t nIndex);
 };
 }  // namespace opentxs
@@ -43,14 +43,18 @@
 
 #include "opentxs/api/Editor.hpp"
 #include "opentxs/core/contract/Signable.hpp"
+#include "opentxs/core/IntervalSet.hpp"
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
 #include <atomic>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <string>
+#include <thread>
 
 namespace opentxs
 {
@@ -108,10 +112,10 @@ protected:
     std::mutex& nymfile_lock_;
     const OTIdentifier server_id_;
     std::shared_ptr<const class Nym> remote_nym_{};
-    std::set<TransactionNumber> available_transaction_numbers_{};
-    std::set<TransactionNumber> issued_transaction_numbers_{};
+    IntervalSet<TransactionNumber> available_transaction_numbers_{};
+    IntervalSet<TransactionNumber> issued_transaction_numbers_{};
     std::atomic<RequestNumber> request_number_{0};
-    std::set<RequestNumber> acknowledged_request_numbers_{};
+    IntervalSet<RequestNumber> acknowledged_request_numbers_{};
     OTIdentifier local_nymbox_hash_;
     OTIdentifier remote_nymbox_hash_;
 
@@ -152,9 +156,18 @@ private:
     typedef Signable ot_super;
 
     const std::uint32_t target_version_{0};
-
+    // Wallet editors currently open on this context, per thread, so that only
+    // an editor nested inside another one on the same thread defers the save
+    std::map<std::thread::id, std::size_t> editors_{};
+    // Signed form of the current signature, used to skip re-signing
+    // unchanged contexts
+    std::string signed_{};
+
+    bool close_editor(const Lock& lock);
     proto::Context contract(const Lock& lock) const;
     proto::Context IDVersion(const Lock& lock) const;
+    bool needs_signature(const Lock& lock) const;
+    void open_editor();
     void save(class NymFile* nym, const Lock& lock) const;
     proto::Context SigVersion(const Lock& lock) const;
     bool validate(const Lock& lock) const override;
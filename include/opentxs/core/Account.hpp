@@ -141,10 +141,15 @@ public:
     EXPORT static Account* LoadExistingAccount(
         const Identifier& accountId,
         const Identifier& notaryID);
+    // Caller responsible to delete. A non-zero receiptBudget loads the box in
+    // lazy mode (see Ledger::SetLazyReceipts.)
+    EXPORT Ledger* LoadInbox(
+        const Nym& nym,
+        const std::size_t receiptBudget = 0) const;
     // Caller responsible to delete.
-    EXPORT Ledger* LoadInbox(const Nym& nym) const;
-    // Caller responsible to delete.
-    EXPORT Ledger* LoadOutbox(const Nym& nym) const;
+    EXPORT Ledger* LoadOutbox(
+        const Nym& nym,
+        const std::size_t receiptBudget = 0) const;
 
     // If you pass the identifier in, the inbox hash is recorded there
     EXPORT bool SaveInbox(Ledger& box, Identifier* hash = nullptr);
@@ -45,7 +45,11 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <set>
 #include <map>
@@ -63,7 +67,11 @@ bool operator<(
     const opentxs::OTIdentifier& rhs);
 
 /** An Identifier is basically a 256 bit hash value. This class makes it easy to
- * convert IDs back and forth to strings. */
+ * convert IDs back and forth to strings.
+ *
+ * Comparison and hashing work on the type byte and the raw digest. The
+ * encoded form returned by str() is computed once and cached until the
+ * digest changes. */
 class Identifier : virtual public implementation::Data
 {
 private:
@@ -102,6 +110,16 @@ public:
     EXPORT Identifier& operator=(const Identifier& rhs);
     EXPORT Identifier& operator=(Identifier&& rhs);
 
+    EXPORT Identifier& operator+=(const opentxs::Data& rhs) override;
+    EXPORT void Assign(const opentxs::Data& source) override;
+    EXPORT void Assign(const void* data, const std::size_t& size) override;
+    EXPORT void Concatenate(const void* data, const std::size_t& size) override;
+    EXPORT bool Randomize(const std::size_t& size) override;
+    EXPORT void Release() override;
+    EXPORT void SetSize(const std::size_t& size) override;
+    EXPORT void swap(opentxs::Data&& rhs) override;
+    EXPORT void zeroMemory() override;
+
     using ot_super::operator==;
     EXPORT bool operator==(const Identifier& s2) const;
     using ot_super::operator!=;
@@ -110,6 +128,9 @@ public:
     EXPORT bool operator<(const Identifier& s2) const;
     EXPORT bool operator<=(const Identifier& s2) const;
     EXPORT bool operator>=(const Identifier& s2) const;
+    /** Returns a hash of the type and digest suitable for unordered
+     *  containers. This is not a cryptographic hash. */
+    EXPORT std::size_t Hash() const;
 
     EXPORT void GetString(String& theStr) const;
     EXPORT std::string str() const;
@@ -138,13 +159,37 @@ private:
     static const size_t MinimumSize{10};
 
     ID type_{DefaultType};
+    mutable std::mutex encoded_lock_;
+    mutable std::shared_ptr<const std::string> encoded_{nullptr};
 
     Identifier* clone() const;
+    int compare(const Identifier& rhs) const;
+    std::shared_ptr<const std::string> encoded() const;
+    void reset_encoded();
 
     static proto::HashType IDToHashType(const ID type);
     static OTData path_to_data(
         const proto::ContactItemType type,
         const proto::HDPath& path);
 };
-}  // namespace opentxs0
+}  // namespace opentxs
+
+namespace std
+{
+template <>
+struct hash<opentxs::Identifier> {
+    std::size_t operator()(const opentxs::Identifier& id) const
+    {
+        return id.Hash();
+    }
+};
+
+template <>
+struct hash<opentxs::OTIdentifier> {
+    std::size_t operator()(const opentxs::OTIdentifier& id) const
+    {
+        return id->Hash();
+    }
+};
+}  // namespace std
 #endif  // OPENTXS_CORE_OTIDENTIFIER_HPP
@@ -0,0 +1,251 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_CORE_INTERVALSET_HPP
+#define OPENTXS_CORE_INTERVALSET_HPP
+
+#include "opentxs/Version.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <set>
+
+namespace opentxs
+{
+/** Set of integers stored as runs of consecutive values
+ *
+ *  Transaction and request numbers are issued in blocks and mostly consumed
+ *  in order, so a set holding thousands of them usually collapses to a
+ *  handful of [first, last] ranges. Lookup, insertion and removal are
+ *  O(log r) in the number of ranges and size() is O(1). Iteration visits
+ *  individual values in ascending order.
+ */
+template <class T>
+class IntervalSet
+{
+public:
+    using Ranges = std::map<T, T>;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const T& operator*() const { return value_; }
+        const T* operator->() const { return &value_; }
+
+        const_iterator& operator++()
+        {
+            if (value_ == range_->second) {
+                ++range_;
+                value_ = (range_ == end_) ? T{} : range_->first;
+            } else {
+                ++value_;
+            }
+
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto output = *this;
+            ++(*this);
+
+            return output;
+        }
+
+        bool operator==(const const_iterator& rhs) const
+        {
+            return (range_ == rhs.range_) && (value_ == rhs.value_);
+        }
+
+        bool operator!=(const const_iterator& rhs) const
+        {
+            return false == (*this == rhs);
+        }
+
+    private:
+        friend IntervalSet;
+
+        typename Ranges::const_iterator range_;
+        typename Ranges::const_iterator end_;
+        T value_;
+
+        const_iterator(
+            const typename Ranges::const_iterator range,
+            const typename Ranges::const_iterator end)
+            : range_(range)
+            , end_(end)
+            , value_((range == end) ? T{} : range->first)
+        {
+        }
+    };
+
+    const_iterator begin() const
+    {
+        return const_iterator(ranges_.cbegin(), ranges_.cend());
+    }
+
+    /** Returns an ordinary set holding the same values */
+    std::set<T> Copy() const
+    {
+        std::set<T> output{};
+
+        for (const auto& value : *this) {
+            output.emplace_hint(output.end(), value);
+        }
+
+        return output;
+    }
+
+    std::size_t count(const T& value) const
+    {
+        return (find_range(value) == ranges_.cend()) ? 0 : 1;
+    }
+
+    bool empty() const { return ranges_.empty(); }
+
+    const_iterator end() const
+    {
+        return const_iterator(ranges_.cend(), ranges_.cend());
+    }
+
+    /** Smallest value in the set. The set must not be empty. */
+    const T& front() const { return ranges_.cbegin()->first; }
+
+    const Ranges& ranges() const { return ranges_; }
+
+    std::size_t size() const { return size_; }
+
+    void clear()
+    {
+        ranges_.clear();
+        size_ = 0;
+    }
+
+    std::size_t erase(const T& value)
+    {
+        auto it = find_range(value);
+
+        if (it == ranges_.cend()) { return 0; }
+
+        const auto first = it->first;
+        const auto last = it->second;
+        auto next = ranges_.erase(it);
+
+        if (first != value) { ranges_.emplace_hint(next, first, value - 1); }
+
+        if (last != value) { ranges_.emplace_hint(next, value + 1, last); }
+
+        --size_;
+
+        return 1;
+    }
+
+    /** Returns false if the value was already present */
+    bool insert(const T& value)
+    {
+        auto next = ranges_.upper_bound(value);
+        const bool joinNext =
+            (next != ranges_.end()) && ((next->first - 1) == value);
+
+        if (next != ranges_.begin()) {
+            auto previous = std::prev(next);
+
+            if (value <= previous->second) { return false; }
+
+            if ((value - 1) == previous->second) {
+                if (joinNext) {
+                    previous->second = next->second;
+                    ranges_.erase(next);
+                } else {
+                    previous->second = value;
+                }
+
+                ++size_;
+
+                return true;
+            }
+        }
+
+        if (joinNext) {
+            const auto last = next->second;
+            next = ranges_.erase(next);
+            ranges_.emplace_hint(next, value, last);
+        } else {
+            ranges_.emplace_hint(next, value, value);
+        }
+
+        ++size_;
+
+        return true;
+    }
+
+    IntervalSet() = default;
+    IntervalSet(const IntervalSet&) = default;
+    IntervalSet(IntervalSet&&) = default;
+    IntervalSet& operator=(const IntervalSet&) = default;
+    IntervalSet& operator=(IntervalSet&&) = default;
+
+    ~IntervalSet() = default;
+
+private:
+    Ranges ranges_{};
+    std::size_t size_{0};
+
+    typename Ranges::const_iterator find_range(const T& value) const
+    {
+        auto it = ranges_.upper_bound(value);
+
+        if (it == ranges_.cbegin()) { return ranges_.cend(); }
+
+        --it;
+
+        if (value > it->second) { return ranges_.cend(); }
+
+        return it;
+    }
+};
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_INTERVALSET_HPP
@@ -46,7 +46,9 @@
 #include "opentxs/core/OTTransactionType.hpp"
 
 #include <cstdint>
+#include <list>
 #include <map>
+#include <memory>
 #include <set>
 
 namespace opentxs
@@ -82,8 +84,26 @@ private:  // Private prevents erroneous use by other classes.
         String strInput);
 
 private:
+    struct CachedReceipt {
+        std::unique_ptr<OTTransaction> receipt_{nullptr};
+        std::size_t size_{0};
+        std::list<std::int64_t>::iterator position_{};
+    };
+
     mapOfTransactions m_mapTransactions;  // a ledger contains a map of
                                           // transactions.
+    // Lazy receipt mode (receipt_budget_ > 0): abbreviated entries are left
+    // in m_mapTransactions, and full box receipts that are only needed for a
+    // lookup are kept in receipt_cache_, least recently used first out once
+    // the serialized size of the cache exceeds receipt_budget_.
+    std::size_t receipt_budget_{0};
+    std::size_t receipt_cache_size_{0};
+    std::map<std::int64_t, CachedReceipt> receipt_cache_;
+    std::list<std::int64_t> receipt_lru_;
+
+    OTTransaction* cached_receipt(const std::int64_t number);
+    OTTransaction* materialize_receipt(const std::int64_t number);
+    void release_receipt_cache();
 
 protected:
     // return -1 if error, 0 if nothing, and 1 if the node was processed.
@@ -207,6 +227,16 @@ public:
     // full version and compares the two. Returns success / fail.
     //
     EXPORT bool LoadBoxReceipt(const std::int64_t& lTransactionNum);
+    // In lazy mode VerifyAccount does not load the box receipts. Abbreviated
+    // entries stay compact, and GetTransferReceipt / GetChequeReceipt load
+    // the receipts they need to inspect into a cache bounded by budget bytes.
+    // Receipts that are returned to the caller are swapped into the ledger.
+    // A budget of zero turns lazy mode off.
+    EXPORT void SetLazyReceipts(const std::size_t budget);
+    EXPORT bool LazyReceipts() const { return 0 < receipt_budget_; }
+    // Returns the full version of a transaction, loading its box receipt
+    // first if the entry is abbreviated. Owned by the ledger.
+    EXPORT OTTransaction* GetFullTransaction(std::int64_t lTransactionNum);
     // Saves the Box Receipt separately.
     EXPORT bool SaveBoxReceipt(const std::int64_t& lTransactionNum);
     // "Deletes" it by adding MARKED_FOR_DELETION to the bottom of the file.
@@ -44,11 +44,16 @@
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/String.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <deque>
+#include <fstream>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <sstream>
+#include <string>
 #include <thread>
 
 #if defined(unix) || defined(__unix__) || defined(__unix) ||                   \
@@ -61,6 +66,35 @@
 #define PREDEF_MODE_DEBUG 1
 #endif
 
+/** True if a message at LEVEL is both compiled in (see OT_LOG_MAX_LEVEL) and
+ *  enabled at runtime. */
+#define OT_LOG_ENABLED(LEVEL)                                                  \
+    (((LEVEL) <= OT_LOG_MAX_LEVEL) && opentxs::Log::Enabled(LEVEL))
+
+/** Logging statements which evaluate their arguments only if the level is
+ *  enabled, and which compile to nothing for levels above OT_LOG_MAX_LEVEL:
+ *
+ *      OT_LOG_INFO << OT_METHOD << __FUNCTION__ << ": " << id << std::endl;
+ */
+#define OT_LOG(LEVEL, STREAM)                                                  \
+    if (false == OT_LOG_ENABLED(LEVEL)) {                                      \
+    } else                                                                     \
+        STREAM
+
+#define OT_LOG_OUT OT_LOG(0, opentxs::otOut)
+#define OT_LOG_WARN OT_LOG(1, opentxs::otWarn)
+#define OT_LOG_INFO OT_LOG(2, opentxs::otInfo)
+#define OT_LOG_3 OT_LOG(3, opentxs::otLog3)
+#define OT_LOG_4 OT_LOG(4, opentxs::otLog4)
+#define OT_LOG_5 OT_LOG(5, opentxs::otLog5)
+
+/** Emits one structured line of key=value pairs at the end of the statement:
+ *
+ *      OT_LOG_RECORD(2, "StorageSqlite3::Select").Add("sql", sql);
+ */
+#define OT_LOG_RECORD(LEVEL, EVENT)                                            \
+    OT_LOG(LEVEL, opentxs::LogRecord(LEVEL, EVENT))
+
 namespace opentxs
 {
 
@@ -75,6 +109,13 @@ class Settings;
 
 }  // namespace api
 
+namespace implementation
+{
+
+class LogQueue;
+
+}  // namespace implementation
+
 #ifdef _WIN32
 #ifdef OTLOG_IMPORT
 #undef OTLOG_IMPORT
@@ -96,19 +137,57 @@ OTLOG_IMPORT extern OTLogStream otLog3;  // logs using OTLog::vOutput(3)
 OTLOG_IMPORT extern OTLogStream otLog4;  // logs using OTLog::vOutput(4)
 OTLOG_IMPORT extern OTLogStream otLog5;  // logs using OTLog::vOutput(5)
 
+/** Each thread assembles its own lines, so writing to an OTLogStream does not
+ *  take a lock. Completed lines are handed to Log::Output or Log::Error. */
 class OTLogStream : public std::ostream, std::streambuf
 {
 private:
     int logLevel{0};
-    int next{0};
-    char* pBuffer{nullptr};
-    std::recursive_mutex lock_;
+
+    std::string& buffer() const;
+    void flush_line(std::string& line) const;
 
 public:
     explicit OTLogStream(int _logLevel);
-    ~OTLogStream();
+    ~OTLogStream() = default;
 
     virtual int overflow(int c) override;
+    virtual std::streamsize xsputn(const char* s, std::streamsize count)
+        override;
+};
+
+/** A single structured log line, written when the record is destroyed as:
+ *
+ *      event key=value key="value with spaces"
+ *
+ *  Use via OT_LOG_RECORD so that nothing is formatted for disabled levels. */
+class LogRecord
+{
+public:
+    EXPORT LogRecord& Add(const char* key, const std::string& value);
+    EXPORT LogRecord& Add(const char* key, const char* value);
+    template <typename T>
+    LogRecord& Add(const char* key, const T& value)
+    {
+        std::ostringstream formatted{};
+        formatted << value;
+
+        return Add(key, formatted.str());
+    }
+
+    EXPORT LogRecord(const std::int32_t level, const char* event);
+
+    EXPORT ~LogRecord();
+
+private:
+    const std::int32_t level_{0};
+    std::string line_{};
+
+    LogRecord() = delete;
+    LogRecord(const LogRecord&) = delete;
+    LogRecord(LogRecord&&) = delete;
+    LogRecord& operator=(const LogRecord&) = delete;
+    LogRecord& operator=(LogRecord&&) = delete;
 };
 
 class Log
@@ -119,7 +198,7 @@ private:
     static const String m_strPathSeparator;
 
     const api::Settings& config_;
-    std::int32_t m_nLogLevel{0};
+    std::atomic<std::int32_t> m_nLogLevel{0};
     bool m_bInitialized{false};
     bool write_log_file_{false};
     String m_strThreadContext{""};
@@ -127,12 +206,26 @@ private:
     String m_strLogFilePath{""};
     dequeOfStrings logDeque{};
     std::recursive_mutex lock_;
+    std::unique_ptr<implementation::LogQueue> queue_;
+    std::mutex writer_lock_;
+    std::ofstream logfile_;
+    std::atomic<bool> running_{false};
+    std::thread writer_;
 
     /** For things that represent internal inconsistency in the code. Normally
      * should NEVER happen even with bad input from user. (Don't call this
      * directly. Use the above #defined macro instead.) */
     static Assert::fpt_Assert_sz_n_sz(logAssert);
     static bool CheckLogger(Log* pLogger);
+    /** Hands a completed line to the background writer, or writes it
+     *  synchronously if the writer is not running. */
+    static bool write(const char* szOutput);
+
+    /** Writes every queued line. Caller must hold writer_lock_. */
+    void drain();
+    void start_writer();
+    void stop_writer();
+    void write_thread();
 
     Log(const api::Settings& config);
     Log() = delete;
@@ -142,6 +235,8 @@ private:
     Log& operator=(Log&&) = delete;
 
 public:
+    ~Log();
+
     /** now the logger checks the global config file itself for the
      * log-filename. */
     EXPORT static bool Init(
@@ -173,6 +268,12 @@ public:
 
     EXPORT static std::int32_t LogLevel();
     EXPORT static bool SetLogLevel(const std::int32_t& nLogLevel);
+    /** True if a message with the specified verbosity would be logged. Cheap
+     *  enough to guard formatting of verbose output. Negative verbosity means
+     *  an error, which is always logged. */
+    EXPORT static bool Enabled(const std::int32_t nVerbosity);
+    /** Blocks until every queued line has been written. */
+    EXPORT static void Flush();
 
     // OTLog Functions:
     //
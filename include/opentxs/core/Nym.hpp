@@ -79,6 +79,7 @@ typedef bool CredentialIndexModeFlag;
 class Nym : public opentxs::NymFile
 {
     friend class api::client::implementation::Wallet;
+    friend class Contract;
 
 public:
     static const CredentialIndexModeFlag ONLY_IDS = true;
@@ -328,6 +329,7 @@ public:
         proto::Signature& signature,
         const OTPasswordData* pPWData = nullptr) const
     {
+        Lock lock(signing_lock_);
         bool haveSig = false;
 
         for (auto& it : m_mapCredentialSets) {
@@ -369,6 +371,10 @@ private:
     bool m_bMarkForDeletion{false};
     std::string alias_;
     mutable std::mutex lock_;
+    // Held by SignProto and by Contract while they sign with this nym's keys,
+    // since the server nym is used from several threads (cron workers, reply
+    // finalizers.)
+    mutable std::mutex signing_lock_;
     std::atomic<std::uint64_t> revision_{0};
     proto::CredentialIndexMode mode_{proto::CREDINDEX_ERROR};
     String m_strNymfile;
@@ -45,7 +45,11 @@
 #include "containers/simple_ptr.hpp"
 
 #include <deque>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <map>
 #include <string>
@@ -72,11 +76,13 @@ enum PackType             // PACKING TYPE
   PACK_TYPE_ERROR         // (Should never be.)
 };
 
-// Currently supporting filesystem, with subclasses possible via API.
+// Currently supporting filesystem and pack files, with subclasses possible via
+// API.
 //
 enum StorageType         // STORAGE TYPE
 { STORE_FILESYSTEM = 0,  // Filesystem
-  STORE_TYPE_SUBCLASS    // (Subclass provided by API client via SWIG.)
+  STORE_TYPE_SUBCLASS,   // (Subclass provided by API client via SWIG.)
+  STORE_PACK             // Append-only pack file with an index
 };
 
 extern const char* StoredObjectTypeStrings[];
@@ -369,6 +375,19 @@ public:
 //
 class Storage
 {
+public:
+    // One write staged by a WriteBatch, addressed the same way as
+    // StorePlainString. If erase_ is set value_ is ignored.
+    struct BatchEntry {
+        bool erase_{false};
+        std::string folder_{};
+        std::string one_{};
+        std::string two_{};
+        std::string three_{};
+        std::string value_{};
+    };
+    typedef std::vector<BatchEntry> Batch;
+
 private:
     OTPacker* m_pPacker{nullptr};
 
@@ -441,6 +460,11 @@ protected:
         const std::string& twoStr = "",
         const std::string& threeStr = "") = 0;
 
+    // Writes every entry of the batch such that a crash leaves either all of
+    // them or none of them in place. The default implementation has no such
+    // guarantee: it simply stores the entries one at a time.
+    virtual bool onStoreBatch(const Batch& batch);
+
 public:
     // Use GetPacker() to access the Packer, throughout duration of this Storage
     // object.
@@ -542,6 +566,10 @@ public:
         const std::string& twoStr = "",
         const std::string& threeStr = "");
 
+    // Store plain strings and erasures atomically.
+
+    EXPORT bool StoreBatch(const Batch& batch);
+
     // Note:
     // Make sure to use: %newobject Factory::createObj();  IN OTAPI.i file!
     //
@@ -666,6 +694,78 @@ EXPORT bool EraseValueByKey(
     const std::string& twoStr = "",
     const std::string& threeStr = "");
 
+// Receives the location of every plain string written or erased through the
+// OTDB functions, normalized the same way as StorePlainString. contents is
+// nullptr for an erasure or a write which did not succeed. Writes staged in a
+// WriteBatch are reported when the batch is committed successfully.
+typedef std::function<void(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr,
+    const std::string* contents)>
+    WriteObserver;
+
+// Replaces the write observer. An empty function removes it.
+EXPORT void SetWriteObserver(const WriteObserver& observer);
+
+// While a WriteBatch is in scope, every StorePlainString and EraseValueByKey
+// call made by the thread which created it is staged instead of written, and
+// QueryPlainString and Exists on that thread see the staged values. The
+// staged writes go to the default storage as a single atomic batch when
+// Commit() is called or the batch goes out of scope. A batch created while
+// another one is active on the same thread joins the outer batch.
+// StoreObject and QueryObject are not staged: they bypass the batch and
+// write or read the packed object immediately.
+class WriteBatch
+{
+public:
+    // Returns the batch active on the calling thread, or nullptr.
+    EXPORT static WriteBatch* Current();
+
+    EXPORT bool Commit();
+    EXPORT void Erase(
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "");
+    // Returns false if nothing is staged for the location. Otherwise sets
+    // exists to false if the staged write is an erasure.
+    EXPORT bool Query(
+        std::string& value,
+        bool& exists,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") const;
+    EXPORT void Store(
+        const std::string& value,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "");
+
+    EXPORT WriteBatch();
+
+    EXPORT ~WriteBatch();
+
+private:
+    const bool nested_{false};
+    Storage::Batch entries_;
+    std::map<std::string, std::size_t> index_;
+
+    Storage::BatchEntry& stage(
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr);
+
+    WriteBatch(const WriteBatch&) = delete;
+    WriteBatch(WriteBatch&&) = delete;
+    WriteBatch& operator=(const WriteBatch&) = delete;
+    WriteBatch& operator=(WriteBatch&&) = delete;
+};
+
 #define DECLARE_GET_ADD_REMOVE(name)                                           \
                                                                                \
 protected:                                                                     \
@@ -1552,6 +1652,8 @@ class StorageFS : public Storage
 {
 private:
     std::string m_strDataPath;
+    // There is one journal, so batches are applied one at a time
+    std::mutex batch_lock_;
 
 protected:
     StorageFS();  // You have to use the factory to instantiate (so it can
@@ -1585,6 +1687,12 @@ private:
         const std::string& oneStr,
         const std::string& twoStr,
         const std::string& threeStr);
+    // Writes every entry of a committed batch and syncs the files
+    bool apply_batch(const Batch& batch);
+    std::string journal_path() const;
+    // Returns false if a committed journal could not be applied, in which
+    // case it is left in place.
+    bool replay_journal();
 
 protected:
     // If you wish to make your own subclass of OTDB::Storage, then use
@@ -1625,6 +1733,12 @@ protected:
         const std::string& twoStr = "",
         const std::string& threeStr = "") override;
 
+    // Writes the batch to a journal which is synced, then to the individual
+    // files, which are synced before the journal is removed. An interrupted
+    // batch is replayed from the journal the next time the storage is
+    // created or a batch is stored.
+    bool onStoreBatch(const Batch& batch) override;
+
 public:
     bool Exists(
         const std::string& strFolder,
@@ -1654,6 +1768,162 @@ public:
         struct stat* pst = nullptr);  // local to data_folder
 };
 
+// StoragePack means "Storage in a pack file."
+//
+// Every object is a record appended to a single pack file in the data folder,
+// keyed by the same relative path StorageFS would have used. An in-memory
+// index maps the key hash to the offset of the newest record. Erasing appends
+// a tombstone. The index is saved periodically, and by Flush() on shutdown, so
+// that startup only has to scan records written since then. The pack is
+// compacted automatically once most of it holds replaced or erased records.
+// A batch is appended as one group record which is synced once and only
+// indexed if the whole group reached the disk.
+//
+class StoragePack : public Storage
+{
+public:
+    bool Exists(
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    std::int64_t FormPathString(
+        std::string& strOutput,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    // Rewrites the pack file so that it contains only live records.
+    EXPORT bool Compact();
+    // Saves a snapshot of the index. Call before shutting down, since the
+    // default storage is never destroyed.
+    EXPORT bool Flush();
+    // Copies every file from the StorageFS tree in the data folder into the
+    // pack, skipping keys which are already present. Returns the number of
+    // files imported, or -1 on error.
+    EXPORT std::int64_t ImportLegacy();
+
+    static StoragePack* Instantiate() { return new StoragePack; }
+
+    virtual ~StoragePack();
+
+protected:
+    StoragePack();  // You have to use the factory to instantiate (so it can
+                    // create the Packer also.)
+
+    bool onStorePackedBuffer(
+        PackedBuffer& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    bool onQueryPackedBuffer(
+        PackedBuffer& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    bool onStorePlainString(
+        const std::string& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    bool onQueryPlainString(
+        std::string& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    bool onEraseValueByKey(
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    bool onStoreBatch(const Batch& batch) override;
+
+private:
+    typedef std::unordered_multimap<std::uint64_t, std::uint64_t> Index;
+
+    std::mutex lock_;
+    std::string m_strDataPath;
+    std::string pack_path_;
+    std::string index_path_;
+    std::fstream pack_;
+    std::uint64_t generation_{0};
+    std::uint64_t end_{0};
+    // Value of end_ when the index was last saved
+    std::uint64_t saved_{0};
+    // Bytes of records which are no longer referenced by the index
+    std::uint64_t dead_{0};
+    Index index_;
+
+    static std::uint64_t hash_key(const std::string& key);
+
+    static void encode(
+        const std::uint8_t type,
+        const std::string& key,
+        const std::string& value,
+        std::string& output);
+
+    static bool sync_file(const std::string& path);
+
+    bool append(
+        const std::uint8_t type,
+        const std::string& key,
+        const std::string& value);
+    bool compact();
+    bool find(
+        const std::string& key,
+        Index::iterator& it,
+        std::uint32_t& valueSize);
+    bool form_key(
+        std::string& key,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) const;
+    std::int64_t import_folder(
+        const std::string& root,
+        const std::string& relative);
+    bool load_index();
+    void maintain();
+    bool open_pack();
+    bool read(const std::string& key, std::string& value);
+    bool read_header(
+        const std::uint64_t offset,
+        std::uint8_t& type,
+        std::uint32_t& keySize,
+        std::uint32_t& valueSize);
+    bool read_key(
+        const std::uint64_t offset,
+        const std::uint32_t keySize,
+        std::string& key);
+    bool save_index();
+    void scan(const std::uint64_t from);
+    bool scan_batch(
+        const std::uint64_t offset,
+        const std::uint32_t keySize,
+        const std::uint32_t valueSize,
+        std::uint64_t& next);
+    bool sync();
+    void update_index(
+        const std::uint8_t type,
+        const std::string& key,
+        const std::uint64_t offset);
+    bool write(const std::string& key, const std::string& value);
+
+    StoragePack(const StoragePack&) = delete;
+    StoragePack& operator=(const StoragePack&) = delete;
+};
+
 }  // namespace OTDB
 
 // IStorable-derived types...
@@ -46,6 +46,10 @@
 #include "opentxs/core/util/Timer.hpp"
 #include "opentxs/core/Contract.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 namespace opentxs
 {
 /** mapOfCronItems:      Mapped (uniquely) to transaction number. */
@@ -75,6 +79,32 @@ private:
     OTIdentifier m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
     listOfLongNumbers m_listTransactionNumbers;
+    // Cron items running on different worker threads draw numbers from the
+    // list above at the same time.
+    mutable std::mutex number_lock_;
+    // Numbers taken from the list since they were last journaled or written
+    // to the cron file.
+    std::vector<std::int64_t> taken_numbers_;
+    mutable std::recursive_mutex market_lock_;
+    // While ProcessCronItems is running, SaveCron only records that a save
+    // was requested. The cron file is written once at the end of the round.
+    std::atomic<bool> defer_save_{false};
+    std::atomic<bool> save_deferred_{false};
+    // Each cron item is stored in its own record (cron/items/NUM.itm.) The
+    // set of active items is the snapshot in OT-CRON.idx, plus the adds and
+    // removes journaled since then (cron/journal/SEQ.) The index and the
+    // journal entries are signed by the server Nym. The cron file itself
+    // only holds the markets and the transaction numbers. Numbers taken from
+    // the list are journaled too, so the cron file is only rewritten when
+    // numbers or markets are added, or when the journal is compacted.
+    std::map<std::int64_t, time64_t> m_mapDateAdded;
+    mutable std::mutex journal_lock_;
+    std::int64_t journal_first_{0};
+    std::int64_t journal_next_{0};
+    // Set when the journal holds numbers the cron file doesn't reflect yet.
+    bool numbers_journaled_{false};
+    // Set when the cron file still contains the items themselves.
+    bool legacy_items_{false};
     // I don't want to start Cron processing until everything else is all loaded
     //  up and ready to go.
     bool m_bIsActivated{false};
@@ -88,9 +118,28 @@ private:
     // Int. The maximum number of cron items any given Nym can have
     // active at the same time.
     static std::int32_t __cron_max_items_per_nym;
+    // Maximum number of threads processing cron items. 0 means one per core.
+    static std::int32_t __cron_worker_threads;
+    // Number of journal entries written before the item index is rewritten.
+    static std::int32_t __cron_journal_compact;
 
     static Timer tCron;
 
+    void partition_items(
+        std::vector<multimapOfCronItems::iterator>& ordered,
+        std::vector<std::vector<std::size_t>>& groups,
+        std::vector<std::size_t>& exclusive);
+
+    bool compact(const Lock& lock);
+    bool erase_item(const std::int64_t number);
+    bool journal(const char type, const std::int64_t number);
+    bool journal_numbers();
+    bool load_item(const String& strData, const time64_t tDateAdded);
+    bool load_items();
+    bool migrate_items();
+    bool save_item(OTCronItem& theItem, const time64_t tDateAdded);
+    bool write_cron();
+
 public:
     static std::int32_t GetCronMsBetweenProcess()
     {
@@ -114,6 +163,22 @@ public:
     {
         __cron_max_items_per_nym = nMax;
     }
+    static std::int32_t GetCronWorkerThreads()
+    {
+        return __cron_worker_threads;
+    }
+    static void SetCronWorkerThreads(std::int32_t nThreads)
+    {
+        __cron_worker_threads = nThreads;
+    }
+    static std::int32_t GetCronJournalCompact()
+    {
+        return __cron_journal_compact;
+    }
+    static void SetCronJournalCompact(std::int32_t nEntries)
+    {
+        __cron_journal_compact = nEntries;
+    }
     inline bool IsActivated() const { return m_bIsActivated; }
     inline bool ActivateCron()
     {
@@ -170,7 +235,12 @@ public:
      * transaction numbers in there must be enough to last for the entire
      * ProcessCronItems() call, and all the trades and payment plans within,
      * since it will not be replenished again at least until the call has
-     * finished.) */
+     * finished.)
+     *
+     * Items are split into groups that share no account, nym or market (see
+     * OTCronItem::GetFootprint) and the groups are processed on a pool of
+     * worker threads. Within a group, items run in the order they were added.
+     * Items that can't report a footprint run afterwards, one at a time. */
     EXPORT void ProcessCronItems();
 
     std::int64_t computeTimeout();
@@ -189,7 +259,12 @@ public:
     inline Nym* GetServerNym() const { return m_pServerNym; }
 
     EXPORT bool LoadCron();
+    /** Saves the markets and transaction numbers. Items are saved on their
+     * own, when they are added or change. */
     EXPORT bool SaveCron();
+    /** Call this after theItem has changed. Saves the item's record, then
+     * the cron file (since the item may have used transaction numbers.) */
+    EXPORT bool SaveCronItem(OTCronItem& theItem);
 
     EXPORT OTCron();
     explicit OTCron(const Identifier& NOTARY_ID);
@@ -49,6 +49,8 @@
 #include "opentxs/Types.hpp"
 
 #include <deque>
+#include <set>
+#include <string>
 
 namespace opentxs
 {
@@ -212,6 +214,10 @@ public:
                                                                     // side
                                                                     // only
 
+    /** Adds the IDs of every account, nym and market that ProcessCron can
+     *  modify. Returns false if that can't be determined, in which case
+     *  OTCron doesn't run this item alongside any other. */
+    virtual bool GetFootprint(std::set<std::string>&) const { return false; }
     // Return True if should stay on OTCron's list for more processing.
     // Return False if expired or otherwise should be removed.
     virtual bool ProcessCron();  // OTCron calls this regularly, which is my
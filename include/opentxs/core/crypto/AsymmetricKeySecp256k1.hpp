@@ -47,9 +47,14 @@
 #include "opentxs/core/crypto/Ecdsa.hpp"
 #include "opentxs/Proto.hpp"
 
+#include <array>
+#include <cstdint>
+#include <mutex>
+
 namespace opentxs
 {
 
+class Libsecp256k1;
 class String;
 
 class AsymmetricKeySecp256k1 : public AsymmetricKeyEC
@@ -58,12 +63,24 @@ private:
     typedef AsymmetricKeyEC ot_super;
     friend class OTAsymmetricKey;  // For the factory.
     friend class LowLevelKeyGenerator;
+    friend class Libsecp256k1;  // For the parsed public key.
+
+    // The parsed (secp256k1_pubkey) form of the public key. Libsecp256k1
+    // keeps it so the same key isn't converted and parsed again on every
+    // Verify. generation_ changes whenever the key is set, and the cached
+    // form is only used while parsed_generation_ matches it.
+    mutable std::mutex parsed_lock_;
+    mutable std::uint64_t generation_{1};
+    mutable std::uint64_t parsed_generation_{0};
+    mutable std::array<std::uint8_t, 64> parsed_{};
 
     AsymmetricKeySecp256k1();
     explicit AsymmetricKeySecp256k1(const proto::KeyRole role);
     explicit AsymmetricKeySecp256k1(const proto::AsymmetricKey& serializedKey);
     explicit AsymmetricKeySecp256k1(const String& publicKey);
 
+    void ReleaseKeyLowLevel_Hook() const override;
+
 public:
     const Ecdsa& ECDSA() const override;
     const CryptoAsymmetric& engine() const override;
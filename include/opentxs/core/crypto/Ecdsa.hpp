@@ -135,6 +135,13 @@ public:
         const OTPassword& seed,
         OTPassword& privateKey,
         Data& publicKey) const;
+    /** Calculates the ECDH secret which locks session keys exchanged between
+     *  these two keys */
+    virtual bool SessionKeySecret(
+        const AsymmetricKeyEC& privateKey,
+        const AsymmetricKeyEC& publicKey,
+        const OTPasswordData& password,
+        OTPassword& secret) const;
 
     virtual ~Ecdsa() = default;
 };
@@ -51,12 +51,16 @@
 #include "opentxs/core/crypto/OTPasswordData.hpp"
 #include "opentxs/Proto.hpp"
 
+#include <tuple>
+#include <vector>
+
 extern "C" {
 #include "secp256k1.h"
 }
 
 namespace opentxs
 {
+class AsymmetricKeySecp256k1;
 class OTAsymmetricKey;
 class Data;
 class OTPassword;
@@ -90,6 +94,11 @@ private:
     api::crypto::Util& ssl_;
 
     bool ParsePublicKey(const Data& input, secp256k1_pubkey& output) const;
+    /** Like ParsePublicKey, but reuses the result cached on the key unless
+     * the key has been set since it was parsed. */
+    bool ParsePublicKey(
+        const AsymmetricKeySecp256k1& key,
+        secp256k1_pubkey& output) const;
     void Init_Override() const override;
     void Cleanup_Override() const override{};
     bool ECDH(
@@ -121,6 +130,18 @@ public:
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const override;
 
+    /** public key, plaintext, signature */
+    using VerifyItem =
+        std::tuple<const OTAsymmetricKey&, const Data&, const Data&>;
+
+    /** Verifies the items on a pool of threads sharing the randomized
+     *  context. results[i] is set for items[i]. Returns true if every
+     *  signature verified. */
+    bool Verify(
+        const std::vector<VerifyItem>& items,
+        const proto::HashType hashType,
+        std::vector<bool>& results) const;
+
     virtual ~Libsecp256k1();
 };
 }  // namespace opentxs
@@ -88,14 +88,14 @@ namespace opentxs
 
 #define OT_PW_DISPLAY "Enter master passphrase for wallet."
 #define OT_DEFAULT_BLOCKSIZE 256
-#define OT_DEFAULT_MEMSIZE 257
 
 // Originally written for the safe storage of passwords.
 // Now used for symmetric keys as well.
 // Specifically: when the clear version of a password or key must be stored
 // usually for temporary reasons, it must be stored in memory locked from
 // swapping to disk, and in an object like OTPassword that zeros the memory as
-// soon as we're done.
+// soon as we're done. The buffer comes from a shared secure arena and grows
+// as needed, so secrets are not limited to the default block size.
 //
 // OTPassword tries to store a piece of data more securely.
 // During the time I have to take a password from the user and pass it to
@@ -132,11 +132,9 @@ public:
     EXPORT const char* getPassword() const;
     EXPORT std::uint8_t* getPasswordWritable();
     EXPORT char* getPasswordWritable_char();
-    // (FYI, truncates if nInputSize larger than getBlockSize.)
     EXPORT std::int32_t setPassword(const std::string& input);
 #ifndef SWIG
     EXPORT std::int32_t setPassword(const char* input, std::int32_t size);
-    // (FYI, truncates if nInputSize larger than getBlockSize.)
     EXPORT std::int32_t setPassword_uint8(
         const std::uint8_t* input,
         std::uint32_t size);
@@ -152,12 +150,9 @@ public:
     EXPORT const void* getMemory() const;
     EXPORT const std::uint8_t* getMemory_uint8() const;
     EXPORT void* getMemoryWritable();
-    // (FYI, truncates if size larger than getBlockSize.)
     EXPORT std::int32_t setMemory(const Data& data);
 #ifndef SWIG
     EXPORT std::int32_t setMemory(const void* input, std::uint32_t size);
-    // (FYI, truncates if size + getPasswordSize() is larger than
-    // getBlockSize.)
     EXPORT std::int32_t addMemory(const void* append, std::uint32_t size);
 #endif
     EXPORT std::int32_t randomizeMemory(
@@ -166,6 +161,8 @@ public:
         std::uint8_t* destination,
         std::uint32_t size);
     EXPORT static bool randomizeMemory(void* destination, std::uint32_t size);
+    /** Bytes which can be written through the writable accessors without
+     *  reallocating, not counting the terminator */
     EXPORT std::size_t getBlockSize() const;
     EXPORT bool Compare(OTPassword& rhs) const;
     EXPORT std::uint32_t getPasswordSize() const;
@@ -207,15 +204,14 @@ public:
 
 private:
     std::size_t size_{0};
-    std::uint8_t data_[OT_DEFAULT_MEMSIZE]{};
+    std::uint8_t* data_{nullptr};
+    std::size_t capacity_{0};
     bool isText_{false};
     bool isBinary_{false};
-    bool isPageLocked_{false};
-    const std::size_t blockSize_{OT_DEFAULT_BLOCKSIZE};
     std::uint32_t position_{};
 
-    bool ot_lockPage(void* addr, size_t len);
-    bool ot_unlockPage(void* addr, size_t len);
+    void release();
+    void reserve(const std::size_t required);
 };
 
 }  // namespace opentxs
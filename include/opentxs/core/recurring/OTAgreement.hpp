@@ -327,6 +327,7 @@ public:
     EXPORT void HarvestOpeningNumber(ServerContext& context) override;
     EXPORT void HarvestClosingNumbers(ServerContext& context) override;
 
+    bool GetFootprint(std::set<std::string>& output) const override;
     // Return True if should stay on OTCron's list for more processing.
     // Return False if expired or otherwise should be removed.
     bool ProcessCron() override;  // OTCron calls this regularly, which is my
@@ -201,6 +201,7 @@ public:
     EXPORT std::int64_t GetAssetAcctClosingNum() const;
     EXPORT std::int64_t GetCurrencyAcctClosingNum() const;
 
+    bool GetFootprint(std::set<std::string>& output) const override;
     // Return True if should stay on OTCron's list for more processing.
     // Return False if expired or otherwise should be removed.
     bool ProcessCron() override;  // OTCron calls this regularly, which is my
@@ -90,6 +90,20 @@ EXPORT OTTransaction* LoadBoxReceipt(
     OTTransaction& theAbbrev,
     std::int64_t lLedgerType);
 
+// The two halves of LoadBoxReceipt, split so that a caller loading many
+// receipts can do all the storage reads first and then parse and verify the
+// results in parallel. ReadBoxReceipt touches local storage;
+// InstantiateBoxReceipt does not, and is safe to call concurrently for
+// distinct abbreviated transactions.
+bool ReadBoxReceipt(
+    OTTransaction& theAbbrev,
+    std::int64_t lLedgerType,
+    String& strOutput);
+
+OTTransaction* InstantiateBoxReceipt(
+    OTTransaction& theAbbrev,
+    const String& strRawFile);
+
 bool SetupBoxReceiptFilename(
     std::int64_t lLedgerType,
     OTTransaction& theTransaction,
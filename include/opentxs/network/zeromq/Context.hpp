@@ -95,6 +95,8 @@ public:
         const ReplyCallback& callback) const = 0;
     EXPORT virtual Pimpl<network::zeromq::RequestSocket> RequestSocket()
         const = 0;
+    EXPORT virtual Pimpl<network::zeromq::RouterSocket> RouterSocket(
+        const ListenCallback& callback) const = 0;
     EXPORT virtual Pimpl<network::zeromq::SubscribeSocket> SubscribeSocket(
         const ListenCallback& callback) const = 0;
 
@@ -48,6 +48,7 @@ struct zmq_msg_t;
 #ifdef SWIG
 // clang-format off
 %ignore opentxs::network::zeromq::Frame::data;
+%ignore opentxs::network::zeromq::Frame::Factory(std::string&&);
 %ignore opentxs::network::zeromq::Frame::operator zmq_msg_t*;
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Frame>::Pimpl(opentxs::network::zeromq::Frame const &);
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Frame>::operator opentxs::network::zeromq::Frame&;
@@ -73,6 +74,9 @@ public:
         const opentxs::Data& input);
     EXPORT static Pimpl<opentxs::network::zeromq::Frame> Factory(
         const std::string& input);
+    /** Takes ownership of the buffer, which zmq sends without copying */
+    EXPORT static Pimpl<opentxs::network::zeromq::Frame> Factory(
+        std::string&& input);
 
     EXPORT virtual operator std::string() const = 0;
 
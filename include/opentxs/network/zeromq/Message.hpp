@@ -49,6 +49,7 @@
 %ignore opentxs::network::zeromq::Message::at(const std::size_t) const;
 %ignore opentxs::network::zeromq::Message::begin() const;
 %ignore opentxs::network::zeromq::Message::end() const;
+%ignore opentxs::network::zeromq::Message::AddFrame(std::string&&);
 %rename(assign) operator=(const opentxs::network::zeromq::Message&);
 %rename(ZMQMessage) opentxs::network::zeromq::Message;
 %template(OTZMQMessage) opentxs::Pimpl<opentxs::network::zeromq::Message>;
@@ -85,6 +86,8 @@ public:
     EXPORT virtual Frame& AddFrame() = 0;
     EXPORT virtual Frame& AddFrame(const opentxs::Data& input) = 0;
     EXPORT virtual Frame& AddFrame(const std::string& input) = 0;
+    /** Takes ownership of the buffer, which zmq sends without copying */
+    EXPORT virtual Frame& AddFrame(std::string&& input) = 0;
     EXPORT virtual Frame& at(const std::size_t index) = 0;
 
     EXPORT virtual ~Message() = default;
@@ -101,6 +101,7 @@
 #include <opentxs/core/Cheque.hpp>
 #include <opentxs/core/Data.hpp>
 #include <opentxs/core/Identifier.hpp>
+#include <opentxs/core/IntervalSet.hpp>
 #include <opentxs/core/Ledger.hpp>
 #include <opentxs/core/Log.hpp>
 #include <opentxs/core/Message.hpp>
@@ -127,6 +128,7 @@
 #include <opentxs/network/zeromq/ReplyCallback.hpp>
 #include <opentxs/network/zeromq/ReplySocket.hpp>
 #include <opentxs/network/zeromq/RequestSocket.hpp>
+#include <opentxs/network/zeromq/RouterSocket.hpp>
 #include <opentxs/network/zeromq/Socket.hpp>
 #include <opentxs/network/zeromq/SubscribeSocket.hpp>
 #include <opentxs/network/ServerConnection.hpp>
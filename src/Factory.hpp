@@ -214,6 +214,22 @@ public:
         const api::client::Wallet& wallet,
         const api::client::Workflow& workflow,
         const ContextLockCallback& lockCallback);
+    static storage::Mailbox* StorageMailbox(
+        const api::storage::Driver& storage,
+        const std::string& hash);
+    static storage::Thread* StorageThread(
+        const api::storage::Driver& storage,
+        const std::string& id,
+        const std::string& hash,
+        const std::string& alias,
+        storage::Mailbox& mailInbox,
+        storage::Mailbox& mailOutbox);
+    static storage::Thread* StorageThread(
+        const api::storage::Driver& storage,
+        const std::string& id,
+        const std::set<std::string>& participants,
+        storage::Mailbox& mailInbox,
+        storage::Mailbox& mailOutbox);
     static api::client::Sync* Sync(
         const Flag& running,
         const OT_API& otapi,
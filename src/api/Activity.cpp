@@ -53,6 +53,9 @@
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PublishSocket.hpp"
 #include "opentxs/Types.hpp"
 
@@ -75,6 +78,7 @@ Activity::Activity(
     , mail_cache_()
     , publisher_lock_()
     , thread_publishers_()
+    , thread_sequence_()
 {
 }
 
@@ -119,7 +123,9 @@ bool Activity::AddBlockchainTransaction(
     const bool saved = storage_.Store(
         sNymID, sthreadID, transaction.txid(), transaction.time(), {}, {}, box);
 
-    if (saved) { publish(nymID, sthreadID); }
+    if (saved) {
+        publish(nymID, sthreadID, ThreadChange::ADDED, transaction.txid());
+    }
 
     return saved;
 }
@@ -161,7 +167,9 @@ bool Activity::AddPaymentEvent(
         type,
         workflowID.str());
 
-    if (saved) { publish(nymID, sthreadID); }
+    if (saved) {
+        publish(nymID, sthreadID, ThreadChange::ADDED, itemID.str());
+    }
 
     return saved;
 }
@@ -220,20 +228,14 @@ Activity::ChequeData Activity::Cheque(
 }
 
 const opentxs::network::zeromq::PublishSocket& Activity::get_publisher(
-    const Identifier& nymID) const
-{
-    std::string endpoint{};
-
-    return get_publisher(nymID, endpoint);
-}
-
-const opentxs::network::zeromq::PublishSocket& Activity::get_publisher(
+    const Lock& lock,
     const Identifier& nymID,
     std::string& endpoint) const
 {
+    OT_ASSERT(verify_lock(lock, publisher_lock_))
+
     endpoint =
         opentxs::network::zeromq::Socket::ThreadUpdateEndpoint + nymID.str();
-    Lock lock(publisher_lock_);
     auto it = thread_publishers_.find(nymID);
 
     if (thread_publishers_.end() != it) { return it->second; }
@@ -251,14 +253,40 @@ const opentxs::network::zeromq::PublishSocket& Activity::get_publisher(
     return output;
 }
 
+std::shared_ptr<proto::StorageThreadItem> Activity::load_item(
+    const Identifier& nymID,
+    const std::string& threadID,
+    const std::string& itemID) const
+{
+    std::shared_ptr<proto::StorageThreadItem> output{};
+
+    if (false == storage_.Load(nymID.str(), threadID, itemID, output)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load item "
+              << itemID << " in thread " << threadID << std::endl;
+        output.reset();
+    }
+
+    return output;
+}
+
 bool Activity::MoveIncomingBlockchainTransaction(
     const Identifier& nymID,
     const Identifier& fromThreadID,
     const Identifier& toThreadID,
     const std::string& txid) const
 {
-    return storage_.MoveThreadItem(
-        nymID.str(), fromThreadID.str(), toThreadID.str(), txid);
+    const std::string fromThread = fromThreadID.str();
+    const std::string toThread = toThreadID.str();
+    const bool moved =
+        storage_.MoveThreadItem(nymID.str(), fromThread, toThread, txid);
+
+    if (moved) {
+        auto item = load_item(nymID, toThread, txid);
+        publish(nymID, fromThread, ThreadChange::REMOVED, item);
+        publish(nymID, toThread, ThreadChange::ADDED, item);
+    }
+
+    return moved;
 }
 
 std::unique_ptr<Message> Activity::Mail(
@@ -356,7 +384,7 @@ std::string Activity::Mail(
     if (saved) {
         std::thread preload(&Activity::preload, this, nym, id, box);
         preload.detach();
-        publish(nym, threadID);
+        publish(nym, threadID, ThreadChange::ADDED, output);
 
         return output;
     }
@@ -409,8 +437,11 @@ bool Activity::MarkRead(
     const std::string nym = nymId.str();
     const std::string thread = threadId.str();
     const std::string item = itemId.str();
+    const bool output = storage_.SetReadState(nym, thread, item, false);
 
-    return storage_.SetReadState(nym, thread, item, false);
+    if (output) { publish(nymId, thread, ThreadChange::UPDATED, item); }
+
+    return output;
 }
 
 bool Activity::MarkUnread(
@@ -421,8 +452,65 @@ bool Activity::MarkUnread(
     const std::string nym = nymId.str();
     const std::string thread = threadId.str();
     const std::string item = itemId.str();
+    const bool output = storage_.SetReadState(nym, thread, item, true);
+
+    if (output) { publish(nymId, thread, ThreadChange::UPDATED, item); }
+
+    return output;
+}
+
+bool Activity::ParseThreadUpdate(
+    const opentxs::network::zeromq::Message& message,
+    ThreadUpdate& output) const
+{
+    auto& [threadID, sequence, change, item] = output;
+    const auto body = message.Body();
+
+    if (3 > body.size()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid update" << std::endl;
+
+        return false;
+    }
+
+    try {
+        threadID = std::string(body.at(0));
+        sequence = std::stoull(std::string(body.at(1)));
+        change = static_cast<ThreadChange>(std::stoul(std::string(body.at(2))));
+    } catch (...) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Malformed update" << std::endl;
 
-    return storage_.SetReadState(nym, thread, item, true);
+        return false;
+    }
+
+    item.reset();
+
+    switch (change) {
+        case ThreadChange::RELOAD: {
+
+            return true;
+        }
+        case ThreadChange::ADDED:
+        case ThreadChange::UPDATED:
+        case ThreadChange::REMOVED: {
+        } break;
+        default: {
+            otErr << OT_METHOD << __FUNCTION__ << ": Unknown change type"
+                  << std::endl;
+
+            return false;
+        }
+    }
+
+    if (4 > body.size()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Missing item" << std::endl;
+
+        return false;
+    }
+
+    item = std::make_shared<proto::StorageThreadItem>(
+        proto::TextToProto<proto::StorageThreadItem>(body.at(3)));
+
+    return bool(item);
 }
 
 void Activity::MigrateLegacyThreads() const
@@ -636,11 +724,36 @@ void Activity::PreloadThread(
     preload.detach();
 }
 
-void Activity::publish(const Identifier& nymID, const std::string& threadID)
-    const
+void Activity::publish(
+    const Identifier& nymID,
+    const std::string& threadID,
+    const ThreadChange change,
+    const std::string& itemID) const
 {
-    auto& publisher = get_publisher(nymID);
-    publisher.Publish(threadID);
+    publish(nymID, threadID, change, load_item(nymID, threadID, itemID));
+}
+
+void Activity::publish(
+    const Identifier& nymID,
+    const std::string& threadID,
+    const ThreadChange change,
+    std::shared_ptr<const proto::StorageThreadItem> item) const
+{
+    // Subscribers which can not apply a change without the item will reload
+    const auto type = bool(item) ? change : ThreadChange::RELOAD;
+    auto message = opentxs::network::zeromq::Message::Factory();
+    message->AddFrame(threadID);
+    Lock lock(publisher_lock_);
+    message->AddFrame(std::to_string(++thread_sequence_[nymID]));
+    message->AddFrame(std::to_string(static_cast<std::uint32_t>(type)));
+
+    if (ThreadChange::RELOAD != type) {
+        message->AddFrame(proto::ProtoAsString(*item));
+    }
+
+    std::string endpoint{};
+    auto& publisher = get_publisher(lock, nymID, endpoint);
+    publisher.Publish(message);
 }
 
 std::shared_ptr<proto::StorageThread> Activity::Thread(
@@ -708,11 +821,22 @@ void Activity::thread_preload_thread(
 std::string Activity::ThreadPublisher(const Identifier& nym) const
 {
     std::string endpoint{};
-    get_publisher(nym, endpoint);
+    Lock lock(publisher_lock_);
+    get_publisher(lock, nym, endpoint);
 
     return endpoint;
 }
 
+std::uint64_t Activity::ThreadSequence(const Identifier& nym) const
+{
+    Lock lock(publisher_lock_);
+    const auto it = thread_sequence_.find(nym);
+
+    if (thread_sequence_.end() == it) { return 0; }
+
+    return it->second;
+}
+
 ObjectList Activity::Threads(const Identifier& nym, const bool unreadOnly) const
 {
     const std::string nymID = nym.str();
@@ -155,6 +155,10 @@ public:
         const Identifier& threadId,
         const Identifier& itemId) const override;
 
+    bool ParseThreadUpdate(
+        const opentxs::network::zeromq::Message& message,
+        ThreadUpdate& output) const override;
+
     ChequeData Cheque(
         const Identifier& nym,
         const std::string& id,
@@ -213,6 +217,7 @@ public:
     std::size_t UnreadCount(const Identifier& nym) const override;
 
     std::string ThreadPublisher(const Identifier& nym) const override;
+    std::uint64_t ThreadSequence(const Identifier& nym) const override;
 
     ~Activity() = default;
 
@@ -229,6 +234,7 @@ private:
     mutable MailCache mail_cache_;
     mutable std::mutex publisher_lock_;
     mutable std::map<Identifier, OTZMQPublishSocket> thread_publishers_;
+    mutable std::map<Identifier, std::uint64_t> thread_sequence_;
 
     /**   Migrate nym-based thread IDs to contact-based thread IDs
      *
@@ -251,11 +257,23 @@ private:
     std::shared_ptr<const Contact> nym_to_contact(
         const std::string& nymID) const;
     const opentxs::network::zeromq::PublishSocket& get_publisher(
-        const Identifier& nymID) const;
-    const opentxs::network::zeromq::PublishSocket& get_publisher(
+        const Lock& lock,
         const Identifier& nymID,
         std::string& endpoint) const;
-    void publish(const Identifier& nymID, const std::string& threadID) const;
+    std::shared_ptr<proto::StorageThreadItem> load_item(
+        const Identifier& nymID,
+        const std::string& threadID,
+        const std::string& itemID) const;
+    void publish(
+        const Identifier& nymID,
+        const std::string& threadID,
+        const ThreadChange change,
+        const std::string& itemID) const;
+    void publish(
+        const Identifier& nymID,
+        const std::string& threadID,
+        const ThreadChange change,
+        std::shared_ptr<const proto::StorageThreadItem> item) const;
 
     Activity(
         const ContactManager& contact,
@@ -54,6 +54,7 @@
 #include "server/Server.hpp"
 #include "server/ServerSettings.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 
@@ -66,6 +67,7 @@
 #define MINT_EXPIRE_MONTHS 6
 #define MINT_VALID_MONTHS 12
 #define MINT_GENERATE_DAYS 7
+#define MAX_MINT_GENERATORS 4
 #endif  // OT_CASH
 
 #define OT_METHOD "opentxs::api::implementation::Server::"
@@ -93,19 +95,27 @@ Server::Server(
           new server::MessageProcessor(server_, context, running_))
     , message_processor_(*message_processor_p_)
 #if OT_CASH
-    , mint_thread_(nullptr)
+    , mint_threads_()
     , mint_lock_()
     , mint_update_lock_()
     , mint_scan_lock_()
     , mints_()
     , mints_to_check_()
+    , mints_in_progress_()
 #endif  // OT_CASH
 {
     OT_ASSERT(server_p_);
     OT_ASSERT(message_processor_p_);
 
 #if OT_CASH
-    mint_thread_.reset(new std::thread(&Server::mint, this));
+    // Each mint already generates its denominations in parallel, so only a
+    // few units are worked on at the same time.
+    const auto generators = std::min<unsigned int>(
+        MAX_MINT_GENERATORS, std::max(std::thread::hardware_concurrency(), 1u));
+
+    for (unsigned int i = 0; i < generators; ++i) {
+        mint_threads_.emplace_back(&Server::mint, this);
+    }
 #endif  // OT_CASH
 }
 
@@ -118,14 +128,56 @@ void Server::Cleanup()
 }
 
 #if OT_CASH
+void Server::check_mint(const std::string& serverID, const std::string& unitID)
+    const
+{
+    const auto last = last_generated_series(serverID, unitID);
+    const auto next = last + 1;
+
+    if (0 > last) {
+        generate_mint(serverID, unitID, 0);
+
+        return;
+    }
+
+    auto mint = GetPrivateMint(Identifier::Factory(unitID), last);
+
+    if (false == bool(mint)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to load existing series." << std::endl;
+
+        return;
+    }
+
+    const auto now = std::time(nullptr);
+    const std::time_t expires = mint->GetExpiration();
+    const std::chrono::seconds limit(
+        std::chrono::hours(24 * MINT_GENERATE_DAYS));
+    const bool generate = ((now + limit.count()) > expires);
+
+    if (generate) {
+        generate_mint(serverID, unitID, next);
+    } else {
+        otErr << OT_METHOD << __FUNCTION__ << ": Existing mint file for "
+              << unitID << " is still valid." << std::endl;
+    }
+}
+
+// The new series is generated and signed entirely in memory. Nothing is
+// written and the cache is not touched until it is complete, so
+// GetPrivateMint and GetPublicMint keep serving the previous series while
+// the primes are being generated.
 void Server::generate_mint(
     const std::string& serverID,
     const std::string& unitID,
     const std::uint32_t series) const
 {
-    auto mint = GetPrivateMint(Identifier::Factory(unitID), series);
+    const std::string seriesID =
+        std::string(SERIES_DIVIDER) + std::to_string(series);
+    const auto exists = OTDB::Exists(
+        OTFolders::Mint().Get(), serverID.c_str(), (unitID + seriesID).c_str());
 
-    if (mint) {
+    if (exists) {
         otErr << OT_METHOD << __FUNCTION__ << ": Mint already exists."
               << std::endl;
 
@@ -133,9 +185,7 @@ void Server::generate_mint(
     }
 
     const std::string nymID{NymID().str()};
-    const std::string seriesID =
-        std::string(SERIES_DIVIDER) + std::to_string(series);
-    mint.reset(
+    std::shared_ptr<Mint> mint(
         Mint::MintFactory(serverID.c_str(), nymID.c_str(), unitID.c_str()));
 
     OT_ASSERT(mint)
@@ -156,6 +206,9 @@ void Server::generate_mint(
         return;
     }
 
+    otErr << OT_METHOD << __FUNCTION__ << ": Generating series " << series
+          << " for " << unitID << std::endl;
+    const auto started = std::chrono::steady_clock::now();
     mint->GenerateNewMint(
         series,
         now,
@@ -184,12 +237,18 @@ void Server::generate_mint(
     mint->SetSavePrivateKeys();
     mint->SignContract(nym);
     mint->SaveContract();
-    mint->SaveMint();
     mint->SaveMint(seriesID.c_str());
+    mint->SaveMint();
     mint->ReleaseSignatures();
     mint->SignContract(nym);
     mint->SaveContract();
     mint->SaveMint(PUBLIC_SERIES);
+    mintLock.unlock();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now() - started);
+    otErr << OT_METHOD << __FUNCTION__ << ": Series " << series << " for "
+          << unitID << " is ready after " << elapsed.count() << " seconds."
+          << std::endl;
 }
 
 const std::string Server::get_arg(const std::string& argName) const
@@ -289,6 +348,8 @@ std::shared_ptr<const Mint> Server::GetPublicMint(
 }
 #endif  // OT_CASH
 
+server::Server& Server::GetServer() const { return server_; }
+
 const std::string Server::GetUserName() const
 {
     return get_arg(OPENTXS_ARG_NAME);
@@ -371,45 +432,26 @@ void Server::mint() const
         std::string unitID{""};
         updateLock.lock();
 
-        if (0 < mints_to_check_.size()) {
-            unitID = mints_to_check_.back();
+        // Units already being handled by another generator thread are
+        // dropped, since that thread will leave the unit up to date.
+        while (unitID.empty() && (0 < mints_to_check_.size())) {
+            auto candidate = mints_to_check_.back();
             mints_to_check_.pop_back();
+
+            if (0 == mints_in_progress_.count(candidate)) {
+                mints_in_progress_.insert(candidate);
+                unitID = candidate;
+            }
         }
 
         updateLock.unlock();
 
         if (unitID.empty()) { continue; }
 
-        const auto last = last_generated_series(serverID, unitID);
-        const auto next = last + 1;
-
-        if (0 > last) {
-            generate_mint(serverID, unitID, 0);
-
-            continue;
-        }
-
-        auto mint = GetPrivateMint(Identifier::Factory(unitID), last);
-
-        if (false == bool(mint)) {
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Failed to load existing series." << std::endl;
-
-            continue;
-        }
-
-        const auto now = std::time(nullptr);
-        const std::time_t expires = mint->GetExpiration();
-        const std::chrono::seconds limit(
-            std::chrono::hours(24 * MINT_GENERATE_DAYS));
-        const bool generate = ((now + limit.count()) > expires);
-
-        if (generate) {
-            generate_mint(serverID, unitID, next);
-        } else {
-            otErr << OT_METHOD << __FUNCTION__ << ": Existing mint file for "
-                  << unitID << " is still valid." << std::endl;
-        }
+        check_mint(serverID, unitID);
+        updateLock.lock();
+        mints_in_progress_.erase(unitID);
+        updateLock.unlock();
     }
 }
 #endif  // OT_CASH
@@ -532,10 +574,11 @@ bool Server::verify_mint_directory(const std::string& serverID) const
 Server::~Server()
 {
 #if OT_CASH
-    if (mint_thread_) {
-        mint_thread_->join();
-        mint_thread_.reset();
+    for (auto& thread : mint_threads_) {
+        if (thread.joinable()) { thread.join(); }
     }
+
+    mint_threads_.clear();
 #endif  // OT_CASH
 }
 }  // namespace opentxs::api::implementation
@@ -49,8 +49,10 @@
 #include <deque>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace opentxs::api::implementation
 {
@@ -71,6 +73,8 @@ public:
     std::shared_ptr<const Mint> GetPublicMint(
         const Identifier& unitID) const override;
 #endif  // OT_CASH
+    /** The notary, for in-process drivers which bypass the network layer */
+    server::Server& GetServer() const;
     const std::string GetUserName() const override;
     const std::string GetUserTerms() const override;
     const Identifier& ID() const override;
@@ -101,15 +105,18 @@ private:
     std::unique_ptr<server::MessageProcessor> message_processor_p_;
     server::MessageProcessor& message_processor_;
 #if OT_CASH
-    std::unique_ptr<std::thread> mint_thread_;
+    std::vector<std::thread> mint_threads_;
     mutable std::mutex mint_lock_;
     mutable std::mutex mint_update_lock_;
     mutable std::mutex mint_scan_lock_;
     mutable std::map<std::string, MintSeries> mints_;
     mutable std::deque<std::string> mints_to_check_;
+    mutable std::set<std::string> mints_in_progress_;
 #endif  // OT_CASH
 
 #if OT_CASH
+    void check_mint(const std::string& serverID, const std::string& unitID)
+        const;
     void generate_mint(
         const std::string& serverID,
         const std::string& unitID,
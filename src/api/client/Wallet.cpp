@@ -275,6 +275,8 @@ Editor<class Context> Wallet::mutable_Context(
 
     OT_ASSERT(base);
 
+    base->open_editor();
+
     return Editor<class Context>(base.get(), callback);
 }
 
@@ -317,6 +319,8 @@ Editor<class ClientContext> Wallet::mutable_ClientContext(
 
     OT_ASSERT(nullptr != child);
 
+    base->open_editor();
+
     return Editor<class ClientContext>(child, callback);
 }
 
@@ -366,6 +370,8 @@ Editor<class ServerContext> Wallet::mutable_ServerContext(
 
     OT_ASSERT(nullptr != child);
 
+    base->open_editor();
+
     return Editor<class ServerContext>(child, callback);
 }
 
@@ -1166,9 +1172,16 @@ void Wallet::save(class Context* context) const
 
     Lock lock(context->lock_);
 
-    context->update_signature(lock);
+    // An enclosing editor for the same context is still open on this thread.
+    // It will sign and store the final state when it closes. Editors on other
+    // threads do not hold back this one's changes.
+    if (false == context->close_editor(lock)) { return; }
 
-    OT_ASSERT(context->validate(lock));
+    if (context->needs_signature(lock)) {
+        context->update_signature(lock);
+
+        OT_ASSERT(context->validate(lock));
+    }
 
     ot_.DB().Store(context->contract(lock));
 }
@@ -0,0 +1,574 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "stdafx.hpp"
+
+#include "Base64.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define OT_BASE64_X86 1
+#include <immintrin.h>
+#else
+#define OT_BASE64_X86 0
+#endif
+
+#define OT_BASE64_INVALID 0xff
+#define OT_BASE64_PAD 0xfe
+
+namespace
+{
+const char alphabet_[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+struct DecodeTable {
+    std::uint8_t value_[256];
+
+    DecodeTable()
+    {
+        std::memset(value_, OT_BASE64_INVALID, sizeof(value_));
+
+        for (std::uint8_t i = 0; i < 64; ++i) {
+            value_[static_cast<std::uint8_t>(alphabet_[i])] = i;
+        }
+
+        value_[static_cast<std::uint8_t>('=')] = OT_BASE64_PAD;
+    }
+};
+
+const DecodeTable& decode_table()
+{
+    static const DecodeTable table{};
+
+    return table;
+}
+
+enum class Isa : std::uint8_t { Scalar, SSSE3, AVX2 };
+
+Isa detect_isa()
+{
+#if OT_BASE64_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) { return Isa::AVX2; }
+
+    if (__builtin_cpu_supports("ssse3")) { return Isa::SSSE3; }
+#endif
+
+    return Isa::Scalar;
+}
+
+Isa isa()
+{
+    static const Isa output = detect_isa();
+
+    return output;
+}
+
+#if OT_BASE64_X86
+// Vector base64 follows W. Muła and D. Lemire, "Faster Base64 Encoding and
+// Decoding Using AVX2 Instructions" (ACM TOW 2018.)
+
+// Spreads 12 input bytes (as four groups of three) over 16 lanes holding one
+// six bit index each, then maps the indices to the base64 alphabet.
+__attribute__((target("ssse3"))) inline __m128i encode_ssse3(__m128i in)
+{
+    in = _mm_shuffle_epi8(
+        in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8(
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '+' - 62,
+        '/' - 63,
+        'A',
+        0,
+        0);
+    result = _mm_shuffle_epi8(offsets, result);
+
+    return _mm_add_epi8(result, indices);
+}
+
+__attribute__((target("avx2"))) inline __m256i encode_avx2(__m256i in)
+{
+    in = _mm256_shuffle_epi8(
+        in,
+        _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+    __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    result =
+        _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0);
+    result = _mm256_shuffle_epi8(offsets, result);
+
+    return _mm256_add_epi8(result, indices);
+}
+
+// Encodes whole 12 byte blocks for as long as a 16 byte load stays inside the
+// readable part of the input. Returns the number of input bytes consumed.
+__attribute__((target("ssse3"))) std::size_t encode_blocks_ssse3(
+    const std::uint8_t* input,
+    const std::size_t size,
+    const std::size_t readable,
+    char* output)
+{
+    std::size_t done{0};
+
+    while ((12 <= (size - done)) && (16 <= (readable - done))) {
+        const __m128i in = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + done));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + ((done / 3) * 4)),
+            encode_ssse3(in));
+        done += 12;
+    }
+
+    return done;
+}
+
+__attribute__((target("avx2"))) std::size_t encode_blocks_avx2(
+    const std::uint8_t* input,
+    const std::size_t size,
+    const std::size_t readable,
+    char* output)
+{
+    std::size_t done{0};
+
+    while ((24 <= (size - done)) && (28 <= (readable - done))) {
+        const __m128i low = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + done));
+        const __m128i high = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + done + 12));
+        const __m256i in =
+            _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + ((done / 3) * 4)),
+            encode_avx2(in));
+        done += 24;
+    }
+
+    return done + encode_blocks_ssse3(
+                      input + done,
+                      size - done,
+                      readable - done,
+                      output + ((done / 3) * 4));
+}
+
+// Lanes holding a character in [low, high] are set to 0xff
+__attribute__((target("ssse3"))) inline __m128i range_ssse3(
+    const __m128i in,
+    const char low,
+    const char high)
+{
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(in, _mm_set1_epi8(low - 1)),
+        _mm_cmplt_epi8(in, _mm_set1_epi8(high + 1)));
+}
+
+__attribute__((target("avx2"))) inline __m256i range_avx2(
+    const __m256i in,
+    const char low,
+    const char high)
+{
+    return _mm256_and_si256(
+        _mm256_cmpgt_epi8(in, _mm256_set1_epi8(low - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(high + 1), in));
+}
+
+// Translates 16 characters to their six bit values. Returns false if any of
+// them is outside the base64 alphabet (including padding and whitespace.)
+__attribute__((target("ssse3"))) inline bool translate_ssse3(
+    const __m128i in,
+    __m128i& values)
+{
+    const __m128i upper = range_ssse3(in, 'A', 'Z');
+    const __m128i lower = range_ssse3(in, 'a', 'z');
+    const __m128i digit = range_ssse3(in, '0', '9');
+    const __m128i plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+    const __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    const __m128i valid = _mm_or_si128(
+        _mm_or_si128(upper, lower),
+        _mm_or_si128(digit, _mm_or_si128(plus, slash)));
+
+    if (0xffff != _mm_movemask_epi8(valid)) { return false; }
+
+    const __m128i shift = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128(upper, _mm_set1_epi8(-65)),
+            _mm_and_si128(lower, _mm_set1_epi8(-71))),
+        _mm_or_si128(
+            _mm_and_si128(digit, _mm_set1_epi8(4)),
+            _mm_or_si128(
+                _mm_and_si128(plus, _mm_set1_epi8(19)),
+                _mm_and_si128(slash, _mm_set1_epi8(16)))));
+    values = _mm_add_epi8(in, shift);
+
+    return true;
+}
+
+// Packs 16 six bit values into 12 bytes at the bottom of the register.
+__attribute__((target("ssse3"))) inline __m128i pack_ssse3(
+    const __m128i values)
+{
+    const __m128i merged =
+        _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+
+    return _mm_shuffle_epi8(
+        packed,
+        _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+// Decodes whole 16 character blocks until one contains anything other than
+// base64 data. Writes 16 bytes per 12 decoded, so the output needs four
+// bytes of slack. Returns the number of characters consumed.
+__attribute__((target("ssse3"))) std::size_t decode_blocks_ssse3(
+    const char* input,
+    const std::size_t size,
+    std::uint8_t* output,
+    std::size_t& produced)
+{
+    std::size_t done{0};
+    produced = 0;
+
+    while (16 <= (size - done)) {
+        __m128i values{};
+        const __m128i in =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done));
+
+        if (false == translate_ssse3(in, values)) { break; }
+
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + produced), pack_ssse3(values));
+        done += 16;
+        produced += 12;
+    }
+
+    return done;
+}
+
+__attribute__((target("avx2"))) std::size_t decode_blocks_avx2(
+    const char* input,
+    const std::size_t size,
+    std::uint8_t* output,
+    std::size_t& produced)
+{
+    std::size_t done{0};
+    produced = 0;
+
+    while (32 <= (size - done)) {
+        const __m256i in =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done));
+        const __m256i upper = range_avx2(in, 'A', 'Z');
+        const __m256i lower = range_avx2(in, 'a', 'z');
+        const __m256i digit = range_avx2(in, '0', '9');
+        const __m256i plus = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('+'));
+        const __m256i slash = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+        const __m256i valid = _mm256_or_si256(
+            _mm256_or_si256(upper, lower),
+            _mm256_or_si256(digit, _mm256_or_si256(plus, slash)));
+
+        if (-1 != _mm256_movemask_epi8(valid)) { break; }
+
+        const __m256i shift = _mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_and_si256(upper, _mm256_set1_epi8(-65)),
+                _mm256_and_si256(lower, _mm256_set1_epi8(-71))),
+            _mm256_or_si256(
+                _mm256_and_si256(digit, _mm256_set1_epi8(4)),
+                _mm256_or_si256(
+                    _mm256_and_si256(plus, _mm256_set1_epi8(19)),
+                    _mm256_and_si256(slash, _mm256_set1_epi8(16)))));
+        const __m256i values = _mm256_add_epi8(in, shift);
+        const __m256i merged =
+            _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        const __m256i packed =
+            _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        const __m256i shuffled = _mm256_shuffle_epi8(
+            packed,
+            _mm256_setr_epi8(
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + produced),
+            _mm256_castsi256_si128(shuffled));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + produced + 12),
+            _mm256_extracti128_si256(shuffled, 1));
+        done += 32;
+        produced += 24;
+    }
+
+    std::size_t more{0};
+    done += decode_blocks_ssse3(
+        input + done, size - done, output + produced, more);
+    produced += more;
+
+    return done;
+}
+#endif  // OT_BASE64_X86
+
+std::size_t encode_blocks(
+    const std::uint8_t* input,
+    const std::size_t size,
+    const std::size_t readable,
+    char* output)
+{
+#if OT_BASE64_X86
+    switch (isa()) {
+        case Isa::AVX2: {
+            return encode_blocks_avx2(input, size, readable, output);
+        }
+        case Isa::SSSE3: {
+            return encode_blocks_ssse3(input, size, readable, output);
+        }
+        case Isa::Scalar:
+        default: {
+        }
+    }
+#endif
+
+    return 0;
+}
+
+std::size_t decode_blocks(
+    const char* input,
+    const std::size_t size,
+    std::uint8_t* output,
+    std::size_t& produced)
+{
+    produced = 0;
+
+#if OT_BASE64_X86
+    switch (isa()) {
+        case Isa::AVX2: {
+            return decode_blocks_avx2(input, size, output, produced);
+        }
+        case Isa::SSSE3: {
+            return decode_blocks_ssse3(input, size, output, produced);
+        }
+        case Isa::Scalar:
+        default: {
+        }
+    }
+#endif
+
+    return 0;
+}
+}  // namespace
+
+namespace opentxs::api::crypto::implementation
+{
+bool Base64::Decode(const char* input, const std::size_t size, RawData& output)
+{
+    const auto& table = decode_table().value_;
+    // Four bytes of slack for the vector stores
+    output.assign(((size / 4) * 3) + 3 + 4, 0x0);
+    std::uint8_t* out = output.data();
+    std::size_t produced{0};
+    std::uint32_t accumulator{0};
+    std::size_t count{0};
+    std::size_t i{0};
+
+    while (i < size) {
+        if (0 == count) {
+            std::size_t decoded{0};
+            i += decode_blocks(input + i, size - i, out + produced, decoded);
+            produced += decoded;
+
+            if (i >= size) { break; }
+        }
+
+        const auto value = table[static_cast<std::uint8_t>(input[i++])];
+
+        if (OT_BASE64_PAD == value) { break; }
+
+        // Line breaks, whitespace and anything else outside the alphabet
+        if (OT_BASE64_INVALID == value) { continue; }
+
+        accumulator = (accumulator << 6) | value;
+
+        if (4 == ++count) {
+            out[produced++] = static_cast<std::uint8_t>(accumulator >> 16);
+            out[produced++] = static_cast<std::uint8_t>(accumulator >> 8);
+            out[produced++] = static_cast<std::uint8_t>(accumulator);
+            accumulator = 0;
+            count = 0;
+        }
+    }
+
+    // A single leftover character doesn't hold a whole byte, and is dropped.
+    if (2 == count) {
+        out[produced++] = static_cast<std::uint8_t>(accumulator >> 4);
+    } else if (3 == count) {
+        out[produced++] = static_cast<std::uint8_t>(accumulator >> 10);
+        out[produced++] = static_cast<std::uint8_t>(accumulator >> 2);
+    }
+
+    output.resize(produced);
+
+    return (0 < produced);
+}
+
+std::string Base64::Encode(
+    const std::uint8_t* input,
+    const std::size_t size,
+    const std::size_t lineWidth)
+{
+    OT_ASSERT(0 == (lineWidth % 4));
+
+    std::string output{};
+
+    if (0 == size) { return output; }
+
+    const std::size_t encoded = ((size + 2) / 3) * 4;
+    const std::size_t breaks = (0 == lineWidth) ? 0 : (encoded / lineWidth);
+    const std::size_t line = (0 == lineWidth) ? size : ((lineWidth / 4) * 3);
+    output.resize(encoded + breaks);
+    char* out = output.data();
+    std::size_t position{0};
+
+    while (position < size) {
+        const std::size_t bytes = std::min(line, size - position);
+        const std::size_t whole = (bytes / 3) * 3;
+        const std::uint8_t* in = input + position;
+        const std::size_t fast =
+            encode_blocks(in, whole, size - position, out);
+        encode_scalar(in + fast, whole - fast, out + ((fast / 3) * 4));
+        out += (whole / 3) * 4;
+
+        if (whole < bytes) {
+            encode_tail(in + whole, bytes - whole, out);
+            out += 4;
+        }
+
+        // The last line may end in padding, and still be a full line
+        if ((0 < lineWidth) && (lineWidth == (((bytes + 2) / 3) * 4))) {
+            *out++ = '\n';
+        }
+
+        position += bytes;
+    }
+
+    OT_ASSERT(out == (output.data() + output.size()));
+
+    return output;
+}
+
+void Base64::encode_scalar(
+    const std::uint8_t* input,
+    const std::size_t size,
+    char* output)
+{
+    for (std::size_t i = 0; i < size; i += 3) {
+        const std::uint32_t group = (std::uint32_t(input[i]) << 16) |
+                                    (std::uint32_t(input[i + 1]) << 8) |
+                                    std::uint32_t(input[i + 2]);
+        *output++ = alphabet_[(group >> 18) & 0x3f];
+        *output++ = alphabet_[(group >> 12) & 0x3f];
+        *output++ = alphabet_[(group >> 6) & 0x3f];
+        *output++ = alphabet_[group & 0x3f];
+    }
+}
+
+void Base64::encode_tail(
+    const std::uint8_t* input,
+    const std::size_t size,
+    char* output)
+{
+    OT_ASSERT((0 < size) && (3 > size));
+
+    std::uint32_t group = std::uint32_t(input[0]) << 16;
+
+    if (2 == size) { group |= std::uint32_t(input[1]) << 8; }
+
+    output[0] = alphabet_[(group >> 18) & 0x3f];
+    output[1] = alphabet_[(group >> 12) & 0x3f];
+    output[2] = (2 == size) ? alphabet_[(group >> 6) & 0x3f] : '=';
+    output[3] = '=';
+}
+
+std::string Base64::Sanitize(const std::string& input)
+{
+    const auto& table = decode_table().value_;
+    std::string output{};
+    output.reserve(input.size());
+
+    for (const auto& character : input) {
+        if (OT_BASE64_INVALID != table[static_cast<std::uint8_t>(character)]) {
+            output.push_back(character);
+        }
+    }
+
+    return output;
+}
+}  // namespace opentxs::api::crypto::implementation
@@ -0,0 +1,87 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_API_CRYPTO_IMPLEMENTATION_BASE64_HPP
+#define OPENTXS_API_CRYPTO_IMPLEMENTATION_BASE64_HPP
+
+#include "opentxs/Types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace opentxs::api::crypto::implementation
+{
+/** Base64 codec used by Encode.
+ *
+ *  Encoding inserts a newline after every lineWidth output characters, and
+ *  decoding skips every character outside the base64 alphabet, so armored
+ *  text is handled in a single pass over the input. The bulk of each line is
+ *  processed with SSSE3 or AVX2 when the CPU supports it, with a scalar
+ *  fallback for everything else. */
+class Base64
+{
+public:
+    static std::string Encode(
+        const std::uint8_t* input,
+        const std::size_t size,
+        const std::size_t lineWidth);
+    /** Decodes up to the first '=' (or the end of the input.) Returns false if
+     *  nothing was decoded. */
+    static bool Decode(
+        const char* input,
+        const std::size_t size,
+        RawData& output);
+    /** Removes every character outside the base64 alphabet. */
+    static std::string Sanitize(const std::string& input);
+
+private:
+    static void encode_scalar(
+        const std::uint8_t* input,
+        const std::size_t size,
+        char* output);
+    static void encode_tail(
+        const std::uint8_t* input,
+        const std::size_t size,
+        char* output);
+
+    Base64() = delete;
+};
+}  // namespace opentxs::api::crypto::implementation
+#endif  // OPENTXS_API_CRYPTO_IMPLEMENTATION_BASE64_HPP
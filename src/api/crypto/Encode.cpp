@@ -45,11 +45,9 @@
 #endif
 #include "opentxs/core/Data.hpp"
 
-#include "base64/base64.h"
-
-#include <iostream>
-#include <regex>
+#include <array>
 
+#include "Base64.hpp"
 #include "Encode.hpp"
 
 namespace opentxs::api::crypto::implementation
@@ -64,52 +62,7 @@ std::string Encode::Base64Encode(
     const std::uint8_t* inputStart,
     const std::size_t& size) const
 {
-    std::string output;
-    output.resize(::Base64encode_len(size));
-    ::Base64encode(
-        const_cast<char*>(output.data()),
-        reinterpret_cast<const char*>(inputStart),
-        size);
-
-    return BreakLines(output);
-}
-
-bool Encode::Base64Decode(const std::string&& input, RawData& output) const
-{
-    output.resize(::Base64decode_len(input.data()), 0x0);
-
-    const size_t decoded =
-        ::Base64decode(reinterpret_cast<char*>(output.data()), input.data());
-
-    if (0 == decoded) { return false; }
-
-    OT_ASSERT(decoded <= output.size());
-
-    output.resize(decoded);
-
-    return true;
-}
-
-std::string Encode::BreakLines(const std::string& input) const
-{
-    std::string output;
-
-    if (0 == input.size()) { return output; }
-
-    std::size_t width = 0;
-
-    for (auto& character : input) {
-        output.push_back(character);
-
-        if (++width >= LineWidth) {
-            output.push_back('\n');
-            width = 0;
-        }
-    }
-
-    if ('\n' != output.back()) { output.push_back('\n'); }
-
-    return output;
+    return Base64::Encode(inputStart, size, LineWidth);
 }
 
 std::string Encode::DataEncode(const std::string& input) const
@@ -128,7 +81,7 @@ std::string Encode::DataDecode(const std::string& input) const
 {
     RawData decoded;
 
-    if (Base64Decode(SanatizeBase64(input), decoded)) {
+    if (Base64::Decode(input.data(), input.size(), decoded)) {
 
         return std::string(
             reinterpret_cast<const char*>(decoded.data()), decoded.size());
@@ -198,11 +151,31 @@ std::string Encode::RandomFilename() const { return Nonce(16).Get(); }
 
 std::string Encode::SanatizeBase58(const std::string& input) const
 {
-    return std::regex_replace(input, std::regex("[^1-9A-HJ-NP-Za-km-z]"), "");
+    static const auto allowed = []() {
+        const std::string alphabet{
+            "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz"};
+        std::array<bool, 256> output{};
+
+        for (const auto& character : alphabet) {
+            output[static_cast<std::uint8_t>(character)] = true;
+        }
+
+        return output;
+    }();
+    std::string output{};
+    output.reserve(input.size());
+
+    for (const auto& character : input) {
+        if (allowed[static_cast<std::uint8_t>(character)]) {
+            output.push_back(character);
+        }
+    }
+
+    return output;
 }
 
 std::string Encode::SanatizeBase64(const std::string& input) const
 {
-    return std::regex_replace(input, std::regex("[^0-9A-Za-z+/=]"), "");
+    return Base64::Sanitize(input);
 }
 }  // namespace opentxs::api::crypto::implementation
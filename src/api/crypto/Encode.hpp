@@ -79,8 +79,6 @@ private:
     std::string Base64Encode(
         const std::uint8_t* inputStart,
         const std::size_t& inputSize) const;
-    bool Base64Decode(const std::string&& input, RawData& output) const;
-    std::string BreakLines(const std::string& input) const;
     std::string IdentifierEncode(const OTPassword& input) const;
 
     Encode() = delete;
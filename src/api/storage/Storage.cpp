@@ -539,6 +539,34 @@ bool Storage::Load(
     return bool(thread);
 }
 
+bool Storage::Load(
+    const std::string& nymId,
+    const std::string& threadId,
+    const std::string& itemId,
+    std::shared_ptr<proto::StorageThreadItem>& item) const
+{
+    const bool exists =
+        Root().Tree().NymNode().Nym(nymId).Threads().Exists(threadId);
+
+    if (!exists) { return false; }
+
+    item.reset(new proto::StorageThreadItem);
+
+    if (!item) { return false; }
+
+    const bool loaded = Root()
+                            .Tree()
+                            .NymNode()
+                            .Nym(nymId)
+                            .Threads()
+                            .Thread(threadId)
+                            .Item(itemId, *item);
+
+    if (false == loaded) { item.reset(); }
+
+    return loaded;
+}
+
 bool Storage::Load(
     const std::string& id,
     std::shared_ptr<proto::UnitDefinition>& contract,
@@ -201,6 +201,11 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const override;
+    bool Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::string& itemId,
+        std::shared_ptr<proto::StorageThreadItem>& item) const override;
     bool Load(
         const std::string& id,
         std::shared_ptr<proto::UnitDefinition>& contract,
@@ -55,8 +55,12 @@
 #include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/util/Tag.hpp"
 
+#include "core/util/Workers.hpp"
+
 #include <irrxml/irrXML.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <map>
@@ -64,6 +68,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -847,56 +852,52 @@ void Mint::GenerateNewMint(
         otErr << "Error creating cash reserve account for new mint.\n";
     }
 
-    if (nDenom1) {
-        AddDenomination(
-            theNotary,
-            nDenom1);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom2) {
-        AddDenomination(
-            theNotary,
-            nDenom2);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom3) {
-        AddDenomination(
-            theNotary,
-            nDenom3);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom4) {
-        AddDenomination(
-            theNotary,
-            nDenom4);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom5) {
-        AddDenomination(
-            theNotary,
-            nDenom5);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom6) {
-        AddDenomination(
-            theNotary,
-            nDenom6);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom7) {
-        AddDenomination(
-            theNotary,
-            nDenom7);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom8) {
-        AddDenomination(
-            theNotary,
-            nDenom8);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom9) {
-        AddDenomination(
-            theNotary,
-            nDenom9);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom10) {
-        AddDenomination(
-            theNotary,
-            nDenom10);  // std::int32_t nPrimeLength default = 1024
+    // Each denomination needs its own key pair, and generating the primes
+    // dominates the cost of a new mint, so the denominations are generated
+    // concurrently. std::int32_t nPrimeLength default = 1024
+    std::vector<std::int64_t> denominations{};
+
+    for (const auto& denomination :
+         {nDenom1,
+          nDenom2,
+          nDenom3,
+          nDenom4,
+          nDenom5,
+          nDenom6,
+          nDenom7,
+          nDenom8,
+          nDenom9,
+          nDenom10}) {
+        const bool duplicate =
+            denominations.end() !=
+            std::find(denominations.begin(), denominations.end(), denomination);
+
+        if ((0 != denomination) && (false == duplicate)) {
+            denominations.push_back(denomination);
+        }
     }
+
+    const auto total = denominations.size();
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> finished{0};
+    auto generate = [&]() -> void {
+        for (auto i = next++; i < total; i = next++) {
+            const auto& denomination = denominations[i];
+            const bool added = AddDenomination(theNotary, denomination);
+            const auto done = ++finished;
+
+            if (added) {
+                otWarn << "Mint::GenerateNewMint: Generated denomination "
+                       << denomination << " (" << done << " of " << total
+                       << ") for series " << nSeries << ".\n";
+            } else {
+                otErr << "Mint::GenerateNewMint: Failed to generate "
+                         "denomination "
+                      << denomination << " for series " << nSeries << ".\n";
+            }
+        }
+    };
+    RunWorkers(std::min(total, WorkerThreads()), generate);
 }
 
 }  // namespace opentxs
@@ -94,6 +94,10 @@ MintLucre::~MintLucre() {}
 
 // The mint has a different key pair for each denomination.
 // Pass the actual denomination such as 5, 10, 20, 50, 100...
+//
+// Safe to call concurrently for different denominations: the key pair is
+// generated and sealed without holding m_lockDenominations, which only
+// protects the denomination maps.
 bool MintLucre::AddDenomination(
     const Nym& theNotary,
     std::int64_t lDenomination,
@@ -101,14 +105,15 @@ bool MintLucre::AddDenomination(
 {
     bool bReturnValue = false;
 
+    Lock lock(m_lockDenominations);
+
     // Let's make sure it doesn't already exist
-    OTASCIIArmor theArmor;
-    if (GetPublic(theArmor, lDenomination)) {
+    if (m_mapPublic.end() != m_mapPublic.find(lDenomination)) {
         otErr << "Error: Denomination public already exists in "
                  "OTMint::AddDenomination\n";
         return false;
     }
-    if (GetPrivate(theArmor, lDenomination)) {
+    if (m_mapPrivate.end() != m_mapPrivate.find(lDenomination)) {
         otErr << "Error: Denomination private already exists in "
                  "OTMint::AddDenomination\n";
         return false;
@@ -133,6 +138,8 @@ bool MintLucre::AddDenomination(
     SetMonitor(stderr);
 #endif
 
+    lock.unlock();
+
     OpenSSL_BIO bio = BIO_new(BIO_s_mem());
     OpenSSL_BIO bioPublic = BIO_new(BIO_s_mem());
 
@@ -180,6 +187,19 @@ bool MintLucre::AddDenomination(
                                                       // functions
         theEnvelope.GetCiphertext(*pPrivate);
 
+        lock.lock();
+
+        // Another thread may have added this denomination in the meantime.
+        if ((m_mapPublic.end() != m_mapPublic.find(lDenomination)) ||
+            (m_mapPrivate.end() != m_mapPrivate.find(lDenomination))) {
+            otErr << "Error: Denomination already exists in "
+                     "OTMint::AddDenomination\n";
+            delete pPublic;
+            delete pPrivate;
+
+            return false;
+        }
+
         // Add the new key pair to the maps, using denomination as the key
         m_mapPublic[lDenomination] = pPublic;
         m_mapPrivate[lDenomination] = pPrivate;
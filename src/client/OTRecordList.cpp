@@ -59,8 +59,10 @@
 #include "opentxs/core/contract/UnitDefinition.hpp"
 #include "opentxs/core/recurring/OTPaymentPlan.hpp"
 #include "opentxs/core/script/OTSmartContract.hpp"
+#include "opentxs/core/transaction/Helpers.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/Account.hpp"
 #include "opentxs/core/Cheque.hpp"
 #include "opentxs/core/Identifier.hpp"
@@ -68,6 +70,8 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/Nym.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/ext/Helpers.hpp"
 #include "opentxs/ext/OTPayment.hpp"
@@ -421,6 +425,7 @@ void OTRecordList::SetNotaryID(std::string str_id)
 
 void OTRecordList::AddNotaryID(std::string str_id)
 {
+    ClearCache();
     m_servers.insert(m_servers.end(), str_id);
 }
 
@@ -429,6 +434,7 @@ void OTRecordList::AddNotaryID(std::string str_id)
 void OTRecordList::ClearServers()
 {
     ClearContents();
+    ClearCache();
     m_servers.clear();
 }
 
@@ -470,6 +476,7 @@ void OTRecordList::AddInstrumentDefinitionID(std::string str_id)
         str_asset_name = SwigWrap::GetAssetType_Name(
             str_id);  // Otherwise we try to grab the name.
     // (Otherwise we just leave it blank. The ID is too big to cram in here.)
+    ClearCache();
     m_assets.insert(
         std::pair<std::string, std::string>(str_id, str_asset_name));
 }
@@ -477,6 +484,7 @@ void OTRecordList::AddInstrumentDefinitionID(std::string str_id)
 void OTRecordList::ClearAssets()
 {
     ClearContents();
+    ClearCache();
     m_assets.clear();
 }
 
@@ -488,12 +496,14 @@ void OTRecordList::SetNymID(std::string str_id)
 
 void OTRecordList::AddNymID(std::string str_id)
 {
+    ClearCache();
     m_nyms.insert(m_nyms.end(), str_id);
 }
 
 void OTRecordList::ClearNyms()
 {
     ClearContents();
+    ClearCache();
     m_nyms.clear();
 }
 
@@ -1928,12 +1938,14 @@ std::int32_t OTRecordList::acceptFromInbox(  // a static method
 
 void OTRecordList::AddAccountID(std::string str_id)
 {
+    ClearCache();
     m_accounts.insert(m_accounts.end(), str_id);
 }
 
 void OTRecordList::ClearAccounts()
 {
     ClearContents();
+    ClearCache();
     m_accounts.clear();
 }
 
@@ -3298,8 +3310,18 @@ bool OTRecordList::Populate()
             // will, however, work
             // either way.
             Ledger* pInbox{nullptr};
-
-            if (false == theNymID->empty()) {
+            const String strNymID(theNymID);
+            std::string paymentInboxKey{};
+            std::string paymentInboxDigest{};
+            const std::size_t paymentInboxFirst{m_contents.size()};
+            const bool paymentInboxCached = load_cached_box(
+                OTFolders::PaymentInbox(),
+                strMsgNotaryID.Get(),
+                strNymID.Get(),
+                paymentInboxKey,
+                paymentInboxDigest);
+
+            if ((false == paymentInboxCached) && (false == theNymID->empty())) {
                 pInbox = m_bRunFast
                              ? OT::App().API().OTAPI().LoadPaymentInboxNoVerify(
                                    theMsgNotaryID, theNymID)
@@ -3632,18 +3654,36 @@ bool OTRecordList::Populate()
                     m_contents.push_back(sp_Record);
 
                 }  // looping through inbox.
-            } else
+            } else if (false == paymentInboxCached)
                 otWarn << __FUNCTION__
                        << ": Failed loading payments inbox. "
                           "(Probably just doesn't exist yet.)\n";
+
+            if (false == paymentInboxCached) {
+                cache_box(
+                    paymentInboxKey,
+                    paymentInboxDigest,
+                    pInbox,
+                    paymentInboxFirst);
+            }
+
             nIndex = (-1);
 
             // Also loop through its record box. For this record box, pass the
             // NYM_ID twice, since it's the recordbox for the Nym.
             // OPTIMIZE FYI: m_bRunFast impacts run speed here.
             Ledger* pRecordbox{nullptr};
-
-            if (false == theNymID->empty()) {
+            std::string recordBoxKey{};
+            std::string recordBoxDigest{};
+            const std::size_t recordBoxFirst{m_contents.size()};
+            const bool recordBoxCached = load_cached_box(
+                OTFolders::RecordBox(),
+                strMsgNotaryID.Get(),
+                strNymID.Get(),
+                recordBoxKey,
+                recordBoxDigest);
+
+            if ((false == recordBoxCached) && (false == theNymID->empty())) {
                 pRecordbox =
                     m_bRunFast
                         ? OT::App().API().OTAPI().LoadRecordBoxNoVerify(
@@ -4255,20 +4295,34 @@ bool OTRecordList::Populate()
                     m_contents.push_back(sp_Record);
 
                 }  // Loop through Recordbox
-            } else
+            } else if (false == recordBoxCached)
                 otWarn << __FUNCTION__
                        << ": Failed loading payments record "
                           "box. (Probably just doesn't exist "
                           "yet.)\n";
 
+            if (false == recordBoxCached) {
+                cache_box(
+                    recordBoxKey, recordBoxDigest, pRecordbox, recordBoxFirst);
+            }
+
             // EXPIRED RECORDS:
             nIndex = (-1);
 
             // Also loop through its expired record box.
             // OPTIMIZE FYI: m_bRunFast impacts run speed here.
             Ledger* pExpiredbox{nullptr};
-
-            if (false == theNymID->empty()) {
+            std::string expiredBoxKey{};
+            std::string expiredBoxDigest{};
+            const std::size_t expiredBoxFirst{m_contents.size()};
+            const bool expiredBoxCached = load_cached_box(
+                OTFolders::ExpiredBox(),
+                strMsgNotaryID.Get(),
+                strNymID.Get(),
+                expiredBoxKey,
+                expiredBoxDigest);
+
+            if ((false == expiredBoxCached) && (false == theNymID->empty())) {
                 pExpiredbox =
                     m_bRunFast ? OT::App().API().OTAPI().LoadExpiredBoxNoVerify(
                                      theMsgNotaryID, theNymID)
@@ -4837,11 +4891,19 @@ bool OTRecordList::Populate()
                     m_contents.push_back(sp_Record);
 
                 }  // Loop through ExpiredBox
-            } else
+            } else if (false == expiredBoxCached)
                 otWarn << __FUNCTION__
                        << ": Failed loading expired payments box. "
                           "(Probably just doesn't exist yet.)\n";
 
+            if (false == expiredBoxCached) {
+                cache_box(
+                    expiredBoxKey,
+                    expiredBoxDigest,
+                    pExpiredbox,
+                    expiredBoxFirst);
+            }
+
         }  // Loop through servers for each Nym.
     }      // Loop through Nyms.
            // ASSET ACCOUNT -- INBOX/OUTBOX + RECORD BOX
@@ -4928,8 +4990,17 @@ bool OTRecordList::Populate()
         // Populating.
         //
         Ledger* pInbox{nullptr};
-
-        if (false == theNymID.empty()) {
+        std::string inboxKey{};
+        std::string inboxDigest{};
+        const std::size_t inboxFirst{m_contents.size()};
+        const bool inboxCached = load_cached_box(
+            OTFolders::Inbox(),
+            str_notary_id,
+            str_account_id,
+            inboxKey,
+            inboxDigest);
+
+        if ((false == inboxCached) && (false == theNymID.empty())) {
             pInbox = m_bRunFast ? OT::App().API().OTAPI().LoadInboxNoVerify(
                                       theNotaryID, theNymID, theAccountID)
                                 : OT::App().API().OTAPI().LoadInbox(
@@ -5216,6 +5287,11 @@ bool OTRecordList::Populate()
                 m_contents.push_back(sp_Record);
             }
         }
+
+        if (false == inboxCached) {
+            cache_box(inboxKey, inboxDigest, pInbox, inboxFirst);
+        }
+
         // OPTIMIZE FYI:
         // NOTE: LoadOutbox is much SLOWER than LoadOutboxNoVerify, but it also
         // lets you get the NAME off of the box receipt. So if you are willing
@@ -5223,8 +5299,17 @@ bool OTRecordList::Populate()
         // SetFastMode() before running Populate.
         //
         Ledger* pOutbox{nullptr};
-
-        if (false == theNymID.empty()) {
+        std::string outboxKey{};
+        std::string outboxDigest{};
+        const std::size_t outboxFirst{m_contents.size()};
+        const bool outboxCached = load_cached_box(
+            OTFolders::Outbox(),
+            str_notary_id,
+            str_account_id,
+            outboxKey,
+            outboxDigest);
+
+        if ((false == outboxCached) && (false == theNymID.empty())) {
             pOutbox = m_bRunFast ? OT::App().API().OTAPI().LoadOutboxNoVerify(
                                        theNotaryID, theNymID, theAccountID)
                                  : OT::App().API().OTAPI().LoadOutbox(
@@ -5411,6 +5496,11 @@ bool OTRecordList::Populate()
                 m_contents.push_back(sp_Record);
             }
         }
+
+        if (false == outboxCached) {
+            cache_box(outboxKey, outboxDigest, pOutbox, outboxFirst);
+        }
+
         // ---------------------------------------------------
         // For this record box, pass a NymID AND an AcctID,
         // since it's the recordbox for a SPECIFIC ACCOUNT.
@@ -5422,8 +5512,17 @@ bool OTRecordList::Populate()
         // call SetFastMode() before Populating.
         //
         Ledger* pRecordbox{nullptr};
-
-        if (false == theNymID.empty()) {
+        std::string recordBoxKey{};
+        std::string recordBoxDigest{};
+        const std::size_t recordBoxFirst{m_contents.size()};
+        const bool recordBoxCached = load_cached_box(
+            OTFolders::RecordBox(),
+            str_notary_id,
+            str_account_id,
+            recordBoxKey,
+            recordBoxDigest);
+
+        if ((false == recordBoxCached) && (false == theNymID.empty())) {
             pRecordbox = m_bRunFast
                              ? OT::App().API().OTAPI().LoadRecordBoxNoVerify(
                                    theNotaryID, theNymID, theAccountID)
@@ -5930,6 +6029,10 @@ bool OTRecordList::Populate()
             }
         }
 
+        if (false == recordBoxCached) {
+            cache_box(
+                recordBoxKey, recordBoxDigest, pRecordbox, recordBoxFirst);
+        }
     }  // loop through the accounts.
     // SORT the vector.
     //
@@ -6128,6 +6231,120 @@ OTRecordList::~OTRecordList()
 
 void OTRecordList::ClearContents() { m_contents.clear(); }
 
+void OTRecordList::ClearCache() { m_cache.clear(); }
+
+// In full mode, an abbreviated receipt means its box receipt was missing. The
+// box receipt may be downloaded later (resolving a name) without the box
+// itself changing, so these receipts are remembered and checked on reuse.
+void OTRecordList::cache_box(
+    const std::string& key,
+    const std::string& digest,
+    const Ledger* box,
+    const std::size_t first)
+{
+    if (digest.empty() || (nullptr == box)) {
+        m_cache.erase(key);
+
+        return;
+    }
+
+    std::vector<MissingReceipt> missing{};
+
+    for (const auto& it : box->GetTransactionMap()) {
+        const auto* transaction = it.second;
+
+        if (nullptr == transaction) {
+            m_cache.erase(key);
+
+            return;
+        }
+
+        if (m_bRunFast || (false == transaction->IsAbbreviated())) {
+            continue;
+        }
+
+        missing.emplace_back(
+            transaction->GetRealNotaryID().str(),
+            transaction->GetNymID().str(),
+            transaction->GetRealAccountID().str(),
+            static_cast<std::int32_t>(box->GetType()),
+            transaction->GetTransactionNum());
+    }
+
+    auto& entry = m_cache[key];
+    entry.digest_ = digest;
+    entry.fast_ = m_bRunFast;
+    entry.missing_.swap(missing);
+    entry.records_.assign(m_contents.begin() + first, m_contents.end());
+}
+
+// Hashes the raw box file and, if the records cached for that box were built
+// from identical contents, appends them to m_contents instead of reloading
+// and verifying the ledger.
+bool OTRecordList::load_cached_box(
+    const String& folder,
+    const std::string& notaryID,
+    const std::string& ownerID,
+    std::string& key,
+    std::string& digest)
+{
+    key = std::string(folder.Get()) + "/" + notaryID + "/" + ownerID;
+    digest.clear();
+
+    if (notaryID.empty() || ownerID.empty()) {
+
+        return false;
+    }
+
+    if (false == OTDB::Exists(folder.Get(), notaryID, ownerID)) {
+        m_cache.erase(key);
+
+        return false;
+    }
+
+    const auto raw = OTDB::QueryPlainString(folder.Get(), notaryID, ownerID);
+
+    if (raw.empty()) {
+
+        return false;
+    }
+
+    auto id = Identifier::Factory();
+
+    if (false == id->CalculateDigest(String(raw.c_str()))) {
+
+        return false;
+    }
+
+    digest = id->str();
+    const auto it = m_cache.find(key);
+
+    if ((m_cache.end() == it) || (it->second.digest_ != digest) ||
+        (it->second.fast_ != m_bRunFast)) {
+
+        return false;
+    }
+
+    for (const auto& [notary, nym, account, type, number] :
+         it->second.missing_) {
+        const bool downloaded = VerifyBoxReceiptExists(
+            Identifier::Factory(notary),
+            Identifier::Factory(nym),
+            Identifier::Factory(account),
+            type,
+            number);
+
+        if (downloaded) { return false; }
+    }
+
+    const auto& records = it->second.records_;
+    m_contents.insert(m_contents.end(), records.begin(), records.end());
+    otInfo << __FUNCTION__ << ": Reusing " << records.size()
+           << " cached records for unchanged box " << key << "\n";
+
+    return true;
+}
+
 // RETRIEVE:
 //
 
@@ -6150,4 +6367,25 @@ OTRecord OTRecordList::GetRecord(std::int32_t nIndex)
     return *(m_contents[nIndex]);
 }
 
+std::vector<OTRecord> OTRecordList::GetRecords(
+    std::int32_t nStart,
+    std::int32_t nCount) const
+{
+    std::vector<OTRecord> output{};
+    const auto total = static_cast<std::int32_t>(m_contents.size());
+
+    if ((0 > nStart) || (0 >= nCount) || (nStart >= total)) {
+
+        return output;
+    }
+
+    const auto count = (nCount > total - nStart) ? total - nStart : nCount;
+    const auto end = nStart + count;
+    output.reserve(count);
+
+    for (auto i = nStart; i < end; ++i) { output.push_back(*m_contents[i]); }
+
+    return output;
+}
+
 }  // namespace opentxs
@@ -190,10 +190,10 @@ bool ClientContext::Verify(
 {
     Lock lock(lock_);
 
-    std::set<TransactionNumber> effective = issued_transaction_numbers_;
+    auto effective = issued_transaction_numbers_;
 
     for (const auto& number : included) {
-        const bool inserted = effective.insert(number).second;
+        const bool inserted = effective.insert(number);
 
         if (!inserted) {
             otOut << OT_METHOD << __FUNCTION__ << ": New transaction # "
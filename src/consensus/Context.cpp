@@ -115,7 +115,7 @@ std::set<RequestNumber> Context::AcknowledgedNumbers() const
 {
     Lock lock(lock_);
 
-    return acknowledged_request_numbers_;
+    return acknowledged_request_numbers_.Copy();
 }
 
 bool Context::add_acknowledged_number(const Lock& lock, const RequestNumber req)
@@ -126,10 +126,10 @@ bool Context::add_acknowledged_number(const Lock& lock, const RequestNumber req)
 
     while (OT_MAX_ACK_NUMS < acknowledged_request_numbers_.size()) {
         acknowledged_request_numbers_.erase(
-            acknowledged_request_numbers_.begin());
+            acknowledged_request_numbers_.front());
     }
 
-    return output.second;
+    return output;
 }
 
 bool Context::AddAcknowledgedNumber(const RequestNumber req)
@@ -166,6 +166,22 @@ bool Context::ConsumeIssued(const TransactionNumber& number)
     return 1 == issued_transaction_numbers_.erase(number);
 }
 
+bool Context::close_editor(const Lock& lock)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto it = editors_.find(std::this_thread::get_id());
+
+    OT_ASSERT(editors_.end() != it);
+    OT_ASSERT(0 < it->second);
+
+    if (0 < --it->second) { return false; }
+
+    editors_.erase(it);
+
+    return true;
+}
+
 proto::Context Context::contract(const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
@@ -275,14 +291,14 @@ bool Context::insert_available_number(const TransactionNumber& number)
 {
     Lock lock(lock_);
 
-    return available_transaction_numbers_.insert(number).second;
+    return available_transaction_numbers_.insert(number);
 }
 
 bool Context::insert_issued_number(const TransactionNumber& number)
 {
     Lock lock(lock_);
 
-    return issued_transaction_numbers_.insert(number).second;
+    return issued_transaction_numbers_.insert(number);
 }
 
 bool Context::issue_number(const Lock& lock, const TransactionNumber& number)
@@ -329,6 +345,17 @@ std::string Context::Name() const
     return String(id(lock)).Get();
 }
 
+bool Context::needs_signature(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (1 != signatures_.size()) { return true; }
+
+    if (version_ < target_version_) { return true; }
+
+    return (proto::ProtoAsString(SigVersion(lock)) != signed_);
+}
+
 bool Context::NymboxHashMatch() const
 {
     Lock lock(lock_);
@@ -363,7 +390,13 @@ bool Context::RecoverAvailableNumber(const TransactionNumber& number)
 
     if (!issued) { return false; }
 
-    return available_transaction_numbers_.insert(number).second;
+    return available_transaction_numbers_.insert(number);
+}
+
+void Context::open_editor()
+{
+    Lock lock(lock_);
+    ++editors_[std::this_thread::get_id()];
 }
 
 const class Nym& Context::RemoteNym() const
@@ -445,6 +478,12 @@ proto::Context Context::serialize(
     output.set_localnymboxhash(String(local_nymbox_hash_).Get());
     output.set_remotenymboxhash(String(remote_nymbox_hash_).Get());
     output.set_requestnumber(request_number_.load());
+    output.mutable_acknowledgedrequestnumber()->Reserve(
+        acknowledged_request_numbers_.size());
+    output.mutable_availabletransactionnumber()->Reserve(
+        available_transaction_numbers_.size());
+    output.mutable_issuedtransactionnumber()->Reserve(
+        issued_transaction_numbers_.size());
 
     for (const auto& it : acknowledged_request_numbers_) {
         output.add_acknowledgedrequestnumber(it);
@@ -513,7 +552,9 @@ bool Context::update_signature(const Lock& lock)
 
     bool success = false;
     signatures_.clear();
+    signed_.clear();
     auto serialized = SigVersion(lock);
+    auto plaintext = proto::ProtoAsString(serialized);
     auto& signature = *serialized.mutable_signature();
     signature.set_version(SIGNATURE_VERSION);
     signature.set_role(proto::SIGROLE_CONTEXT);
@@ -521,6 +562,7 @@ bool Context::update_signature(const Lock& lock)
 
     if (success) {
         signatures_.emplace_front(new proto::Signature(signature));
+        signed_.swap(plaintext);
     } else {
         otErr << OT_METHOD << __FUNCTION__ << ": failed to create signature."
               << std::endl;
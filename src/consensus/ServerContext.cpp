@@ -328,7 +328,7 @@ std::pair<RequestNumber, std::unique_ptr<Message>> ServerContext::
     message->m_strRequestNum = std::to_string(requestNumber).c_str();
 
     if (withAcknowledgments) {
-        message->SetAcknowledgments(acknowledged_request_numbers_);
+        message->SetAcknowledgments(acknowledged_request_numbers_.Copy());
     }
 
     if (withNymboxHash) {
@@ -420,9 +420,8 @@ ServerContext::ManagedNumber ServerContext::NextTransactionNumber(
         return ManagedNumber(0, *this);
     }
 
-    auto first = available_transaction_numbers_.begin();
-    const auto output = *first;
-    available_transaction_numbers_.erase(first);
+    const auto output = available_transaction_numbers_.front();
+    available_transaction_numbers_.erase(output);
 
     return ManagedNumber(output, *this);
 }
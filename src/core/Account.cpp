@@ -164,11 +164,14 @@ char const* Account::_GetTypeString(AccountType accountType)
 }
 
 // Caller responsible to delete.
-Ledger* Account::LoadInbox(const Nym& nym) const
+Ledger* Account::LoadInbox(const Nym& nym, const std::size_t receiptBudget)
+    const
 {
     auto* box = new Ledger(GetNymID(), GetRealAccountID(), GetRealNotaryID());
     OT_ASSERT(box != nullptr);
 
+    box->SetLazyReceipts(receiptBudget);
+
     if (box->LoadInbox() && box->VerifyAccount(nym)) { return box; }
 
     String strNymID(GetNymID()), strAcctID(GetRealAccountID());
@@ -179,11 +182,14 @@ Ledger* Account::LoadInbox(const Nym& nym) const
 }
 
 // Caller responsible to delete.
-Ledger* Account::LoadOutbox(const Nym& nym) const
+Ledger* Account::LoadOutbox(const Nym& nym, const std::size_t receiptBudget)
+    const
 {
     auto* box = new Ledger(GetNymID(), GetRealAccountID(), GetRealNotaryID());
     OT_ASSERT(nullptr != box);
 
+    box->SetLazyReceipts(receiptBudget);
+
     if (box->LoadOutbox() && box->VerifyAccount(nym)) { return box; }
 
     String strNymID(GetNymID()), strAcctID(GetRealAccountID());
@@ -425,6 +425,7 @@ bool Contract::SignContract(
     OTSignature& theSignature,
     const OTPasswordData* pPWData)
 {
+    Lock lock(theNym.signing_lock_);
     const auto& key = theNym.GetPrivateSignKey();
     m_strSigHashType = key.SigHashType();
 
@@ -437,6 +438,7 @@ bool Contract::SignContractAuthent(
     OTSignature& theSignature,
     const OTPasswordData* pPWData)
 {
+    Lock lock(theNym.signing_lock_);
     const auto& key = theNym.GetPrivateAuthKey();
     m_strSigHashType = key.SigHashType();
 
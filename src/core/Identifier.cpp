@@ -55,6 +55,10 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/OT.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
 template class opentxs::Pimpl<opentxs::Identifier>;
 template class std::set<opentxs::OTIdentifier>;
 template class std::map<opentxs::OTIdentifier, std::set<opentxs::OTIdentifier>>;
@@ -171,6 +175,8 @@ Identifier::Identifier(const Identifier& theID)
     : opentxs::Data()
     , ot_super(theID)
     , type_(theID.Type())
+    , encoded_lock_()
+    , encoded_(theID.encoded())
 {
 }
 
@@ -231,57 +237,77 @@ Identifier::Identifier(
 
 Identifier& Identifier::operator=(const Identifier& rhs)
 {
+    if (this == &rhs) { return *this; }
+
     Assign(rhs);
     type_ = rhs.type_;
+    auto cached = rhs.encoded();
+    Lock lock(encoded_lock_);
+    encoded_ = cached;
 
     return *this;
 }
 
 Identifier& Identifier::operator=(Identifier&& rhs)
 {
-    swap(rhs);
+    swap(std::move(rhs));
+
+    return *this;
+}
+
+Identifier& Identifier::operator+=(const opentxs::Data& rhs)
+{
+    reset_encoded();
+    ot_super::operator+=(rhs);
 
     return *this;
 }
 
 bool Identifier::operator==(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.Compare(ots2);
+    return 0 == compare(s2);
 }
 
 bool Identifier::operator!=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return !(ots1.Compare(ots2));
+    return 0 != compare(s2);
 }
 
 bool Identifier::operator>(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>(ots2);
+    return 0 < compare(s2);
 }
 
 bool Identifier::operator<(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<(ots2);
+    return 0 > compare(s2);
 }
 
 bool Identifier::operator<=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<=(ots2);
+    return 0 >= compare(s2);
 }
 
 bool Identifier::operator>=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>=(ots2);
+    return 0 <= compare(s2);
+}
+
+void Identifier::Assign(const opentxs::Data& source)
+{
+    reset_encoded();
+    ot_super::Assign(source);
+}
+
+void Identifier::Assign(const void* data, const std::size_t& size)
+{
+    reset_encoded();
+    ot_super::Assign(data, size);
 }
 
 bool Identifier::CalculateDigest(const String& strInput, const ID type)
 {
+    reset_encoded();
     type_ = type;
 
     return OT::App().Crypto().Hash().Digest(
@@ -290,6 +316,7 @@ bool Identifier::CalculateDigest(const String& strInput, const ID type)
 
 bool Identifier::CalculateDigest(const opentxs::Data& dataInput, const ID type)
 {
+    reset_encoded();
     type_ = type;
 
     return OT::App().Crypto().Hash().Digest(
@@ -298,6 +325,75 @@ bool Identifier::CalculateDigest(const opentxs::Data& dataInput, const ID type)
 
 Identifier* Identifier::clone() const { return new Identifier(*this); }
 
+// Orders identifiers by their type byte followed by the digest, which is the
+// same as comparing the binary form that str() encodes. Empty identifiers
+// encode to an empty string regardless of type, so they are all equal and
+// sort first.
+int Identifier::compare(const Identifier& rhs) const
+{
+    const auto lhsSize = GetSize();
+    const auto rhsSize = rhs.GetSize();
+
+    if ((0 == lhsSize) || (0 == rhsSize)) {
+
+        return static_cast<int>(0 < lhsSize) - static_cast<int>(0 < rhsSize);
+    }
+
+    if (type_ != rhs.type_) { return (type_ < rhs.type_) ? -1 : 1; }
+
+    const auto result = std::memcmp(
+        GetPointer(), rhs.GetPointer(), std::min(lhsSize, rhsSize));
+
+    if (0 != result) { return result; }
+
+    if (lhsSize == rhsSize) { return 0; }
+
+    return (lhsSize < rhsSize) ? -1 : 1;
+}
+
+void Identifier::Concatenate(const void* data, const std::size_t& size)
+{
+    reset_encoded();
+    ot_super::Concatenate(data, size);
+}
+
+std::shared_ptr<const std::string> Identifier::encoded() const
+{
+    Lock lock(encoded_lock_);
+
+    return encoded_;
+}
+
+std::size_t Identifier::Hash() const
+{
+    if (0 == GetSize()) { return 0; }
+
+    const std::string_view digest(
+        static_cast<const char*>(GetPointer()), GetSize());
+
+    return std::hash<std::string_view>()(digest) ^
+           static_cast<std::size_t>(type_);
+}
+
+bool Identifier::Randomize(const std::size_t& size)
+{
+    reset_encoded();
+
+    return ot_super::Randomize(size);
+}
+
+void Identifier::Release()
+{
+    reset_encoded();
+    ot_super::Release();
+}
+
+void Identifier::reset_encoded()
+{
+    Lock lock(encoded_lock_);
+    encoded_.reset();
+}
+
 // SET (binary id) FROM ENCODED STRING
 void Identifier::SetString(const String& encoded)
 {
@@ -306,6 +402,7 @@ void Identifier::SetString(const String& encoded)
 
 void Identifier::SetString(const std::string& encoded)
 {
+    reset_encoded();
     empty();
 
     if (MinimumSize > encoded.size()) { return; }
@@ -344,35 +441,39 @@ void Identifier::SetString(const std::string& encoded)
 // Just call this function.
 void Identifier::GetString(String& id) const
 {
-    auto data = Data::Factory();
-    data->Assign(&type_, sizeof(type_));
-
-    OT_ASSERT(1 == data->GetSize());
-
     if (0 == GetSize()) { return; }
 
-    data->Concatenate(GetPointer(), GetSize());
-
-    String output("ot");
-    output.Concatenate(
-        String(OT::App().Crypto().Encode().IdentifierEncode(data).c_str()));
+    String output(str());
     id.swap(output);
 }
 
+void Identifier::SetSize(const std::size_t& size)
+{
+    reset_encoded();
+    ot_super::SetSize(size);
+}
+
 std::string Identifier::str() const
 {
+    if (0 == GetSize()) { return {}; }
+
+    auto cached = encoded();
+
+    if (cached) { return *cached; }
+
     auto data = Data::Factory();
     data->Assign(&type_, sizeof(type_));
 
     OT_ASSERT(1 == data->GetSize());
 
-    if (0 == GetSize()) { return {}; }
-
     data->Concatenate(GetPointer(), GetSize());
 
-    std::string output("ot");
-    output.append(OT::App().Crypto().Encode().IdentifierEncode(data).c_str());
-    return output;
+    auto output = std::make_shared<std::string>("ot");
+    output->append(OT::App().Crypto().Encode().IdentifierEncode(data).c_str());
+    Lock lock(encoded_lock_);
+    encoded_ = output;
+
+    return *output;
 }
 
 OTData Identifier::path_to_data(
@@ -389,10 +490,32 @@ OTData Identifier::path_to_data(
     return output;
 }
 
+void Identifier::swap(opentxs::Data&& rhs)
+{
+    auto* id = dynamic_cast<Identifier*>(&rhs);
+
+    if (nullptr != id) {
+        swap(std::move(*id));
+    } else {
+        reset_encoded();
+        ot_super::swap(std::move(rhs));
+    }
+}
+
 void Identifier::swap(Identifier&& rhs)
 {
+    auto cached = rhs.encoded();
+    rhs.reset_encoded();
     ot_super::swap(rhs);
     type_ = rhs.type_;
     rhs.type_ = ID::ERROR;
+    Lock lock(encoded_lock_);
+    encoded_ = cached;
+}
+
+void Identifier::zeroMemory()
+{
+    reset_encoded();
+    ot_super::zeroMemory();
 }
 }  // namespace opentxs
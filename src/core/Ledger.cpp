@@ -63,15 +63,26 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/Types.hpp"
 
+#include "core/util/Workers.hpp"
+
 #include <stdlib.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <irrxml/irrXML.hpp>
+#include <list>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
+
+// Minimum number of abbreviated receipts assigned to each verification thread
+// in LoadBoxReceipts. Smaller boxes are handled on the calling thread alone.
+#define OT_BOX_RECEIPTS_PER_LOADER_THREAD 16
 
 namespace opentxs
 {
@@ -125,6 +136,9 @@ bool Ledger::VerifyAccount(const Nym& theNym)
         case Ledger::paymentInbox:
         case Ledger::recordBox:
         case Ledger::expiredBox: {
+            // In lazy mode the box receipts are loaded on demand instead.
+            if (LazyReceipts()) { break; }
+
             std::set<std::int64_t> setUnloaded;
             // if psetUnloaded passed in, then use it to return the #s that
             // weren't there as box receipts.
@@ -224,67 +238,96 @@ bool Ledger::DeleteBoxReceipt(const std::int64_t& lTransactionNum)
 // then add that transaction# to the set. (psetUnloaded)
 
 // if psetUnloaded passed in, then use it to return the #s that weren't there.
+//
+// The receipts are loaded in three passes: every box receipt is read from
+// local storage on the calling thread, the parsing and hash verification are
+// then spread over a pool of worker threads, and finally the verified
+// receipts are swapped into m_mapTransactions on the calling thread.
 bool Ledger::LoadBoxReceipts(std::set<std::int64_t>* psetUnloaded)
 {
-    // Grab a copy of all the transaction #s stored inside this ledger.
-    //
-    std::set<std::int64_t> the_set;
+    const std::int64_t lLedgerType = static_cast<std::int64_t>(GetType());
+    std::vector<OTTransaction*> abbreviated{};
+    std::vector<String> raw{};
 
     for (auto& it : m_mapTransactions) {
         OTTransaction* pTransaction = it.second;
         OT_ASSERT(nullptr != pTransaction);
-        the_set.insert(pTransaction->GetTransactionNum());
+
+        if (pTransaction->IsAbbreviated()) {
+            abbreviated.push_back(pTransaction);
+        }
     }
 
-    // Now iterate through those numbers and for each, load the box receipt.
-    //
+    raw.resize(abbreviated.size());
+
+    for (std::size_t i = 0; i < abbreviated.size(); ++i) {
+        if (false == ReadBoxReceipt(*abbreviated[i], lLedgerType, raw[i])) {
+            raw[i].Release();
+
+            // Without psetUnloaded there is no point reading past the first
+            // failure, since nothing after it will be swapped in.
+            if (nullptr == psetUnloaded) {
+                abbreviated.resize(i + 1);
+                raw.resize(i + 1);
+                break;
+            }
+        }
+    }
+
+    std::vector<OTTransaction*> loaded(abbreviated.size(), nullptr);
+    std::atomic<std::size_t> next{0};
+    auto verify = [&]() -> void {
+        for (auto i = next++; i < abbreviated.size(); i = next++) {
+            if (raw[i].Exists()) {
+                loaded[i] = InstantiateBoxReceipt(*abbreviated[i], raw[i]);
+            }
+        }
+    };
+
+    RunWorkers(
+        std::min(
+            abbreviated.size() / OT_BOX_RECEIPTS_PER_LOADER_THREAD,
+            WorkerThreads()),
+        verify);
+
+    // Now swap the results in, in transaction number order. Receipts past the
+    // first failure are discarded unless psetUnloaded is being populated, so
+    // the ledger ends up in the same state the sequential version left it in.
     bool bRetVal = true;
 
-    for (auto& it : the_set) {
-        std::int64_t lSetNum = it;
+    for (std::size_t i = 0; i < abbreviated.size(); ++i) {
+        const std::int64_t lSetNum = abbreviated[i]->GetTransactionNum();
+        OTTransaction* pBoxReceipt = loaded[i];
 
-        OTTransaction* pTransaction = GetTransaction(lSetNum);
-        OT_ASSERT(nullptr != pTransaction);
+        if (false == bRetVal && nullptr == psetUnloaded) {
+            delete pBoxReceipt;
 
-        // Failed loading the boxReceipt
-        //
-        if ((true == pTransaction->IsAbbreviated()) &&
-            (false == LoadBoxReceipt(lSetNum))) {
-            // WARNING: pTransaction must be re-Get'd below this point if
-            // needed, since pointer
-            // is bad if success on LoadBoxReceipt() call.
-            //
-            pTransaction = nullptr;
-            bRetVal = false;
-            OTLogStream* pLog = &otOut;
+            continue;
+        }
 
-            if (nullptr != psetUnloaded) {
-                psetUnloaded->insert(lSetNum);
-                pLog = &otLog3;
-            }
-            *pLog << "OTLedger::LoadBoxReceipts: Failed calling LoadBoxReceipt "
-                     "on "
-                     "abbreviated transaction number:"
-                  << lSetNum << ".\n";
-            // If psetUnloaded is passed in, then we don't want to break,
-            // because we want to
-            // populate it with the conmplete list of IDs that wouldn't load as
-            // a Box Receipt.
-            // Thus, we only break if psetUnloaded is nullptr, which is better
-            // optimization in that case.
-            // (If not building a list of all failures, then we can return at
-            // first sign of failure.)
-            //
-            if (nullptr == psetUnloaded) break;
+        if (nullptr != pBoxReceipt) {
+            // Remove the existing, abbreviated receipt, and replace it with
+            // the actual receipt.
+            RemoveTransaction(lSetNum);  // this deletes abbreviated[i]
+            abbreviated[i] = nullptr;
+            AddTransaction(*pBoxReceipt);  // takes ownership.
+
+            continue;
         }
-        // else (success), no need for a block in that case.
-    }
 
-    // You might ask, why didn't I just iterate through the transactions
-    // directly and just call
-    // LoadBoxReceipt on each one? Answer: Because that function actually
-    // deletes the transaction
-    // and replaces it with a different object, if successful.
+        bRetVal = false;
+        OTLogStream* pLog = &otOut;
+
+        if (nullptr != psetUnloaded) {
+            psetUnloaded->insert(lSetNum);
+            pLog = &otLog3;
+        }
+
+        *pLog << "OTLedger::LoadBoxReceipts: Failed calling LoadBoxReceipt "
+                 "on "
+                 "abbreviated transaction number:"
+              << lSetNum << ".\n";
+    }
 
     return bRetVal;
 }
@@ -359,6 +402,111 @@ bool Ledger::LoadBoxReceipt(const std::int64_t& lTransactionNum)
     return false;
 }
 
+// Loads the full version of an abbreviated entry into the receipt cache,
+// without replacing the abbreviated entry in m_mapTransactions. The returned
+// pointer is owned by the cache, and is only good until the next call (which
+// may evict it.)
+OTTransaction* Ledger::cached_receipt(const std::int64_t number)
+{
+    OTTransaction* pTransaction = GetTransaction(number);
+
+    if (nullptr == pTransaction) { return nullptr; }
+
+    if (false == pTransaction->IsAbbreviated()) { return pTransaction; }
+
+    auto it = receipt_cache_.find(number);
+
+    if (receipt_cache_.end() != it) {
+        auto& cached = it->second;
+        receipt_lru_.splice(
+            receipt_lru_.begin(), receipt_lru_, cached.position_);
+
+        return cached.receipt_.get();
+    }
+
+    String strRawFile;
+    const std::int64_t lLedgerType = static_cast<std::int64_t>(GetType());
+
+    if (false == ReadBoxReceipt(*pTransaction, lLedgerType, strRawFile)) {
+
+        return nullptr;
+    }
+
+    std::unique_ptr<OTTransaction> pBoxReceipt(
+        InstantiateBoxReceipt(*pTransaction, strRawFile));
+
+    if (false == bool(pBoxReceipt)) { return nullptr; }
+
+    pBoxReceipt->SetParent(*this);
+    receipt_lru_.push_front(number);
+    auto& cached = receipt_cache_[number];
+    cached.receipt_ = std::move(pBoxReceipt);
+    cached.size_ = strRawFile.GetLength();
+    cached.position_ = receipt_lru_.begin();
+    receipt_cache_size_ += cached.size_;
+    OTTransaction* output = cached.receipt_.get();
+
+    // The receipt that was just loaded is never evicted, even if it alone is
+    // bigger than the budget.
+    while ((receipt_cache_size_ > receipt_budget_) &&
+           (1 < receipt_lru_.size())) {
+        auto oldest = receipt_cache_.find(receipt_lru_.back());
+
+        OT_ASSERT(receipt_cache_.end() != oldest);
+
+        receipt_cache_size_ -= oldest->second.size_;
+        receipt_cache_.erase(oldest);
+        receipt_lru_.pop_back();
+    }
+
+    return output;
+}
+
+// Replaces an abbreviated entry with its full version, taking it from the
+// receipt cache if it's already there.
+OTTransaction* Ledger::materialize_receipt(const std::int64_t number)
+{
+    OTTransaction* pTransaction = GetTransaction(number);
+
+    if (nullptr == pTransaction) { return nullptr; }
+
+    if (false == pTransaction->IsAbbreviated()) { return pTransaction; }
+
+    auto it = receipt_cache_.find(number);
+
+    if (receipt_cache_.end() == it) {
+        if (false == LoadBoxReceipt(number)) { return nullptr; }
+
+        return GetTransaction(number);
+    }
+
+    OTTransaction* pBoxReceipt = it->second.receipt_.release();
+    RemoveTransaction(number);  // deletes pTransaction and the cache entry.
+    pTransaction = nullptr;
+    AddTransaction(*pBoxReceipt);  // takes ownership.
+
+    return pBoxReceipt;
+}
+
+void Ledger::release_receipt_cache()
+{
+    receipt_cache_.clear();
+    receipt_lru_.clear();
+    receipt_cache_size_ = 0;
+}
+
+void Ledger::SetLazyReceipts(const std::size_t budget)
+{
+    receipt_budget_ = budget;
+
+    if (0 == receipt_budget_) { release_receipt_cache(); }
+}
+
+OTTransaction* Ledger::GetFullTransaction(std::int64_t lTransactionNum)
+{
+    return materialize_receipt(lTransactionNum);
+}
+
 std::set<std::int64_t> Ledger::GetTransactionNums(
     const std::set<std::int32_t>* pOnlyForIndices /*=nullptr*/) const
 {
@@ -1102,6 +1250,13 @@ bool Ledger::RemoveTransaction(std::int64_t lTransactionNum, bool bDeleteIt)
         OTTransaction* pTransaction = it->second;
         OT_ASSERT(nullptr != pTransaction);
         m_mapTransactions.erase(it);
+        auto cached = receipt_cache_.find(lTransactionNum);
+
+        if (receipt_cache_.end() != cached) {
+            receipt_cache_size_ -= cached->second.size_;
+            receipt_lru_.erase(cached->second.position_);
+            receipt_cache_.erase(cached);
+        }
 
         if (bDeleteIt) {
             delete pTransaction;
@@ -1256,10 +1411,17 @@ OTTransaction* Ledger::GetTransferReceipt(std::int64_t lNumberOfOrigin)
 {
     // loop through the transactions that make up this ledger.
     for (auto& it : m_mapTransactions) {
+        const std::int64_t lReceiptNum = it.first;
         OTTransaction* pTransaction = it.second;
         OT_ASSERT(nullptr != pTransaction);
 
         if (OTTransaction::transferReceipt == pTransaction->GetType()) {
+            if (LazyReceipts()) {
+                pTransaction = cached_receipt(lReceiptNum);
+
+                if (nullptr == pTransaction) { continue; }
+            }
+
             String strReference;
             pTransaction->GetReferenceString(strReference);
 
@@ -1297,10 +1459,16 @@ OTTransaction* Ledger::GetTransferReceipt(std::int64_t lNumberOfOrigin)
                 // NumberOfOrigin,
                 // and compare it to the NumberOfOrigin, to find the match.
                 //
-                if (pOriginalItem->GetNumberOfOrigin() == lNumberOfOrigin)
+                if (pOriginalItem->GetNumberOfOrigin() == lNumberOfOrigin) {
                     //              if (pOriginalItem->GetReferenceToNum() ==
                     // lTransactionNum)
+                    if (LazyReceipts()) {
+
+                        return materialize_receipt(lReceiptNum);
+                    }
+
                     return pTransaction;  // FOUND IT!
+                }
             }
         }
     }
@@ -1333,6 +1501,7 @@ OTTransaction* Ledger::GetChequeReceipt(
                            // TO DELETE.
 {
     for (auto& it : m_mapTransactions) {
+        const std::int64_t lReceiptNum = it.first;
         OTTransaction* pCurrentReceipt = it.second;
         OT_ASSERT(nullptr != pCurrentReceipt);
 
@@ -1340,6 +1509,12 @@ OTTransaction* Ledger::GetChequeReceipt(
             (pCurrentReceipt->GetType() != OTTransaction::voucherReceipt))
             continue;
 
+        if (LazyReceipts()) {
+            pCurrentReceipt = cached_receipt(lReceiptNum);
+
+            if (nullptr == pCurrentReceipt) { continue; }
+        }
+
         String strDepositChequeMsg;
         pCurrentReceipt->GetReferenceString(strDepositChequeMsg);
 
@@ -1407,6 +1582,11 @@ OTTransaction* Ledger::GetChequeReceipt(
                         theChequeAngel.release();
                     }
 
+                    if (LazyReceipts()) {
+
+                        return materialize_receipt(lReceiptNum);
+                    }
+
                     return pCurrentReceipt;
                 }
             }
@@ -2411,6 +2591,7 @@ Ledger::~Ledger() { Release_Ledger(); }
 void Ledger::ReleaseTransactions()
 {
     // If there were any dynamically allocated objects, clean them up here.
+    release_receipt_cache();
 
     while (!m_mapTransactions.empty()) {
         OTTransaction* pTransaction = m_mapTransactions.begin()->second;
@@ -48,6 +48,8 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/Types.hpp"
 
+#include "LogQueue.hpp"
+
 #ifndef _WIN32
 #include <unistd.h>
 #include <cerrno>
@@ -59,6 +61,7 @@
 #include <cstdarg>
 #include <cstdint>
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
@@ -72,6 +75,10 @@
 #include <typeinfo>
 
 #define LOG_DEQUE_SIZE 1024
+#define LOG_QUEUE_SIZE 4096
+#define LOG_LINE_LIMIT 1000
+#define LOG_STREAM_COUNT 7
+#define LOG_WRITER_INTERVAL_MILLISECONDS 10
 
 extern "C" {
 
@@ -124,6 +131,34 @@ struct sigcontext {
 
 //  OTLog Static Variables and Constants.
 
+namespace
+{
+// Cleanup waits until no thread is using pLogger in Output, Error or write.
+std::atomic<bool> shutdown_{false};
+std::atomic<std::int32_t> producers_{0};
+
+class Producer
+{
+public:
+    const bool active_;
+
+    Producer()
+        : active_(enter())
+    {
+    }
+
+    ~Producer() { --producers_; }
+
+private:
+    static bool enter()
+    {
+        ++producers_;
+
+        return false == shutdown_.load();
+    }
+};
+}  // namespace
+
 namespace opentxs
 {
 
@@ -143,34 +178,124 @@ OTLOG_IMPORT OTLogStream otLog5(5);  // logs using OTLog::vOutput(5)
 OTLogStream::OTLogStream(int _logLevel)
     : std::ostream(this)
     , logLevel(_logLevel)
-    , next(0)
-    , pBuffer(new char[1024])
 {
 }
 
-OTLogStream::~OTLogStream()
+std::string& OTLogStream::buffer() const
 {
-    delete[] pBuffer;
-    pBuffer = nullptr;
+    thread_local std::array<std::string, LOG_STREAM_COUNT> buffers{};
+    const auto index =
+        std::min(std::max(logLevel, -1), LOG_STREAM_COUNT - 2) + 1;
+
+    return buffers[index];
+}
+
+void OTLogStream::flush_line(std::string& line) const
+{
+    if (logLevel < 0) {
+        Log::Error(line.c_str());
+    } else {
+        Log::Output(logLevel, line.c_str());
+    }
+
+    line.clear();
 }
 
 int OTLogStream::overflow(int c)
 {
-    rLock lock(lock_);
+    if (std::char_traits<char>::eof() == c) { return 0; }
 
-    pBuffer[next++] = c;
-    if (c != '\n' && next < 1000) { return 0; }
+    if (false == Log::Enabled(logLevel)) { return c; }
 
-    pBuffer[next++] = '\0';
-    next = 0;
+    auto& line = buffer();
+    line.push_back(static_cast<char>(c));
 
-    if (logLevel < 0) {
-        Log::Error(pBuffer);
-        return 0;
+    if (('\n' == c) || (LOG_LINE_LIMIT <= line.size())) { flush_line(line); }
+
+    return c;
+}
+
+std::streamsize OTLogStream::xsputn(const char* s, std::streamsize count)
+{
+    if (false == Log::Enabled(logLevel)) { return count; }
+
+    auto& line = buffer();
+    const char* it = s;
+    const char* const end = s + count;
+
+    while (it < end) {
+        const auto* newline =
+            static_cast<const char*>(std::memchr(it, '\n', end - it));
+        const char* const stop = (nullptr == newline) ? end : newline + 1;
+        line.append(it, stop);
+        it = stop;
+
+        if ((nullptr != newline) || (LOG_LINE_LIMIT <= line.size())) {
+            flush_line(line);
+        }
     }
 
-    Log::Output(logLevel, pBuffer);
-    return 0;
+    return count;
+}
+
+LogRecord::LogRecord(const std::int32_t level, const char* event)
+    : level_(level)
+    , line_((nullptr == event) ? "" : event)
+{
+}
+
+LogRecord& LogRecord::Add(const char* key, const char* value)
+{
+    return Add(key, std::string((nullptr == value) ? "" : value));
+}
+
+LogRecord& LogRecord::Add(const char* key, const std::string& value)
+{
+    line_ += ' ';
+    line_ += (nullptr == key) ? "" : key;
+    line_ += '=';
+
+    const bool quote =
+        value.empty() || (std::string::npos != value.find_first_of(" \t\n\"="));
+
+    if (false == quote) {
+        line_ += value;
+
+        return *this;
+    }
+
+    line_ += '"';
+
+    for (const auto& c : value) {
+        switch (c) {
+            case '"':
+            case '\\': {
+                line_ += '\\';
+                line_ += c;
+            } break;
+            case '\n': {
+                line_ += "\\n";
+            } break;
+            default: {
+                line_ += c;
+            }
+        }
+    }
+
+    line_ += '"';
+
+    return *this;
+}
+
+LogRecord::~LogRecord()
+{
+    line_ += '\n';
+
+    if (level_ < 0) {
+        Log::Error(line_.c_str());
+    } else {
+        Log::Output(level_, line_.c_str());
+    }
 }
 
 Log::Log(const api::Settings& config)
@@ -242,6 +367,9 @@ bool Log::Init(
             }
 
         pLogger->m_bInitialized = true;
+#ifndef ANDROID
+        pLogger->start_writer();
+#endif
 
         // Set the new log-assert function pointer.
         Assert* pLogAssert = new Assert(Log::logAssert);
@@ -255,6 +383,8 @@ bool Log::Init(
     }
 }
 
+Log::~Log() { stop_writer(); }
+
 // static
 bool Log::IsInitialized()
 {
@@ -264,21 +394,30 @@ bool Log::IsInitialized()
 // static
 bool Log::Cleanup()
 {
-    if (nullptr != pLogger) {
-        delete pLogger;
-        pLogger = nullptr;
-        return true;
-    }
-    return false;
+    if (nullptr == pLogger) { return false; }
+
+    // Wait for every thread already logging to finish with pLogger.
+    // Anything logged from here on goes straight to stderr.
+    shutdown_.store(true);
+
+    while (0 < producers_.load()) { std::this_thread::yield(); }
+
+    pLogger->stop_writer();
+    delete pLogger;
+    pLogger = nullptr;
+    shutdown_.store(false);
+
+    return true;
 }
 
 // static
 bool Log::CheckLogger(Log* pLogger)
 {
+    if (nullptr == pLogger) { OT_FAIL; }
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(pLogger->lock_);
 
-    if (nullptr != pLogger && pLogger->m_bInitialized) return true;
+    if (pLogger->m_bInitialized) return true;
 
     OT_FAIL;
 }
@@ -309,6 +448,27 @@ std::int32_t Log::LogLevel()
         return 0;
 }
 
+// static
+bool Log::Enabled(const std::int32_t nVerbosity)
+{
+    if (0 > nVerbosity) { return true; }
+
+    const auto level = LogLevel();
+
+    return (-1 != level) && (nVerbosity <= level);
+}
+
+// static
+void Log::Flush()
+{
+    if (nullptr == pLogger) { return; }
+
+    if (false == pLogger->running_.load()) { return; }
+
+    Lock lock(pLogger->writer_lock_);
+    pLogger->drain();
+}
+
 // static
 bool Log::SetLogLevel(const std::int32_t& nLogLevel)
 {
@@ -328,11 +488,38 @@ bool Log::SetLogLevel(const std::int32_t& nLogLevel)
 // if I was actually writing to stdout.)
 //
 // static
-bool Log::LogToFile(const String& strOutput)
+bool Log::LogToFile(const String& strOutput) { return write(strOutput.Get()); }
+
+// Once the logger is initialized, lines are queued for the writer thread,
+// which keeps the log file open and flushes once per batch. Until then (or
+// after Cleanup) they are written synchronously.
+//
+// static private
+bool Log::write(const char* szOutput)
 {
+    Producer producer;
+
+    if (false == producer.active_) {
+        std::cerr << szOutput;
+        std::cerr.flush();
+
+        return true;
+    }
+
+    if ((nullptr != pLogger) && pLogger->running_.load()) {
+        std::string line(szOutput);
+
+        // Push leaves line untouched if the queue is full
+        while (false == pLogger->queue_->Push(std::move(line))) {
+            std::this_thread::yield();
+        }
+
+        return true;
+    }
+
     // We now do this either way.
     {
-        std::cerr << strOutput;
+        std::cerr << szOutput;
         std::cerr.flush();
     }
 
@@ -345,20 +532,19 @@ bool Log::LogToFile(const String& strOutput)
     // lets check if we are Initialized in this context
     if (bHaveLogger) CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
-
     bool bSuccess = false;
 
     if (bHaveLogger) {
         if (false == pLogger->write_log_file_) { return true; }
 
         // Append to logfile
-        if ((strOutput.Exists()) && (Log::pLogger->m_strLogFilePath.Exists())) {
+        if ((0 != std::strlen(szOutput)) &&
+            (Log::pLogger->m_strLogFilePath.Exists())) {
             std::ofstream logfile;
             logfile.open(Log::LogFilePath(), std::ios::app);
 
             if (!logfile.fail()) {
-                logfile << strOutput;
+                logfile << szOutput;
                 logfile.close();
                 bSuccess = true;
             }
@@ -368,12 +554,73 @@ bool Log::LogToFile(const String& strOutput)
     return bSuccess;
 }
 
+void Log::drain()
+{
+    std::string line{};
+    bool wrote{false};
+
+    while (queue_->Pop(line)) {
+        std::cerr << line;
+
+        if (logfile_.is_open()) { logfile_ << line; }
+
+        wrote = true;
+    }
+
+    if (wrote) {
+        std::cerr.flush();
+
+        if (logfile_.is_open()) { logfile_.flush(); }
+    }
+}
+
+void Log::start_writer()
+{
+    if (running_.load()) { return; }
+
+    if (write_log_file_ && m_strLogFilePath.Exists()) {
+        logfile_.open(m_strLogFilePath.Get(), std::ios::app);
+    }
+
+    queue_.reset(new implementation::LogQueue(LOG_QUEUE_SIZE));
+
+    OT_ASSERT(queue_);
+
+    running_.store(true);
+    writer_ = std::thread(&Log::write_thread, this);
+}
+
+void Log::stop_writer()
+{
+    if (false == running_.exchange(false)) { return; }
+
+    if (writer_.joinable()) { writer_.join(); }
+
+    Lock lock(writer_lock_);
+    drain();
+
+    if (logfile_.is_open()) { logfile_.close(); }
+}
+
+void Log::write_thread()
+{
+    while (running_.load()) {
+        {
+            Lock lock(writer_lock_);
+            drain();
+        }
+
+        std::this_thread::sleep_for(
+            std::chrono::milliseconds(LOG_WRITER_INTERVAL_MILLISECONDS));
+    }
+}
+
 String Log::GetMemlogAtIndex(std::int32_t nIndex)
 {
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(Log::pLogger->lock_);
 
     std::uint32_t uIndex = static_cast<uint32_t>(nIndex);
 
@@ -402,7 +649,7 @@ std::int32_t Log::GetMemlogSize()
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(Log::pLogger->lock_);
 
     return static_cast<std::int32_t>(Log::pLogger->logDeque.size());
 }
@@ -412,7 +659,7 @@ String Log::PeekMemlogFront()
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(Log::pLogger->lock_);
 
     if (Log::pLogger->logDeque.size() <= 0) return nullptr;
 
@@ -434,7 +681,7 @@ String Log::PeekMemlogBack()
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(Log::pLogger->lock_);
 
     if (Log::pLogger->logDeque.size() <= 0) return nullptr;
 
@@ -457,7 +704,7 @@ bool Log::PopMemlogFront()
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(Log::pLogger->lock_);
 
     if (Log::pLogger->logDeque.size() <= 0) return false;
 
@@ -476,7 +723,7 @@ bool Log::PopMemlogBack()
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(Log::pLogger->lock_);
 
     if (Log::pLogger->logDeque.size() <= 0) return false;
 
@@ -495,7 +742,7 @@ bool Log::PushMemlogFront(const String& strLog)
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(Log::pLogger->lock_);
 
     OT_ASSERT(strLog.Exists());
 
@@ -536,6 +783,7 @@ size_t Log::logAssert(
 
         LogToFile(szMessage);
         LogToFile("\n");
+        Flush();
 
 #else  // if Android
         __android_log_write(
@@ -556,6 +804,7 @@ size_t Log::logAssert(
             szFilename,
             nLinenumber);
         LogToFile(strTemp.Get());
+        Flush();
 
 #else  // if Android
         String strAndroidAssertMsg;
@@ -576,6 +825,11 @@ size_t Log::logAssert(
 
 void Log::Output(std::int32_t nVerbosity, const char* szOutput)
 {
+    Producer producer;
+
+    // Cleanup is running, and pLogger can't be used to check the level.
+    if (false == producer.active_) { return; }
+
     bool bHaveLogger(false);
     if (nullptr != pLogger)
         if (pLogger->IsInitialized()) bHaveLogger = true;
@@ -586,16 +840,14 @@ void Log::Output(std::int32_t nVerbosity, const char* szOutput)
     // If log level is 0, and verbosity of this message is 2, don't bother
     // logging it.
     //    if (nVerbosity > OTLog::__CurrentLogLevel || (nullptr == szOutput))
-    if ((nVerbosity > LogLevel()) || (nullptr == szOutput) ||
-        (LogLevel() == (-1)))
-        return;
+    if ((false == Enabled(nVerbosity)) || (nullptr == szOutput)) return;
 
     // We store the last 1024 logs so programmers can access them via the API.
     if (bHaveLogger) Log::PushMemlogFront(szOutput);
 
 #ifndef ANDROID  // if NOT android
 
-    LogToFile(szOutput);
+    write(szOutput);
 
 #else  // if IS Android
     /*
@@ -701,6 +953,14 @@ void Log::vError(const char* szError, ...)
 
 void Log::Error(const char* szError)
 {
+    Producer producer;
+
+    if (false == producer.active_) {
+        if (nullptr != szError) { write(szError); }
+
+        return;
+    }
+
     bool bHaveLogger(false);
     if (nullptr != pLogger)
         if (pLogger->IsInitialized()) bHaveLogger = true;
@@ -717,7 +977,7 @@ void Log::Error(const char* szError)
 
 #ifndef ANDROID  // if NOT android
 
-    LogToFile(szError);
+    write(szError);
 
 #else  // if Android
     __android_log_write(ANDROID_LOG_ERROR, "OT Error", szError);
@@ -0,0 +1,121 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "stdafx.hpp"
+
+#include "LogQueue.hpp"
+
+namespace opentxs::implementation
+{
+LogQueue::LogQueue(const std::size_t size)
+    : mask_(round_up(size) - 1)
+    , slots_(new Slot[mask_ + 1])
+    , push_position_(0)
+    , pop_position_(0)
+{
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool LogQueue::Pop(std::string& out)
+{
+    auto position = pop_position_.load(std::memory_order_relaxed);
+
+    for (;;) {
+        auto& slot = slots_[position & mask_];
+        const auto sequence = slot.sequence_.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) -
+                                static_cast<std::ptrdiff_t>(position + 1);
+
+        if (0 == difference) {
+            if (pop_position_.compare_exchange_weak(
+                    position, position + 1, std::memory_order_relaxed)) {
+                out.swap(slot.line_);
+                slot.line_.clear();
+                slot.sequence_.store(
+                    position + mask_ + 1, std::memory_order_release);
+
+                return true;
+            }
+        } else if (0 > difference) {
+
+            return false;
+        } else {
+            position = pop_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool LogQueue::Push(std::string&& in)
+{
+    auto position = push_position_.load(std::memory_order_relaxed);
+
+    for (;;) {
+        auto& slot = slots_[position & mask_];
+        const auto sequence = slot.sequence_.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) -
+                                static_cast<std::ptrdiff_t>(position);
+
+        if (0 == difference) {
+            if (push_position_.compare_exchange_weak(
+                    position, position + 1, std::memory_order_relaxed)) {
+                slot.line_.swap(in);
+                slot.sequence_.store(position + 1, std::memory_order_release);
+
+                return true;
+            }
+        } else if (0 > difference) {
+
+            return false;
+        } else {
+            position = push_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+std::size_t LogQueue::round_up(const std::size_t size)
+{
+    std::size_t output{2};
+
+    while (output < size) { output <<= 1; }
+
+    return output;
+}
+}  // namespace opentxs::implementation
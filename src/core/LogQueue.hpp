@@ -0,0 +1,86 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_CORE_IMPLEMENTATION_LOGQUEUE_HPP
+#define OPENTXS_CORE_IMPLEMENTATION_LOGQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace opentxs::implementation
+{
+/** Bounded multi-producer, multi-consumer ring buffer for completed log lines.
+ *
+ *  Producers never block on a mutex: each slot carries a sequence number
+ *  which tells a producer or consumer whether the slot is ready for it. Push
+ *  returns false if the queue is full, Pop returns false if it is empty. */
+class LogQueue
+{
+public:
+    bool Pop(std::string& out);
+    bool Push(std::string&& in);
+
+    /** size is rounded up to the next power of two */
+    explicit LogQueue(const std::size_t size);
+
+    ~LogQueue() = default;
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence_{0};
+        std::string line_{};
+    };
+
+    const std::size_t mask_{0};
+    std::unique_ptr<Slot[]> slots_{nullptr};
+    alignas(64) std::atomic<std::size_t> push_position_{0};
+    alignas(64) std::atomic<std::size_t> pop_position_{0};
+
+    static std::size_t round_up(const std::size_t size);
+
+    LogQueue() = delete;
+    LogQueue(const LogQueue&) = delete;
+    LogQueue(LogQueue&&) = delete;
+    LogQueue& operator=(const LogQueue&) = delete;
+    LogQueue& operator=(LogQueue&&) = delete;
+};
+}  // namespace opentxs::implementation
+#endif  // OPENTXS_CORE_IMPLEMENTATION_LOGQUEUE_HPP
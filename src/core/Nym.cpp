@@ -103,6 +103,7 @@ Nym::Nym(
     , m_bMarkForDeletion(false)
     , alias_(name.Get())
     , lock_()
+    , signing_lock_()
     , revision_(1)
     , mode_(mode)
     , m_strNymfile(filename)
@@ -46,11 +46,27 @@
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/OTStoragePB.hpp"
+#include "opentxs/Types.hpp"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstdio>
 #include <fstream>
+#include <iterator>
+#include <set>
 #include <sstream>
 #include <typeinfo>
 
+#define STORAGE_FS_JOURNAL_FILE "batch.journal"
+#define STORAGE_FS_JOURNAL_MAGIC "OTDBJRNL\n"
+#define STORAGE_FS_JOURNAL_COMMIT "COMMIT\n"
+#define STORAGE_FS_JOURNAL_STORE "S"
+#define STORAGE_FS_JOURNAL_ERASE "E"
+
 /*
  // We want to store EXISTING OT OBJECTS (Usually signed contracts)
  // These have an EXISTING OT path, such as "inbox/acct_id".
@@ -259,6 +275,161 @@ InitOTDBDetails theOTDBConstructor;  // Constructor for this instance (define
                                      // all
                                      // namespace variables above this line.)
 
+namespace
+{
+thread_local WriteBatch* active_batch_{nullptr};
+std::mutex write_observer_lock_{};
+WriteObserver write_observer_{};
+
+void notify_write(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr,
+    const std::string* contents)
+{
+    Lock lock(write_observer_lock_);
+    const auto observer = write_observer_;
+    lock.unlock();
+
+    if (false == bool(observer)) { return; }
+
+    const bool shift = oneStr.empty();
+    observer(
+        shift ? "." : strFolder,
+        shift ? strFolder : oneStr,
+        twoStr,
+        threeStr,
+        contents);
+}
+
+// Journal fields are a decimal length, a newline, then the bytes themselves.
+void put_field(std::string& output, const std::string& field)
+{
+    output.append(std::to_string(field.size()));
+    output.push_back('\n');
+    output.append(field);
+}
+
+bool get_field(
+    const std::string& input,
+    std::size_t& position,
+    std::string& field)
+{
+    const auto end = input.find('\n', position);
+
+    if ((std::string::npos == end) || (end == position)) { return false; }
+
+    std::size_t size{0};
+
+    for (auto i = position; i < end; ++i) {
+        const auto digit = input[i];
+
+        if ((digit < '0') || (digit > '9')) { return false; }
+
+        size = (size * 10) + static_cast<std::size_t>(digit - '0');
+    }
+
+    position = end + 1;
+
+    if (size > (input.size() - position)) { return false; }
+
+    field = input.substr(position, size);
+    position += size;
+
+    return true;
+}
+
+// Only accepts a journal whose commit marker was written
+bool read_journal(const std::string& input, Storage::Batch& batch)
+{
+    const std::string magic(STORAGE_FS_JOURNAL_MAGIC);
+    const std::string commit(STORAGE_FS_JOURNAL_COMMIT);
+
+    if (0 != input.compare(0, magic.size(), magic)) { return false; }
+
+    std::size_t position{magic.size()};
+
+    while (position < input.size()) {
+        if (0 == input.compare(position, std::string::npos, commit)) {
+
+            return true;
+        }
+
+        std::string type{};
+        Storage::BatchEntry entry{};
+        const bool read = get_field(input, position, type) &&
+                          get_field(input, position, entry.folder_) &&
+                          get_field(input, position, entry.one_) &&
+                          get_field(input, position, entry.two_) &&
+                          get_field(input, position, entry.three_) &&
+                          get_field(input, position, entry.value_);
+
+        if (false == read) { return false; }
+
+        entry.erase_ = (STORAGE_FS_JOURNAL_ERASE == type);
+        batch.push_back(entry);
+    }
+
+    return false;
+}
+
+bool write_journal(const std::string& path, const std::string& contents)
+{
+#ifdef _WIN32
+    std::ofstream file(
+        path, std::ios::out | std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), contents.size());
+    file.close();
+
+    return false == file.fail();
+#else
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+
+    if (-1 == fd) { return false; }
+
+    std::size_t written{0};
+
+    while (written < contents.size()) {
+        const auto result = ::write(
+            fd, contents.data() + written, contents.size() - written);
+
+        if (0 > result) {
+            ::close(fd);
+
+            return false;
+        }
+
+        written += static_cast<std::size_t>(result);
+    }
+
+    const bool synced = (0 == ::fsync(fd));
+    ::close(fd);
+
+    return synced;
+#endif
+}
+
+// Flushes a file or directory to disk. A file which does not exist counts as
+// synced, since erasures are made durable by syncing the directory instead.
+bool sync_path(const std::string& path, const bool directory)
+{
+#ifdef _WIN32
+    return true;
+#else
+    const int fd =
+        ::open(path.c_str(), O_RDONLY | (directory ? O_DIRECTORY : 0));
+
+    if (-1 == fd) { return (false == directory) && (ENOENT == errno); }
+
+    const bool synced = (0 == ::fsync(fd));
+    ::close(fd);
+
+    return synced;
+#endif
+}
+}  // namespace
+
 InitOTDBDetails::InitOTDBDetails()  // Constructor for namespace
 {
 #if defined(OTDB_MESSAGE_PACK) || defined(OTDB_PROTOCOL_BUFFERS)
@@ -511,6 +682,16 @@ bool Exists(
         }
     }
 
+    const auto* batch = WriteBatch::Current();
+    std::string notUsed{};
+    bool staged{false};
+
+    if ((nullptr != batch) &&
+        batch->Query(notUsed, staged, strFolder, oneStr, twoStr, threeStr)) {
+
+        return staged;
+    }
+
     Storage* pStorage = details::s_pStorage;
 
     if (nullptr == pStorage) {
@@ -639,10 +820,27 @@ bool StorePlainString(
     OT_ASSERT((strFolder.length() > 3) || (0 == strFolder.compare(0, 1, ".")));
     OT_ASSERT((oneStr.length() < 1) || (oneStr.length() > 3));
 
+    auto* batch = WriteBatch::Current();
+
+    if (nullptr != batch) {
+        batch->Store(
+            strContents, ot_strFolder.Get(), ot_oneStr.Get(), twoStr, threeStr);
+
+        return true;
+    }
+
     if (nullptr == pStorage) { return false; }
 
-    return pStorage->StorePlainString(
+    const bool output = pStorage->StorePlainString(
         strContents, ot_strFolder.Get(), ot_oneStr.Get(), twoStr, threeStr);
+    notify_write(
+        ot_strFolder.Get(),
+        ot_oneStr.Get(),
+        twoStr,
+        threeStr,
+        output ? &strContents : nullptr);
+
+    return output;
 }
 
 std::string QueryPlainString(
@@ -669,6 +867,21 @@ std::string QueryPlainString(
     OT_ASSERT((strFolder.length() > 3) || (0 == strFolder.compare(0, 1, ".")));
     OT_ASSERT((oneStr.length() < 1) || (oneStr.length() > 3));
 
+    const auto* batch = WriteBatch::Current();
+    std::string staged{};
+    bool notUsed{false};
+
+    if ((nullptr != batch) && batch->Query(
+                                  staged,
+                                  notUsed,
+                                  ot_strFolder.Get(),
+                                  ot_oneStr.Get(),
+                                  twoStr,
+                                  threeStr)) {
+
+        return staged;
+    }
+
     if (nullptr == pStorage) { return std::string(""); }
 
     return pStorage->QueryPlainString(
@@ -769,6 +982,21 @@ bool EraseValueByKey(
     const std::string& twoStr,
     const std::string& threeStr)
 {
+    // Same normalization as StorePlainString, so that both report a location
+    // under the same key
+    const bool shift = oneStr.empty();
+    const std::string folder = shift ? "." : strFolder;
+    const std::string one = shift ? strFolder : oneStr;
+    auto* batch = WriteBatch::Current();
+
+    if (nullptr != batch) {
+        batch->Erase(folder, one, twoStr, threeStr);
+
+        return true;
+    }
+
+    notify_write(folder, one, twoStr, threeStr, nullptr);
+
     Storage* pStorage = details::s_pStorage;
 
     if (nullptr == pStorage) {
@@ -777,7 +1005,141 @@ bool EraseValueByKey(
         return false;
     }
 
-    return pStorage->EraseValueByKey(strFolder, oneStr, twoStr, threeStr);
+    return pStorage->EraseValueByKey(folder, one, twoStr, threeStr);
+}
+
+void SetWriteObserver(const WriteObserver& observer)
+{
+    Lock lock(write_observer_lock_);
+    write_observer_ = observer;
+}
+
+WriteBatch::WriteBatch()
+    : nested_(nullptr != active_batch_)
+    , entries_()
+    , index_()
+{
+    if (false == nested_) { active_batch_ = this; }
+}
+
+bool WriteBatch::Commit()
+{
+    if (nested_ || entries_.empty()) { return true; }
+
+    Storage* pStorage = details::s_pStorage;
+
+    if (nullptr == pStorage) {
+        otErr << "OTDB::WriteBatch::" << __FUNCTION__
+              << ": No Default Storage object allocated.\n";
+
+        return false;
+    }
+
+    const bool output = pStorage->StoreBatch(entries_);
+
+    // Observers only learn about staged writes once they are committed
+    if (output) {
+        for (const auto& entry : entries_) {
+            notify_write(
+                entry.folder_,
+                entry.one_,
+                entry.two_,
+                entry.three_,
+                entry.erase_ ? nullptr : &entry.value_);
+        }
+    } else {
+        otErr << "OTDB::WriteBatch::" << __FUNCTION__ << ": Failed to store "
+              << entries_.size() << " staged values.\n";
+    }
+
+    entries_.clear();
+    index_.clear();
+
+    return output;
+}
+
+WriteBatch* WriteBatch::Current() { return active_batch_; }
+
+void WriteBatch::Erase(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    auto& entry = stage(strFolder, oneStr, twoStr, threeStr);
+    entry.erase_ = true;
+    entry.value_.clear();
+}
+
+bool WriteBatch::Query(
+    std::string& value,
+    bool& exists,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) const
+{
+    const bool shift = oneStr.empty();
+    const std::string key = (shift ? "." : strFolder) + '\0' +
+                            (shift ? strFolder : oneStr) + '\0' + twoStr +
+                            '\0' + threeStr;
+    const auto it = index_.find(key);
+
+    if (index_.end() == it) { return false; }
+
+    const auto& entry = entries_.at(it->second);
+    exists = (false == entry.erase_);
+    value = entry.value_;
+
+    return true;
+}
+
+// Locations are normalized the same way as OTDB::StorePlainString so that
+// one and two part keys match whichever form the caller used.
+Storage::BatchEntry& WriteBatch::stage(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    const bool shift = oneStr.empty();
+    const std::string folder = shift ? "." : strFolder;
+    const std::string one = shift ? strFolder : oneStr;
+    const std::string key =
+        folder + '\0' + one + '\0' + twoStr + '\0' + threeStr;
+    const auto it = index_.find(key);
+
+    if (index_.end() != it) { return entries_.at(it->second); }
+
+    index_.emplace(key, entries_.size());
+    entries_.emplace_back();
+    auto& output = entries_.back();
+    output.folder_ = folder;
+    output.one_ = one;
+    output.two_ = twoStr;
+    output.three_ = threeStr;
+
+    return output;
+}
+
+void WriteBatch::Store(
+    const std::string& value,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    auto& entry = stage(strFolder, oneStr, twoStr, threeStr);
+    entry.erase_ = false;
+    entry.value_ = value;
+}
+
+WriteBatch::~WriteBatch()
+{
+    if (nested_) { return; }
+
+    Commit();
+    active_batch_ = nullptr;
 }
 
 // Used internally. Creates the right subclass for any stored object type,
@@ -2095,6 +2457,10 @@ Storage* Storage::Create(
             pStore = StorageFS::Instantiate();
             OT_ASSERT(nullptr != pStore);
             break;
+        case STORE_PACK:
+            pStore = StoragePack::Instantiate();
+            OT_ASSERT(nullptr != pStore);
+            break;
         //            case STORE_COUCH_DB:
         //                pStore = new StorageCouchDB; OT_ASSERT(nullptr !=
         //                pStore);
@@ -2135,6 +2501,8 @@ StorageType Storage::GetType() const
     // that this is a custom Storage type invented by the API user.
 
     if (typeid(*this) == typeid(StorageFS)) return STORE_FILESYSTEM;
+    else if (typeid(*this) == typeid(StoragePack))
+        return STORE_PACK;
     //    else if (typeid(*this) == typeid(StorageCouchDB))
     //        return STORE_COUCH_DB;
     //  Etc.
@@ -2464,6 +2832,34 @@ bool Storage::EraseValueByKey(
     return bSuccess;
 }
 
+bool Storage::onStoreBatch(const Batch& batch)
+{
+    bool output{true};
+
+    for (const auto& entry : batch) {
+        if (entry.erase_) {
+            output &= onEraseValueByKey(
+                entry.folder_, entry.one_, entry.two_, entry.three_);
+        } else {
+            output &= onStorePlainString(
+                entry.value_,
+                entry.folder_,
+                entry.one_,
+                entry.two_,
+                entry.three_);
+        }
+    }
+
+    return output;
+}
+
+bool Storage::StoreBatch(const Batch& batch)
+{
+    if (batch.empty()) { return true; }
+
+    return onStoreBatch(batch);
+}
+
 // STORAGE FS  (OTDB::StorageFS is the filesystem version of OTDB::Storage.)
 
 // ConfirmOrCreateFolder()
@@ -2905,6 +3301,136 @@ bool StorageFS::onEraseValueByKey(
     return bSuccess;
 }
 
+bool StorageFS::onStoreBatch(const Batch& batch)
+{
+    Lock lock(batch_lock_);
+    const auto path = journal_path();
+
+    // A journal left behind by a batch which could not be applied must be
+    // finished before it is overwritten by the next one.
+    if (false == replay_journal()) {
+        otErr << "StorageFS::" << __FUNCTION__ << ": Refusing to overwrite "
+              << path << " which holds an unfinished batch.\n";
+
+        return false;
+    }
+
+    std::string journal(STORAGE_FS_JOURNAL_MAGIC);
+
+    for (const auto& entry : batch) {
+        put_field(
+            journal,
+            entry.erase_ ? STORAGE_FS_JOURNAL_ERASE : STORAGE_FS_JOURNAL_STORE);
+        put_field(journal, entry.folder_);
+        put_field(journal, entry.one_);
+        put_field(journal, entry.two_);
+        put_field(journal, entry.three_);
+        put_field(journal, entry.value_);
+    }
+
+    journal.append(STORAGE_FS_JOURNAL_COMMIT);
+
+    // Once the journal and its directory entry are durable the batch is
+    // committed.
+    if ((false == write_journal(path, journal)) ||
+        (false == sync_path(m_strDataPath, true))) {
+        otErr << "StorageFS::" << __FUNCTION__ << ": Failed to write "
+              << path << ".\n";
+        std::remove(path.c_str());
+
+        return false;
+    }
+
+    // The journal is kept until every file it describes has been written and
+    // synced, so that a crash or a failure part way through is finished by
+    // replay_journal.
+    if (false == apply_batch(batch)) {
+        otErr << "StorageFS::" << __FUNCTION__ << ": Failed to apply "
+              << batch.size() << " writes. They remain in " << path << ".\n";
+
+        return false;
+    }
+
+    std::remove(path.c_str());
+
+    return true;
+}
+
+bool StorageFS::apply_batch(const Batch& batch)
+{
+    if (false == Storage::onStoreBatch(batch)) { return false; }
+
+    std::set<std::string> folders{};
+    bool output{true};
+
+    for (const auto& entry : batch) {
+        std::string file{};
+
+        const auto confirmed = ConstructAndConfirmPath(
+            file, entry.folder_, entry.one_, entry.two_, entry.three_);
+
+        if (0 > confirmed) {
+            output = false;
+
+            continue;
+        }
+
+        if (false == entry.erase_) { output &= sync_path(file, false); }
+
+        // Also sync every folder from the data folder down to the file, in
+        // case any of them was created for this batch.
+        auto end = file.rfind('/');
+
+        while ((std::string::npos != end) &&
+               ((end + 1) >= m_strDataPath.size())) {
+            folders.emplace(file.substr(0, end));
+            end = (0 == end) ? std::string::npos : file.rfind('/', end - 1);
+        }
+    }
+
+    for (const auto& folder : folders) { output &= sync_path(folder, true); }
+
+    return output;
+}
+
+std::string StorageFS::journal_path() const
+{
+    return m_strDataPath + STORAGE_FS_JOURNAL_FILE;
+}
+
+bool StorageFS::replay_journal()
+{
+    const auto path = journal_path();
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if (false == file.is_open()) { return true; }
+
+    const std::string contents(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>());
+    file.close();
+    Batch batch{};
+
+    if (read_journal(contents, batch)) {
+        otErr << "StorageFS::" << __FUNCTION__ << ": Replaying "
+              << batch.size() << " writes from an interrupted batch.\n";
+
+        if (false == apply_batch(batch)) {
+            otErr << "StorageFS::" << __FUNCTION__
+                  << ": Failed to replay " << path << ".\n";
+
+            return false;
+        }
+    } else {
+        otErr << "StorageFS::" << __FUNCTION__
+              << ": Discarding an uncommitted batch.\n";
+    }
+
+    std::remove(path.c_str());
+
+    return true;
+}
+
 // Constructor for Filesystem storage context.
 //
 StorageFS::StorageFS()
@@ -2913,6 +3439,8 @@ StorageFS::StorageFS()
     String strDataPath;
     OTDataFolder::Get(strDataPath);
     m_strDataPath = strDataPath.Get();
+    Lock lock(batch_lock_);
+    replay_journal();
 }
 
 StorageFS::~StorageFS() {}
@@ -0,0 +1,1109 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/OTStorage.hpp"
+
+#include "opentxs/core/util/OTDataFolder.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/Types.hpp"
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#define PACK_FOLDER "pack"
+#define PACK_FILE "objects.pack"
+#define PACK_INDEX_FILE "objects.index"
+#define PACK_FILE_MAGIC "OTDBPACK"
+#define PACK_INDEX_MAGIC "OTDBIDX2"
+#define PACK_MAGIC_SIZE 8
+#define PACK_FILE_HEADER_SIZE 16
+#define PACK_RECORD_MAGIC 0x4b50544f
+#define PACK_RECORD_HEADER_SIZE 13
+#define PACK_RECORD_VALUE 1
+#define PACK_RECORD_ERASED 2
+// The value of a batch record is the total size of the records it contains,
+// which follow it immediately.
+#define PACK_RECORD_BATCH 3
+#define PACK_BATCH_SIZE 8
+// Bytes appended since the last index snapshot before another one is saved.
+// This bounds how much of the pack has to be scanned at startup.
+#define PACK_INDEX_INTERVAL (16 * 1024 * 1024)
+// The pack is compacted once at least this many bytes, and at least half of
+// the file, belong to records which have been replaced or erased.
+#define PACK_COMPACT_MINIMUM (64 * 1024 * 1024)
+
+#define OT_METHOD "opentxs::OTDB::StoragePack::"
+
+namespace opentxs::OTDB
+{
+namespace
+{
+// All integers in the pack and index files are little endian.
+void put_u32(std::string& output, const std::uint32_t value)
+{
+    for (std::size_t i = 0; i < sizeof(value); ++i) {
+        output.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+void put_u64(std::string& output, const std::uint64_t value)
+{
+    for (std::size_t i = 0; i < sizeof(value); ++i) {
+        output.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+std::uint32_t get_u32(const char* input)
+{
+    std::uint32_t output{0};
+
+    for (std::size_t i = 0; i < sizeof(output); ++i) {
+        const auto byte = static_cast<std::uint8_t>(input[i]);
+        output |= static_cast<std::uint32_t>(byte) << (8 * i);
+    }
+
+    return output;
+}
+
+std::uint64_t get_u64(const char* input)
+{
+    std::uint64_t output{0};
+
+    for (std::size_t i = 0; i < sizeof(output); ++i) {
+        const auto byte = static_cast<std::uint8_t>(input[i]);
+        output |= static_cast<std::uint64_t>(byte) << (8 * i);
+    }
+
+    return output;
+}
+}  // namespace
+
+StoragePack::StoragePack()
+    : Storage()
+    , lock_()
+    , m_strDataPath()
+    , pack_path_()
+    , index_path_()
+    , pack_()
+    , generation_(0)
+    , end_(0)
+    , saved_(0)
+    , dead_(0)
+    , index_()
+{
+    String strDataPath;
+    OTDataFolder::Get(strDataPath);
+    m_strDataPath = strDataPath.Get();
+    const std::string folder = m_strDataPath + PACK_FOLDER + "/";
+    pack_path_ = folder + PACK_FILE;
+    index_path_ = folder + PACK_INDEX_FILE;
+    bool notUsed{false};
+    OTPaths::BuildFolderPath(String(folder), notUsed);
+
+    if (false == open_pack()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to open " << pack_path_
+              << std::endl;
+
+        return;
+    }
+
+    Lock lock(lock_);
+    maintain();
+}
+
+bool StoragePack::append(
+    const std::uint8_t type,
+    const std::string& key,
+    const std::string& value)
+{
+    if (false == pack_.is_open()) { return false; }
+
+    std::string record{};
+    encode(type, key, value, record);
+    pack_.clear();
+    pack_.seekp(end_);
+    pack_.write(record.data(), record.size());
+    pack_.flush();
+
+    if (pack_.fail()) {
+        pack_.clear();
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to append " << key
+              << std::endl;
+
+        return false;
+    }
+
+    const auto offset = end_;
+    end_ += record.size();
+    update_index(type, key, offset);
+    maintain();
+
+    return true;
+}
+
+bool StoragePack::Compact()
+{
+    Lock lock(lock_);
+
+    return compact();
+}
+
+bool StoragePack::compact()
+{
+    if (false == pack_.is_open()) { return false; }
+
+    const std::string temp = pack_path_ + ".tmp";
+    std::ofstream output(
+        temp, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (output.fail()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to create " << temp
+              << std::endl;
+
+        return false;
+    }
+
+    const auto generation = generation_ + 1;
+    std::string header(PACK_FILE_MAGIC);
+    put_u64(header, generation);
+    output.write(header.data(), header.size());
+    Index index{};
+    std::uint64_t position{PACK_FILE_HEADER_SIZE};
+    std::string record{};
+
+    for (const auto& [hash, offset] : index_) {
+        std::uint8_t type{0};
+        std::uint32_t keySize{0};
+        std::uint32_t valueSize{0};
+
+        if (false == read_header(offset, type, keySize, valueSize)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Corrupt record at "
+                  << offset << std::endl;
+
+            return false;
+        }
+
+        record.resize(PACK_RECORD_HEADER_SIZE + keySize + valueSize);
+        pack_.clear();
+        pack_.seekg(offset);
+        pack_.read(&record[0], record.size());
+
+        if (pack_.fail()) {
+            pack_.clear();
+
+            return false;
+        }
+
+        output.write(record.data(), record.size());
+        index.emplace(hash, position);
+        position += record.size();
+    }
+
+    output.close();
+
+    if (output.fail() || (false == sync_file(temp))) {
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    pack_.close();
+
+    if (0 != std::rename(temp.c_str(), pack_path_.c_str())) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to replace "
+              << pack_path_ << std::endl;
+        std::remove(temp.c_str());
+        index_.clear();
+        open_pack();
+
+        return false;
+    }
+
+    pack_.open(pack_path_, std::ios::in | std::ios::out | std::ios::binary);
+
+    if (false == pack_.is_open()) { return false; }
+
+    generation_ = generation;
+    end_ = position;
+    dead_ = 0;
+    index_.swap(index);
+    save_index();
+
+    return true;
+}
+
+void StoragePack::encode(
+    const std::uint8_t type,
+    const std::string& key,
+    const std::string& value,
+    std::string& output)
+{
+    output.reserve(
+        output.size() + PACK_RECORD_HEADER_SIZE + key.size() + value.size());
+    put_u32(output, PACK_RECORD_MAGIC);
+    output.push_back(static_cast<char>(type));
+    put_u32(output, static_cast<std::uint32_t>(key.size()));
+    put_u32(output, static_cast<std::uint32_t>(value.size()));
+    output.append(key);
+    output.append(value);
+}
+
+bool StoragePack::Flush()
+{
+    Lock lock(lock_);
+
+    return save_index();
+}
+
+bool StoragePack::Exists(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(key, strFolder, oneStr, twoStr, threeStr)) {
+
+        return false;
+    }
+
+    Lock lock(lock_);
+    Index::iterator it{};
+    std::uint32_t notUsed{0};
+
+    return find(key, it, notUsed);
+}
+
+bool StoragePack::find(
+    const std::string& key,
+    Index::iterator& it,
+    std::uint32_t& valueSize)
+{
+    auto range = index_.equal_range(hash_key(key));
+
+    for (it = range.first; it != range.second; ++it) {
+        std::uint8_t type{0};
+        std::uint32_t keySize{0};
+        std::string existing{};
+
+        if (false == read_header(it->second, type, keySize, valueSize)) {
+            continue;
+        }
+
+        if (keySize != key.size()) { continue; }
+
+        if (false == read_key(it->second, keySize, existing)) { continue; }
+
+        if (existing == key) { return true; }
+    }
+
+    return false;
+}
+
+bool StoragePack::form_key(
+    std::string& key,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) const
+{
+    // Same rules as StorageFS::ConstructAndConfirmPathImp, so that keys are
+    // identical to the relative paths of the legacy tree.
+    const std::string strZero(3 > strFolder.length() ? "" : strFolder);
+    const std::string strOne(3 > oneStr.length() ? "" : oneStr);
+    const std::string strTwo(3 > twoStr.length() ? "" : twoStr);
+    const std::string strThree(3 > threeStr.length() ? "" : threeStr);
+
+    if (strZero.empty() && (0 != strFolder.compare("."))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid folder: \""
+              << strFolder << "\"" << std::endl;
+
+        return false;
+    }
+
+    if (strOne.empty()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Empty: oneStr" << std::endl;
+
+        return false;
+    }
+
+    if (strTwo.empty() && !strThree.empty()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Error: strThree passed in: " << strThree
+              << " while strTwo is empty!" << std::endl;
+
+        return false;
+    }
+
+    key.clear();
+
+    if (false == strZero.empty()) { key += strZero + "/"; }
+
+    key += strOne;
+
+    if (false == strTwo.empty()) { key += "/" + strTwo; }
+
+    if (false == strThree.empty()) { key += "/" + strThree; }
+
+    return true;
+}
+
+std::int64_t StoragePack::FormPathString(
+    std::string& strOutput,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    if (false == form_key(strOutput, strFolder, oneStr, twoStr, threeStr)) {
+
+        return -1;
+    }
+
+    Lock lock(lock_);
+    Index::iterator it{};
+    std::uint32_t valueSize{0};
+
+    if (false == find(strOutput, it, valueSize)) { return 0; }
+
+    return valueSize;
+}
+
+// FNV-1a. The index is saved to disk, so this must not vary between runs.
+std::uint64_t StoragePack::hash_key(const std::string& key)
+{
+    std::uint64_t output{14695981039346656037ULL};
+
+    for (const auto& c : key) {
+        output ^= static_cast<std::uint8_t>(c);
+        output *= 1099511628211ULL;
+    }
+
+    return output;
+}
+
+std::int64_t StoragePack::ImportLegacy()
+{
+    Lock lock(lock_);
+
+    if (false == pack_.is_open()) { return -1; }
+
+    const auto output = import_folder(m_strDataPath, "");
+
+    if (0 <= output) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Imported " << output
+              << " objects from " << m_strDataPath << std::endl;
+    }
+
+    return output;
+}
+
+std::int64_t StoragePack::import_folder(
+    const std::string& root,
+    const std::string& relative)
+{
+#ifdef _WIN32
+    otErr << OT_METHOD << __FUNCTION__
+          << ": Import is not supported on this platform." << std::endl;
+
+    return -1;
+#else
+    const std::string folder = root + relative;
+    DIR* directory = ::opendir(folder.c_str());
+
+    if (nullptr == directory) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to open " << folder
+              << std::endl;
+
+        return -1;
+    }
+
+    std::int64_t output{0};
+    struct dirent* entry{nullptr};
+
+    while (nullptr != (entry = ::readdir(directory))) {
+        const std::string name(entry->d_name);
+
+        if (("." == name) || (".." == name)) { continue; }
+
+        // The pack itself, and the folder used by api::storage::Storage
+        if (relative.empty() &&
+            ((PACK_FOLDER == name) || (OTFolders::Common().Get() == name))) {
+            continue;
+        }
+
+        const std::string path = relative + name;
+        const std::string full = root + path;
+        struct ::stat info;
+
+        if (0 != ::stat(full.c_str(), &info)) { continue; }
+
+        if (S_ISDIR(info.st_mode)) {
+            const auto imported = import_folder(root, path + "/");
+
+            if (0 < imported) { output += imported; }
+
+            continue;
+        }
+
+        if (false == S_ISREG(info.st_mode)) { continue; }
+
+        Index::iterator it{};
+        std::uint32_t notUsed{0};
+
+        if (find(path, it, notUsed)) { continue; }
+
+        std::ifstream file(full, std::ios::in | std::ios::binary);
+        std::stringstream contents{};
+        contents << file.rdbuf();
+
+        if (file.fail() || (false == write(path, contents.str()))) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to import " << full
+                  << std::endl;
+
+            continue;
+        }
+
+        ++output;
+    }
+
+    ::closedir(directory);
+
+    return output;
+#endif
+}
+
+bool StoragePack::load_index()
+{
+    std::ifstream file(index_path_, std::ios::in | std::ios::binary);
+
+    if (false == file.is_open()) { return false; }
+
+    char header[PACK_MAGIC_SIZE + 4 * sizeof(std::uint64_t)];
+    file.read(header, sizeof(header));
+
+    if (file.fail()) { return false; }
+
+    if (0 != std::memcmp(header, PACK_INDEX_MAGIC, PACK_MAGIC_SIZE)) {
+
+        return false;
+    }
+
+    const auto generation = get_u64(header + PACK_MAGIC_SIZE);
+    const auto covered = get_u64(header + PACK_MAGIC_SIZE + 8);
+    const auto dead = get_u64(header + PACK_MAGIC_SIZE + 16);
+    const auto count = get_u64(header + PACK_MAGIC_SIZE + 24);
+
+    if ((generation != generation_) || (covered > end_)) { return false; }
+
+    index_.reserve(count);
+    char entry[2 * sizeof(std::uint64_t)];
+
+    for (std::uint64_t i = 0; i < count; ++i) {
+        file.read(entry, sizeof(entry));
+
+        if (file.fail()) {
+            index_.clear();
+
+            return false;
+        }
+
+        index_.emplace(get_u64(entry), get_u64(entry + 8));
+    }
+
+    saved_ = covered;
+    dead_ = dead;
+    scan(covered);
+
+    return true;
+}
+
+// Called with lock_ held after every write
+void StoragePack::maintain()
+{
+    if ((PACK_COMPACT_MINIMUM <= dead_) && ((2 * dead_) >= end_)) {
+        otWarn << OT_METHOD << __FUNCTION__ << ": Compacting " << pack_path_
+               << " to reclaim " << dead_ << " bytes" << std::endl;
+
+        if (compact()) { return; }
+    }
+
+    if ((end_ - saved_) >= PACK_INDEX_INTERVAL) { save_index(); }
+}
+
+bool StoragePack::onEraseValueByKey(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(key, strFolder, oneStr, twoStr, threeStr)) {
+
+        return false;
+    }
+
+    Lock lock(lock_);
+    Index::iterator it{};
+    std::uint32_t notUsed{0};
+
+    if (false == find(key, it, notUsed)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": " << key << " does not exist"
+              << std::endl;
+
+        return false;
+    }
+
+    return append(PACK_RECORD_ERASED, key, "");
+}
+
+bool StoragePack::onQueryPackedBuffer(
+    PackedBuffer& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+    std::string value{};
+
+    if (false == form_key(key, strFolder, oneStr, twoStr, threeStr)) {
+
+        return false;
+    }
+
+    {
+        Lock lock(lock_);
+
+        if (false == read(key, value)) { return false; }
+    }
+
+    std::istringstream input(value);
+
+    return theBuffer.ReadFromIStream(input, value.size());
+}
+
+bool StoragePack::onQueryPlainString(
+    std::string& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+    theBuffer.clear();
+
+    if (false == form_key(key, strFolder, oneStr, twoStr, threeStr)) {
+
+        return false;
+    }
+
+    Lock lock(lock_);
+
+    if (false == read(key, theBuffer)) { return false; }
+
+    return (theBuffer.length() > 0);
+}
+
+bool StoragePack::onStorePackedBuffer(
+    PackedBuffer& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(key, strFolder, oneStr, twoStr, threeStr)) {
+
+        return false;
+    }
+
+    std::ostringstream output{};
+
+    if (false == theBuffer.WriteToOStream(output)) { return false; }
+
+    Lock lock(lock_);
+
+    return write(key, output.str());
+}
+
+bool StoragePack::onStorePlainString(
+    const std::string& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(key, strFolder, oneStr, twoStr, threeStr)) {
+
+        return false;
+    }
+
+    Lock lock(lock_);
+
+    return write(key, theBuffer);
+}
+
+bool StoragePack::onStoreBatch(const Batch& batch)
+{
+    std::vector<std::pair<std::uint8_t, std::string>> keys{};
+    std::vector<std::uint64_t> positions{};
+    std::string records{};
+
+    for (const auto& entry : batch) {
+        std::string key{};
+
+        const bool formed = form_key(
+            key, entry.folder_, entry.one_, entry.two_, entry.three_);
+
+        if (false == formed) { return false; }
+
+        const std::uint8_t type =
+            entry.erase_ ? PACK_RECORD_ERASED : PACK_RECORD_VALUE;
+        positions.push_back(records.size());
+        encode(type, key, entry.erase_ ? "" : entry.value_, records);
+        keys.emplace_back(type, key);
+    }
+
+    std::string size{};
+    put_u64(size, records.size());
+    std::string group{};
+    encode(PACK_RECORD_BATCH, "", size, group);
+    const auto header = group.size();
+    group.append(records);
+    Lock lock(lock_);
+
+    if (false == pack_.is_open()) { return false; }
+
+    pack_.clear();
+    pack_.seekp(end_);
+    pack_.write(group.data(), group.size());
+    pack_.flush();
+
+    if (pack_.fail() || (false == sync())) {
+        pack_.clear();
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to append a batch of "
+              << batch.size() << " records" << std::endl;
+
+        return false;
+    }
+
+    const auto start = end_ + header;
+    end_ += group.size();
+    dead_ += header;
+
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        update_index(keys[i].first, keys[i].second, start + positions[i]);
+    }
+
+    maintain();
+
+    return true;
+}
+
+bool StoragePack::open_pack()
+{
+    std::int64_t size{0};
+
+    if (false == OTPaths::FileExists(String(pack_path_), size)) {
+        std::ofstream create(
+            pack_path_, std::ios::out | std::ios::binary | std::ios::trunc);
+        std::random_device random{};
+        const std::uint64_t generation =
+            (static_cast<std::uint64_t>(random()) << 32) | random();
+        std::string header(PACK_FILE_MAGIC);
+        put_u64(header, generation);
+        create.write(header.data(), header.size());
+        create.close();
+
+        if (create.fail()) { return false; }
+    }
+
+    pack_.open(pack_path_, std::ios::in | std::ios::out | std::ios::binary);
+
+    if (false == pack_.is_open()) { return false; }
+
+    char header[PACK_FILE_HEADER_SIZE];
+    pack_.seekg(0, std::ios::end);
+    end_ = static_cast<std::uint64_t>(pack_.tellg());
+    pack_.seekg(0);
+    pack_.read(header, sizeof(header));
+
+    if (pack_.fail() ||
+        (0 != std::memcmp(header, PACK_FILE_MAGIC, PACK_MAGIC_SIZE))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": " << pack_path_
+              << " is not a pack file" << std::endl;
+        pack_.close();
+
+        return false;
+    }
+
+    generation_ = get_u64(header + PACK_MAGIC_SIZE);
+
+    if (false == load_index()) {
+        index_.clear();
+        saved_ = 0;
+        dead_ = 0;
+        scan(PACK_FILE_HEADER_SIZE);
+    }
+
+    return true;
+}
+
+bool StoragePack::read(const std::string& key, std::string& value)
+{
+    Index::iterator it{};
+    std::uint32_t valueSize{0};
+
+    if (false == find(key, it, valueSize)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failure reading from " << key
+              << ": does not exist." << std::endl;
+
+        return false;
+    }
+
+    value.resize(valueSize);
+
+    if (0 == valueSize) { return true; }
+
+    pack_.clear();
+    pack_.seekg(it->second + PACK_RECORD_HEADER_SIZE + key.size());
+    pack_.read(&value[0], valueSize);
+
+    if (pack_.fail()) {
+        pack_.clear();
+        value.clear();
+
+        return false;
+    }
+
+    return true;
+}
+
+bool StoragePack::read_header(
+    const std::uint64_t offset,
+    std::uint8_t& type,
+    std::uint32_t& keySize,
+    std::uint32_t& valueSize)
+{
+    char header[PACK_RECORD_HEADER_SIZE];
+    pack_.clear();
+    pack_.seekg(offset);
+    pack_.read(header, sizeof(header));
+
+    if (pack_.fail()) {
+        pack_.clear();
+
+        return false;
+    }
+
+    if (PACK_RECORD_MAGIC != get_u32(header)) { return false; }
+
+    type = static_cast<std::uint8_t>(header[4]);
+    keySize = get_u32(header + 5);
+    valueSize = get_u32(header + 9);
+
+    return (PACK_RECORD_VALUE == type) || (PACK_RECORD_ERASED == type) ||
+           (PACK_RECORD_BATCH == type);
+}
+
+bool StoragePack::read_key(
+    const std::uint64_t offset,
+    const std::uint32_t keySize,
+    std::string& key)
+{
+    key.resize(keySize);
+
+    if (0 == keySize) { return true; }
+
+    pack_.clear();
+    pack_.seekg(offset + PACK_RECORD_HEADER_SIZE);
+    pack_.read(&key[0], keySize);
+
+    if (pack_.fail()) {
+        pack_.clear();
+
+        return false;
+    }
+
+    return true;
+}
+
+bool StoragePack::save_index()
+{
+    if (false == pack_.is_open()) { return false; }
+
+    const std::string temp = index_path_ + ".tmp";
+    std::ofstream file(
+        temp, std::ios::out | std::ios::binary | std::ios::trunc);
+    std::string buffer(PACK_INDEX_MAGIC);
+    put_u64(buffer, generation_);
+    put_u64(buffer, end_);
+    put_u64(buffer, dead_);
+    put_u64(buffer, index_.size());
+    file.write(buffer.data(), buffer.size());
+
+    for (const auto& [hash, offset] : index_) {
+        buffer.clear();
+        put_u64(buffer, hash);
+        put_u64(buffer, offset);
+        file.write(buffer.data(), buffer.size());
+    }
+
+    file.close();
+
+    // A snapshot which was renamed into place before its contents reached the
+    // disk could hide records after a crash, so it is synced first.
+    if (file.fail() || (false == sync_file(temp)) ||
+        (0 != std::rename(temp.c_str(), index_path_.c_str()))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to save "
+              << index_path_ << std::endl;
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    saved_ = end_;
+
+    return true;
+}
+
+void StoragePack::scan(const std::uint64_t from)
+{
+    std::uint64_t offset{from};
+    std::string key{};
+
+    while (offset + PACK_RECORD_HEADER_SIZE <= end_) {
+        std::uint8_t type{0};
+        std::uint32_t keySize{0};
+        std::uint32_t valueSize{0};
+
+        if (false == read_header(offset, type, keySize, valueSize)) { break; }
+
+        if (PACK_RECORD_BATCH == type) {
+            std::uint64_t next{0};
+
+            if (false == scan_batch(offset, keySize, valueSize, next)) {
+                break;
+            }
+
+            offset = next;
+
+            continue;
+        }
+
+        const auto next =
+            offset + PACK_RECORD_HEADER_SIZE + keySize + valueSize;
+
+        if (next > end_) { break; }
+
+        if (false == read_key(offset, keySize, key)) { break; }
+
+        update_index(type, key, offset);
+        offset = next;
+    }
+
+    if (offset == end_) { return; }
+
+    // A record was only partially written, most likely due to a crash.
+    otErr << OT_METHOD << __FUNCTION__ << ": Discarding " << (end_ - offset)
+          << " bytes of incomplete records from " << pack_path_ << std::endl;
+    end_ = offset;
+#ifndef _WIN32
+    pack_.flush();
+
+    if (0 != ::truncate(pack_path_.c_str(), static_cast<off_t>(end_))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to truncate "
+              << pack_path_ << std::endl;
+    }
+#endif
+}
+
+// Indexes the records of a batch only if every one of them is intact, so that
+// a batch interrupted by a crash is discarded as a whole.
+bool StoragePack::scan_batch(
+    const std::uint64_t offset,
+    const std::uint32_t keySize,
+    const std::uint32_t valueSize,
+    std::uint64_t& next)
+{
+    if ((0 != keySize) || (PACK_BATCH_SIZE != valueSize)) { return false; }
+
+    const auto first = offset + PACK_RECORD_HEADER_SIZE;
+
+    if (first + PACK_BATCH_SIZE > end_) { return false; }
+
+    char size[PACK_BATCH_SIZE];
+    pack_.clear();
+    pack_.seekg(first);
+    pack_.read(size, sizeof(size));
+
+    if (pack_.fail()) {
+        pack_.clear();
+
+        return false;
+    }
+
+    const auto last = first + PACK_BATCH_SIZE + get_u64(size);
+
+    if (last > end_) { return false; }
+
+    std::vector<std::tuple<std::uint8_t, std::string, std::uint64_t>>
+        records{};
+    std::uint64_t position{first + PACK_BATCH_SIZE};
+
+    while (position < last) {
+        std::uint8_t type{0};
+        std::uint32_t innerKeySize{0};
+        std::uint32_t innerValueSize{0};
+        std::string key{};
+
+        if (false ==
+            read_header(position, type, innerKeySize, innerValueSize)) {
+
+            return false;
+        }
+
+        if (PACK_RECORD_BATCH == type) { return false; }
+
+        const auto end =
+            position + PACK_RECORD_HEADER_SIZE + innerKeySize + innerValueSize;
+
+        if (end > last) { return false; }
+
+        if (false == read_key(position, innerKeySize, key)) { return false; }
+
+        records.emplace_back(type, key, position);
+        position = end;
+    }
+
+    for (const auto& [type, key, location] : records) {
+        update_index(type, key, location);
+    }
+
+    dead_ += PACK_RECORD_HEADER_SIZE + PACK_BATCH_SIZE;
+    next = last;
+
+    return true;
+}
+
+// fsync applies to the file rather than the descriptor, so a separate
+// descriptor is enough to flush what pack_ has written.
+bool StoragePack::sync() { return sync_file(pack_path_); }
+
+bool StoragePack::sync_file(const std::string& path)
+{
+#ifdef _WIN32
+    return true;
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (-1 == fd) { return false; }
+
+    const bool output = (0 == ::fsync(fd));
+    ::close(fd);
+
+    return output;
+#endif
+}
+
+void StoragePack::update_index(
+    const std::uint8_t type,
+    const std::string& key,
+    const std::uint64_t offset)
+{
+    Index::iterator it{};
+    std::uint32_t valueSize{0};
+    const bool exists = find(key, it, valueSize);
+
+    // The record being replaced, and any tombstone, can be compacted away
+    if (exists) { dead_ += PACK_RECORD_HEADER_SIZE + key.size() + valueSize; }
+
+    if (PACK_RECORD_ERASED == type) {
+        dead_ += PACK_RECORD_HEADER_SIZE + key.size();
+
+        if (exists) { index_.erase(it); }
+
+        return;
+    }
+
+    if (exists) {
+        it->second = offset;
+    } else {
+        index_.emplace(hash_key(key), offset);
+    }
+}
+
+bool StoragePack::write(const std::string& key, const std::string& value)
+{
+    return append(PACK_RECORD_VALUE, key, value);
+}
+
+StoragePack::~StoragePack()
+{
+    Lock lock(lock_);
+    save_index();
+    pack_.close();
+}
+}  // namespace opentxs::OTDB
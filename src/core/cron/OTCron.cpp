@@ -42,6 +42,7 @@
 
 #include "opentxs/core/cron/OTCronItem.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
+#include "opentxs/core/crypto/OTSignedFile.hpp"
 #include "opentxs/core/trade/OTMarket.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
@@ -53,18 +54,96 @@
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/Nym.hpp"
 #include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/OTStringXML.hpp"
 #include "opentxs/core/String.hpp"
 
+#include "core/util/Workers.hpp"
+
 #include <irrxml/irrXML.hpp>
 #include <string.h>
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <ostream>
+#include <set>
+#include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+namespace
+{
+const char* const CRON_INDEX_FILE = "OT-CRON.idx";
+const char* const CRON_ITEM_FOLDER = "items";
+const char* const CRON_JOURNAL_FOLDER = "journal";
+
+std::string item_filename(const std::int64_t number)
+{
+    return std::to_string(number) + ".itm";
+}
+
+// The index and the journal entries are wrapped in a file signed by the server
+// Nym. The file names its own location, so an entry can't be moved to another
+// slot either.
+opentxs::String signed_location(
+    const std::string& one,
+    const std::string& two)
+{
+    if (two.empty()) { return opentxs::String(one); }
+
+    return opentxs::String(one + opentxs::Log::PathSeparator() + two);
+}
+
+bool load_signed(
+    const opentxs::Nym& nym,
+    std::string& output,
+    const std::string& folder,
+    const std::string& one,
+    const std::string& two = "")
+{
+    opentxs::OTSignedFile file;
+    file.SetFilename(opentxs::String(folder), signed_location(one, two));
+    const opentxs::String serialized(
+        opentxs::OTDB::QueryPlainString(folder, one, two));
+
+    if (false == serialized.Exists() ||
+        false == file.LoadContractFromString(serialized) ||
+        false == file.VerifyFile() || false == file.VerifySignature(nym)) {
+
+        return false;
+    }
+
+    output = file.GetFilePayload().Get();
+
+    return true;
+}
+
+bool store_signed(
+    const opentxs::Nym& nym,
+    const std::string& contents,
+    const std::string& folder,
+    const std::string& one,
+    const std::string& two = "")
+{
+    opentxs::OTSignedFile file;
+    file.SetFilename(opentxs::String(folder), signed_location(one, two));
+    file.SetFilePayload(opentxs::String(contents));
+    opentxs::String serialized;
+
+    if (false == file.SignContract(nym) || false == file.SaveContract() ||
+        false == file.SaveContractRaw(serialized)) {
+
+        return false;
+    }
+
+    return opentxs::OTDB::StorePlainString(
+        serialized.Get(), folder, one, two);
+}
+}  // namespace
 
 namespace opentxs
 {
@@ -85,6 +164,10 @@ std::int32_t OTCron::__cron_max_items_per_nym =
          // items any given Nym can have
          // active at the same time.
 
+std::int32_t OTCron::__cron_worker_threads = 0;  // The maximum number of
+                                                 // threads processing cron
+                                                 // items. 0 means one per core.
+
 Timer OTCron::tCron(true);
 
 // Make sure Server Nym is set on this cron object before loading or saving,
@@ -97,20 +180,365 @@ bool OTCron::LoadCron()
 
     OT_ASSERT(nullptr != GetServerNym());
 
+    legacy_items_ = false;
     bool bSuccess = LoadContract(szFoldername, szFilename);
 
     if (bSuccess) bSuccess = VerifySignature(*(GetServerNym()));
 
+    if (bSuccess) bSuccess = load_items();
+
+    // Older cron files contain the items themselves. Those are moved out to
+    // their own records, and the cron file is saved without them.
+    if (bSuccess && legacy_items_) bSuccess = migrate_items();
+
     return bSuccess;
 }
 
 bool OTCron::SaveCron()
 {
-    const char* szFoldername = OTFolders::Cron().Get();
-    const char* szFilename = "OT-CRON.crn";  // todo stop hardcoding filenames.
-
     OT_ASSERT(nullptr != GetServerNym());
 
+    if (defer_save_.load()) {
+        // ProcessCronItems saves once, after every item has been processed.
+        save_deferred_.store(true);
+
+        return true;
+    }
+
+    return write_cron();
+}
+
+bool OTCron::SaveCronItem(OTCronItem& theItem)
+{
+    const auto it = m_mapDateAdded.find(theItem.GetTransactionNum());
+
+    if (m_mapDateAdded.end() == it) {
+        otErr << "OTCron::" << __FUNCTION__
+              << ": Item is not on the cron list: "
+              << theItem.GetTransactionNum() << "\n";
+
+        return false;
+    }
+
+    if (false == save_item(theItem, it->second)) { return false; }
+
+    return journal_numbers();
+}
+
+// Rewrites the index from the items in memory, which already reflect every
+// journal entry, and then discards those entries.
+bool OTCron::compact(const Lock& lock)
+{
+    OT_ASSERT(lock.mutex() == &journal_lock_)
+
+    // The numbers taken since the cron file was written are only recorded in
+    // the journal entries about to be discarded. The cron file isn't written
+    // while the workers of a round are running, so compaction waits.
+    if (numbers_journaled_) {
+        if (defer_save_.load()) { return true; }
+
+        if (false == write_cron()) { return false; }
+    }
+
+    numbers_journaled_ = false;
+    const std::string strFoldername = OTFolders::Cron().Get();
+    std::ostringstream index{};
+    index << journal_next_ << "\n";
+
+    for (const auto& it : m_mapCronItems) { index << it.first << "\n"; }
+
+    if (false == store_signed(
+                     *m_pServerNym,
+                     index.str(),
+                     strFoldername,
+                     CRON_INDEX_FILE)) {
+        otErr << "OTCron::" << __FUNCTION__ << ": Error saving cron index.\n";
+
+        return false;
+    }
+
+    for (auto entry = journal_first_; entry < journal_next_; ++entry) {
+        OTDB::EraseValueByKey(
+            strFoldername, CRON_JOURNAL_FOLDER, std::to_string(entry));
+    }
+
+    journal_first_ = journal_next_;
+
+    return true;
+}
+
+bool OTCron::erase_item(const std::int64_t number)
+{
+    m_mapDateAdded.erase(number);
+
+    if (false == journal('-', number)) { return false; }
+
+    if (false == OTDB::EraseValueByKey(
+                     OTFolders::Cron().Get(),
+                     CRON_ITEM_FOLDER,
+                     item_filename(number))) {
+        otErr << "OTCron::" << __FUNCTION__
+              << ": Error erasing cron item record: " << number << "\n";
+
+        return false;
+    }
+
+    return true;
+}
+
+// type is '+' for an added item, '-' for a removed item, or '#' for a number
+// taken from m_listTransactionNumbers.
+bool OTCron::journal(const char type, const std::int64_t number)
+{
+    Lock lock(journal_lock_);
+    const std::string entry = type + std::to_string(number);
+
+    if (false == store_signed(
+                     *m_pServerNym,
+                     entry,
+                     OTFolders::Cron().Get(),
+                     CRON_JOURNAL_FOLDER,
+                     std::to_string(journal_next_))) {
+        otErr << "OTCron::" << __FUNCTION__
+              << ": Error saving cron journal entry " << journal_next_
+              << "\n";
+
+        return false;
+    }
+
+    ++journal_next_;
+
+    if ('#' == type) { numbers_journaled_ = true; }
+
+    if ((journal_next_ - journal_first_) < __cron_journal_compact) {
+
+        return true;
+    }
+
+    return compact(lock);
+}
+
+// Outside of a cron round, the numbers taken from the list are journaled
+// instead of rewriting the cron file. A round journals them once it ends.
+bool OTCron::journal_numbers()
+{
+    if (defer_save_.load()) { return true; }
+
+    std::vector<std::int64_t> taken{};
+    Lock lock(number_lock_);
+    taken.swap(taken_numbers_);
+    lock.unlock();
+
+    for (const auto& number : taken) {
+        if (false == journal('#', number)) {
+            // The cron file reflects every number taken so far
+            return write_cron();
+        }
+    }
+
+    return true;
+}
+
+bool OTCron::load_item(const String& strData, const time64_t tDateAdded)
+{
+    OTCronItem* pItem = OTCronItem::NewCronItem(strData);
+
+    if (nullptr == pItem) {
+        otErr << "Unable to create cron item from data in cron file.\n";
+        return false;
+    }
+
+    // Why not do this here (when loading from storage), as well as when
+    // first adding the item to cron,
+    // and thus save myself the trouble of verifying the signature EVERY
+    // ITERATION of ProcessCron().
+    //
+    if (!pItem->VerifySignature(*m_pServerNym)) {
+        otErr << "OTCron::" << __FUNCTION__
+              << ": ERROR SECURITY: Server signature failed to "
+                 "verify on a cron item while loading: "
+              << pItem->GetTransactionNum() << "\n";
+        delete pItem;
+        pItem = nullptr;
+        return false;
+    } else if (AddCronItem(
+                   *pItem,
+                   nullptr,
+                   false,          // bSaveReceipt=false. The receipt is
+                                   // only saved once: When item FIRST
+                                   // added to cron...
+                   tDateAdded)) {  // ...But here, the item was
+                                   // ALREADY in cron, and is
+                                   // merely being loaded from
+                                   // disk.
+        // Thus, it would be wrong to try to create the "original
+        // record" as if it were brand
+        // new and still had the user's signature on it. (Once added to
+        // Cron, the signatures are
+        // released and the SERVER signs it from there. That's why the
+        // user's version is saved
+        // as a receipt in the first place -- so we have a record of the
+        // user's authorization.)
+        otInfo << "Successfully loaded cron item and added to list.\n";
+    } else {
+        otErr << "OTCron::" << __FUNCTION__
+              << ": Though loaded / verified successfully, unable to add "
+                 "cron item to cron list.\n";
+        delete pItem;
+        pItem = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+// Replays the journal over the last index to find the active items, then
+// loads each one from its record.
+bool OTCron::load_items()
+{
+    Lock lock(journal_lock_);
+    const std::string strFoldername = OTFolders::Cron().Get();
+    std::set<std::int64_t> numbers{};
+    std::set<std::int64_t> taken{};
+    journal_first_ = 0;
+
+    if (OTDB::Exists(strFoldername, CRON_INDEX_FILE)) {
+        std::string contents{};
+        std::int64_t number{0};
+
+        if (false == load_signed(
+                         *m_pServerNym,
+                         contents,
+                         strFoldername,
+                         CRON_INDEX_FILE)) {
+            otErr << "OTCron::" << __FUNCTION__
+                  << ": ERROR SECURITY: Cron index failed to verify.\n";
+
+            return false;
+        }
+
+        std::istringstream index(contents);
+
+        if (false == bool(index >> journal_first_)) {
+            otErr << "OTCron::" << __FUNCTION__
+                  << ": Error reading cron index.\n";
+
+            return false;
+        }
+
+        while (index >> number) { numbers.insert(number); }
+    }
+
+    for (journal_next_ = journal_first_; OTDB::Exists(
+             strFoldername,
+             CRON_JOURNAL_FOLDER,
+             std::to_string(journal_next_));
+         ++journal_next_) {
+        std::string entry{};
+
+        if (false == load_signed(
+                         *m_pServerNym,
+                         entry,
+                         strFoldername,
+                         CRON_JOURNAL_FOLDER,
+                         std::to_string(journal_next_))) {
+            otErr << "OTCron::" << __FUNCTION__
+                  << ": ERROR SECURITY: Cron journal entry " << journal_next_
+                  << " failed to verify.\n";
+
+            return false;
+        }
+
+        const std::int64_t number =
+            (1 < entry.size()) ? String::StringToLong(entry.substr(1)) : 0;
+
+        if ((0 < number) && ('+' == entry[0])) {
+            numbers.insert(number);
+        } else if ((0 < number) && ('-' == entry[0])) {
+            numbers.erase(number);
+        } else if ((0 < number) && ('#' == entry[0])) {
+            taken.insert(number);
+        } else {
+            otErr << "OTCron::" << __FUNCTION__
+                  << ": Invalid cron journal entry " << journal_next_ << "\n";
+
+            return false;
+        }
+    }
+
+    // The cron file may predate some of the numbers being taken
+    numbers_journaled_ = (false == taken.empty());
+    lock.unlock();
+    Lock numberLock(number_lock_);
+    m_listTransactionNumbers.remove_if(
+        [&](const std::int64_t number) { return 0 < taken.count(number); });
+    numberLock.unlock();
+
+    for (const auto& number : numbers) {
+        // Already loaded from an older cron file.
+        if (nullptr != GetItemByOfficialNum(number)) { continue; }
+
+        const auto strFilename = item_filename(number);
+        const String strRecord(OTDB::QueryPlainString(
+            strFoldername, CRON_ITEM_FOLDER, strFilename));
+        const std::string record(strRecord.Get());
+        const auto split = record.find('\n');
+
+        if (std::string::npos == split) {
+            otErr << "OTCron::" << __FUNCTION__
+                  << ": Missing or invalid cron item record: " << strFoldername
+                  << Log::PathSeparator() << CRON_ITEM_FOLDER
+                  << Log::PathSeparator() << strFilename << "\n";
+
+            return false;
+        }
+
+        const time64_t tDateAdded =
+            OTTimeGetTimeFromSeconds(parseTimestamp(record.substr(0, split)));
+        OTASCIIArmor ascItem;
+        ascItem.Set(record.substr(split + 1).c_str());
+        String strData;
+
+        if (!ascItem.GetString(strData) || !strData.Exists() ||
+            !load_item(strData, tDateAdded)) {
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool OTCron::migrate_items()
+{
+    for (auto& it : m_multimapCronItems) {
+        OTCronItem* pItem = it.second;
+        OT_ASSERT(nullptr != pItem);
+
+        if (false == save_item(*pItem, it.first)) { return false; }
+    }
+
+    Lock lock(journal_lock_);
+
+    if (false == compact(lock)) { return false; }
+
+    lock.unlock();
+    legacy_items_ = false;
+    otOut << "OTCron::" << __FUNCTION__ << ": Moved "
+          << m_multimapCronItems.size()
+          << " cron items out of the cron file.\n";
+
+    return SaveCron();
+}
+
+bool OTCron::write_cron()
+{
+    const char* szFoldername = OTFolders::Cron().Get();
+    const char* szFilename = "OT-CRON.crn";  // todo stop hardcoding filenames.
+    std::vector<std::int64_t> taken{};
+    Lock lock(number_lock_);
+    taken.swap(taken_numbers_);
+    lock.unlock();
     ReleaseSignatures();
 
     // Sign it, save it internally to string, and then save that out to the
@@ -119,9 +547,36 @@ bool OTCron::SaveCron()
         !SaveContract(szFoldername, szFilename)) {
         otErr << "Error saving main Cronfile:\n"
               << szFoldername << Log::PathSeparator() << szFilename << "\n";
+        lock.lock();
+        taken_numbers_.insert(
+            taken_numbers_.begin(), taken.begin(), taken.end());
+
         return false;
-    } else
-        return true;
+    }
+
+    return true;
+}
+
+bool OTCron::save_item(OTCronItem& theItem, const time64_t tDateAdded)
+{
+    const String strItem(theItem);
+    const OTASCIIArmor ascItem(strItem);
+    const std::string record =
+        formatTimestamp(tDateAdded) + "\n" + ascItem.Get();
+    const auto strFilename = item_filename(theItem.GetTransactionNum());
+
+    if (false == OTDB::StorePlainString(
+                     record,
+                     OTFolders::Cron().Get(),
+                     CRON_ITEM_FOLDER,
+                     strFilename)) {
+        otErr << "OTCron::" << __FUNCTION__
+              << ": Error saving cron item record: " << strFilename << "\n";
+
+        return false;
+    }
+
+    return true;
 }
 
 // Loops through ALL markets, and calls pMarket->GetNym_OfferList(NYM_ID,
@@ -336,6 +791,8 @@ bool OTCron::GetMarketList(OTASCIIArmor& ascOutput, std::int32_t& nMarketCount)
 
 std::int32_t OTCron::GetTransactionCount() const
 {
+    Lock lock(number_lock_);
+
     if (m_listTransactionNumbers.empty()) return 0;
 
     return static_cast<std::int32_t>(m_listTransactionNumbers.size());
@@ -343,6 +800,7 @@ std::int32_t OTCron::GetTransactionCount() const
 
 void OTCron::AddTransactionNumber(const std::int64_t& lTransactionNum)
 {
+    Lock lock(number_lock_);
     m_listTransactionNumbers.push_back(lTransactionNum);
 }
 
@@ -350,11 +808,14 @@ void OTCron::AddTransactionNumber(const std::int64_t& lTransactionNum)
 // payment plans until the server object replenishes this list.
 std::int64_t OTCron::GetNextTransactionNumber()
 {
+    Lock lock(number_lock_);
+
     if (m_listTransactionNumbers.empty()) return 0;
 
     std::int64_t lTransactionNum = m_listTransactionNumbers.front();
 
     m_listTransactionNumbers.pop_front();
+    taken_numbers_.push_back(lTransactionNum);
 
     return lTransactionNum;
 }
@@ -413,57 +874,11 @@ std::int32_t OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
             otErr << "Error in OTCron::ProcessXMLNode: cronItem field without "
                      "value.\n";
             return (-1);  // error condition
-        } else {
-            OTCronItem* pItem = OTCronItem::NewCronItem(strData);
-
-            if (nullptr == pItem) {
-                otErr << "Unable to create cron item from data in cron file.\n";
-                return (-1);
-            }
-
-            // Why not do this here (when loading from storage), as well as when
-            // first adding the item to cron,
-            // and thus save myself the trouble of verifying the signature EVERY
-            // ITERATION of ProcessCron().
-            //
-            if (!pItem->VerifySignature(*m_pServerNym)) {
-                otErr << "OTCron::ProcessXMLNode: ERROR SECURITY: Server "
-                         "signature failed to "
-                         "verify on a cron item while loading: "
-                      << pItem->GetTransactionNum() << "\n";
-                delete pItem;
-                pItem = nullptr;
-                return (-1);
-            } else if (AddCronItem(
-                           *pItem,
-                           nullptr,
-                           false,          // bSaveReceipt=false. The receipt is
-                                           // only saved once: When item FIRST
-                                           // added to cron...
-                           tDateAdded)) {  // ...But here, the item was
-                                           // ALREADY in cron, and is
-                                           // merely being loaded from
-                                           // disk.
-                // Thus, it would be wrong to try to create the "original
-                // record" as if it were brand
-                // new and still had the user's signature on it. (Once added to
-                // Cron, the signatures are
-                // released and the SERVER signs it from there. That's why the
-                // user's version is saved
-                // as a receipt in the first place -- so we have a record of the
-                // user's authorization.)
-                otInfo << "Successfully loaded cron item and added to list.\n";
-            } else {
-                otErr << "OTCron::ProcessXMLNode: Though loaded / verified "
-                         "successfully, "
-                         "unable to add cron item (from cron file) to cron "
-                         "list.\n";
-                delete pItem;
-                pItem = nullptr;
-                return (-1);
-            }
+        } else if (!load_item(strData, tDateAdded)) {
+            return (-1);
         }
 
+        legacy_items_ = true;
         nReturnVal = 1;
     } else if (!strcmp("market", xml->getNodeName())) {
         const String strMarketID(xml->getAttributeValue("marketID"));
@@ -546,29 +961,19 @@ void OTCron::UpdateContents()
         tag.add_tag(tagMarket);
     }
 
-    // Save the Cron Items
-    for (auto& it : m_multimapCronItems) {
-        OTCronItem* pItem = it.second;
-        OT_ASSERT(nullptr != pItem);
-
-        time64_t tDateAdded = it.first;
-        String strItem(*pItem);  // Extract the cron item contract into string
-                                 // form.
-        OTASCIIArmor ascItem(strItem);  // Base64-encode that for storage.
-
-        TagPtr tagCronItem(new Tag("cronItem", ascItem.Get()));
-        tagCronItem->add_attribute("dateAdded", formatTimestamp(tDateAdded));
-        tag.add_tag(tagCronItem);
-    }
+    // The Cron Items are saved in their own records. (See save_item.)
 
     // Save the transaction numbers.
     //
+    Lock numberLock(number_lock_);
+
     for (auto& lTransactionNumber : m_listTransactionNumbers) {
         TagPtr tagNumber(new Tag("transactionNum"));
         tagNumber->add_attribute("value", formatLong(lTransactionNumber));
         tag.add_tag(tagNumber);
     }  // for
 
+    numberLock.unlock();
     std::string str_result;
     tag.output(str_result);
 
@@ -608,52 +1013,159 @@ void OTCron::ProcessCronItems()
                  "ROUND!!!\n\n";
         return;
     }
-    bool bNeedToSave = false;
+    defer_save_.store(true);
+    save_deferred_.store(false);
+    std::vector<multimapOfCronItems::iterator> ordered{};
+    std::vector<std::vector<std::size_t>> groups{};
+    std::vector<std::size_t> exclusive{};
+    partition_items(ordered, groups, exclusive);
+    // Marks the items whose ProcessCron returned false. Each entry is only
+    // written by the thread processing that item.
+    std::vector<char> finished(ordered.size(), 0);
+    std::atomic<bool> exhausted{false};
+
+    // Returns false once cron is low on transaction numbers, which ends the
+    // round on every thread.
+    auto process = [&](const std::size_t index) -> bool {
+        if (exhausted.load()) { return false; }
 
-    // loop through the cron items and tell each one to ProcessCron().
-    // If the item returns true, that means leave it on the list. Otherwise,
-    // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
         if (GetTransactionCount() <= nTwentyPercent) {
-            otErr << "WARNING: Cron has fewer than 20 percent of its normal "
-                     "transaction "
-                     "number count available since the previous cron item "
-                     "alone! \n"
-                     "That is, "
-                  << GetTransactionCount()
-                  << " are currently available, with a max of "
-                  << OTCron::GetCronRefillAmount() << ", meaning "
-                  << OTCron::GetCronRefillAmount() - GetTransactionCount()
-                  << " were used in the current round alone!!! \n"
-                     "SKIPPING THE REMAINDER OF THE CRON ITEMS THAT WERE "
-                     "SCHEDULED FOR THIS ROUND!!!\n\n";
-            break;
+            if (false == exhausted.exchange(true)) {
+                otErr << "WARNING: Cron has fewer than 20 percent of its "
+                         "normal transaction number count available since the "
+                         "previous cron item alone! \n"
+                         "That is, "
+                      << GetTransactionCount()
+                      << " are currently available, with a max of "
+                      << OTCron::GetCronRefillAmount() << ", meaning "
+                      << OTCron::GetCronRefillAmount() - GetTransactionCount()
+                      << " were used in the current round alone!!! \n"
+                         "SKIPPING THE REMAINDER OF THE CRON ITEMS THAT WERE "
+                         "SCHEDULED FOR THIS ROUND!!!\n\n";
+            }
+
+            return false;
         }
-        OTCronItem* pItem = it->second;
+
+        OTCronItem* pItem = ordered[index]->second;
         OT_ASSERT(nullptr != pItem);
-        otInfo << "OTCron::" << __FUNCTION__
-               << ": Processing item number: " << pItem->GetTransactionNum()
-               << " \n";
+        otInfo << "OTCron::ProcessCronItems: Processing item number: "
+               << pItem->GetTransactionNum() << " \n";
 
-        if (pItem->ProcessCron()) {
-            it++;
-            continue;
+        // If the item returns true, that means leave it on the list.
+        // Otherwise, if it returns false, that means "it's done: remove it."
+        if (false == pItem->ProcessCron()) { finished[index] = 1; }
+
+        return true;
+    };
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() -> void {
+        for (auto group = next++; group < groups.size(); group = next++) {
+            for (const auto& index : groups[group]) {
+                if (false == process(index)) { return; }
+            }
         }
+    };
+
+    const std::size_t threads =
+        (0 < __cron_worker_threads)
+            ? static_cast<std::size_t>(__cron_worker_threads)
+            : WorkerThreads();
+    RunWorkers(std::min(threads, groups.size()), worker);
+
+    for (const auto& index : exclusive) {
+        if (false == process(index)) { break; }
+    }
+
+    // Removal changes the item lists, so it happens after all the workers
+    // have finished, in the order the items were added.
+
+    for (std::size_t index = 0; index < ordered.size(); ++index) {
+        if (0 == finished[index]) { continue; }
+
+        OTCronItem* pItem = ordered[index]->second;
+        const auto lTransactionNum = pItem->GetTransactionNum();
         pItem->HookRemovalFromCron(nullptr, GetNextTransactionNumber());
         otOut << "OTCron::" << __FUNCTION__
               << ": Removing cron item: " << pItem->GetTransactionNum() << "\n";
-        it = m_multimapCronItems.erase(it);
+        m_multimapCronItems.erase(ordered[index]);
         auto it_map = FindItemOnMap(pItem->GetTransactionNum());
         OT_ASSERT(m_mapCronItems.end() != it_map);
         m_mapCronItems.erase(it_map);
 
         delete pItem;
         pItem = nullptr;
+        erase_item(lTransactionNum);
+    }
+
+    defer_save_.store(false);
 
-        bNeedToSave = true;
+    // The removal hooks only took transaction numbers, which are journaled.
+    // The cron file is rewritten if something else asked for a save.
+    if (save_deferred_.exchange(false)) {
+        SaveCron();
+    } else {
+        journal_numbers();
+    }
+}
+
+// Every item with a footprint joins the group of any earlier item it shares a
+// key with (union-find over the item positions.) Groups and the items within
+// them keep the order the items were added in.
+void OTCron::partition_items(
+    std::vector<multimapOfCronItems::iterator>& ordered,
+    std::vector<std::vector<std::size_t>>& groups,
+    std::vector<std::size_t>& exclusive)
+{
+    std::vector<std::size_t> parent{};
+    std::vector<char> isExclusive{};
+    std::map<std::string, std::size_t> owner{};
+    const auto root = [&parent](std::size_t index) -> std::size_t {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+
+        return index;
+    };
+
+    for (auto it = m_multimapCronItems.begin(); it != m_multimapCronItems.end();
+         ++it) {
+        const auto index = ordered.size();
+        ordered.push_back(it);
+        parent.push_back(index);
+        OTCronItem* pItem = it->second;
+        OT_ASSERT(nullptr != pItem);
+        std::set<std::string> footprint{};
+        const bool known = pItem->GetFootprint(footprint);
+        isExclusive.push_back(known ? 0 : 1);
+
+        if (false == known) {
+            exclusive.push_back(index);
+
+            continue;
+        }
+
+        for (const auto& key : footprint) {
+            const auto found = owner.emplace(key, index);
+
+            if (false == found.second) {
+                parent[root(found.first->second)] = root(index);
+            }
+        }
+    }
+
+    std::map<std::size_t, std::size_t> groupIndex{};
+
+    for (std::size_t index = 0; index < ordered.size(); ++index) {
+        if (0 != isExclusive[index]) { continue; }
+
+        const auto found = groupIndex.emplace(root(index), groups.size());
+
+        if (found.second) { groups.emplace_back(); }
+
+        groups[found.first->second].push_back(index);
     }
-    if (bNeedToSave) SaveCron();
 }
 
 // OTCron IS responsible for cleaning up theItem, and takes ownership.
@@ -710,6 +1222,8 @@ bool OTCron::AddCronItem(
             m_multimapCronItems.upper_bound(tDateAdded),
             std::pair<time64_t, OTCronItem*>(tDateAdded, &theItem));
 
+        m_mapDateAdded[theItem.GetTransactionNum()] = tDateAdded;
+
         theItem.SetCronPointer(*this);
         theItem.setServerNym(m_pServerNym);
         theItem.setNotaryID(m_NOTARY_ID);
@@ -747,8 +1261,10 @@ bool OTCron::AddCronItem(
             // DONE ABOVE. See if (bSaveReceipt) ...
             //            theItem.SaveContract();
 
-            // Since we added an item to the Cron, we SAVE it.
-            bSuccess = SaveCron();
+            // Since we added an item to the Cron, we SAVE it, and record
+            // that it was added.
+            bSuccess = save_item(theItem, tDateAdded) &&
+                       journal('+', theItem.GetTransactionNum());
 
             if (bSuccess)
                 otOut << __FUNCTION__
@@ -807,8 +1323,9 @@ bool OTCron::RemoveCronItem(
 
         delete pItem;
 
-        // An item has been removed from Cron. SAVE.
-        return SaveCron();
+        // An item has been removed from Cron. SAVE. (The removal hook used a
+        // transaction number, which is journaled too.)
+        return erase_item(lTransactionNum) && journal_numbers();
     }
 
     return false;
@@ -948,6 +1465,8 @@ OTCronItem* OTCron::GetItemByValidOpeningNum(std::int64_t lOpeningNum)
 // also make sure to delete it again if this call fails!
 bool OTCron::AddMarket(OTMarket& theMarket, bool bSaveMarketFile)
 {
+    rLock lock(market_lock_);
+
     OT_ASSERT(nullptr != GetServerNym());
 
     theMarket.SetCronPointer(*this);  // This way every Market has a pointer to
@@ -1015,6 +1534,7 @@ OTMarket* OTCron::GetOrCreateMarket(
     const Identifier& CURRENCY_ID,
     const std::int64_t& lScale)
 {
+    rLock lock(market_lock_);
     OTMarket* pMarket = new OTMarket(
         GetNotaryID(), INSTRUMENT_DEFINITION_ID, CURRENCY_ID, lScale);
 
@@ -1052,6 +1572,7 @@ OTMarket* OTCron::GetOrCreateMarket(
 // If it is, return a pointer to it, otherwise return nullptr.
 OTMarket* OTCron::GetMarket(const Identifier& MARKET_ID)
 {
+    rLock lock(market_lock_);
     String str_MARKET_ID(MARKET_ID);
     std::string std_MARKET_ID = str_MARKET_ID.Get();
 
@@ -1160,6 +1681,8 @@ void OTCron::Release_Cron()
         // same pItems being deleted in the next block.
     }
 
+    m_mapDateAdded.clear();
+
     while (!m_mapCronItems.empty()) {
         OTCronItem* pItem = m_mapCronItems.begin()->second;
         auto it = m_mapCronItems.begin();
@@ -54,22 +54,38 @@ namespace opentxs
 
 AsymmetricKeySecp256k1::AsymmetricKeySecp256k1()
     : ot_super(proto::AKEYTYPE_SECP256K1, proto::KEYROLE_ERROR)
+    , parsed_lock_()
+    , generation_(1)
+    , parsed_generation_(0)
+    , parsed_()
 {
 }
 
 AsymmetricKeySecp256k1::AsymmetricKeySecp256k1(const proto::KeyRole role)
     : ot_super(proto::AKEYTYPE_SECP256K1, role)
+    , parsed_lock_()
+    , generation_(1)
+    , parsed_generation_(0)
+    , parsed_()
 {
 }
 
 AsymmetricKeySecp256k1::AsymmetricKeySecp256k1(
     const proto::AsymmetricKey& serializedKey)
     : ot_super(serializedKey)
+    , parsed_lock_()
+    , generation_(1)
+    , parsed_generation_(0)
+    , parsed_()
 {
 }
 
 AsymmetricKeySecp256k1::AsymmetricKeySecp256k1(const String& publicKey)
     : ot_super(proto::AKEYTYPE_SECP256K1, publicKey)
+    , parsed_lock_()
+    , generation_(1)
+    , parsed_generation_(0)
+    , parsed_()
 {
 }
 
@@ -84,6 +100,13 @@ const CryptoAsymmetric& AsymmetricKeySecp256k1::engine() const
     return OT::App().Crypto().SECP256K1();
 }
 
+// Called whenever the key is set or released
+void AsymmetricKeySecp256k1::ReleaseKeyLowLevel_Hook() const
+{
+    Lock lock(parsed_lock_);
+    ++generation_;
+}
+
 void AsymmetricKeySecp256k1::Release()
 {
     Release_AsymmetricKeySecp256k1();  // My own cleanup is performed here.
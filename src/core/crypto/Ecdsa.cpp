@@ -125,30 +125,10 @@ bool Ecdsa::DecryptSessionKeyECDH(
     const OTPasswordData& password,
     SymmetricKey& sessionKey) const
 {
-    auto publicDHKey = Data::Factory();
-
-    if (!publicKey.GetKey(publicDHKey)) {
-        otErr << __FUNCTION__ << ": Failed to get public key." << std::endl;
-
-        return false;
-    }
-
-    OTPassword privateDHKey;
-
-    if (!AsymmetricKeyToECPrivatekey(privateKey, password, privateDHKey)) {
-        otErr << __FUNCTION__ << ": Failed to get private key." << std::endl;
-
-        return false;
-    }
-
-    // Calculate ECDH shared secret
     BinarySecret ECDHSecret(
         OT::App().Crypto().AES().InstantiateBinarySecretSP());
-    bool haveECDH = ECDH(publicDHKey, privateDHKey, *ECDHSecret);
 
-    if (!haveECDH) {
-        otErr << __FUNCTION__ << ": ECDH shared secret negotiation failed."
-              << std::endl;
+    if (!SessionKeySecret(privateKey, publicKey, password, *ECDHSecret)) {
 
         return false;
     }
@@ -329,4 +309,39 @@ bool Ecdsa::SeedToCurveKey(
 
     return false;
 }
+
+bool Ecdsa::SessionKeySecret(
+    const AsymmetricKeyEC& privateKey,
+    const AsymmetricKeyEC& publicKey,
+    const OTPasswordData& password,
+    OTPassword& secret) const
+{
+    auto publicDHKey = Data::Factory();
+
+    if (!publicKey.GetKey(publicDHKey)) {
+        otErr << __FUNCTION__ << ": Failed to get public key." << std::endl;
+
+        return false;
+    }
+
+    OTPassword privateDHKey;
+
+    if (!AsymmetricKeyToECPrivatekey(privateKey, password, privateDHKey)) {
+        otErr << __FUNCTION__ << ": Failed to get private key." << std::endl;
+
+        return false;
+    }
+
+    // Calculate ECDH shared secret
+    const bool haveECDH = ECDH(publicDHKey, privateDHKey, secret);
+
+    if (!haveECDH) {
+        otErr << __FUNCTION__ << ": ECDH shared secret negotiation failed."
+              << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
 }  // namespace opentxs
@@ -41,6 +41,7 @@
 #include "opentxs/core/crypto/Letter.hpp"
 
 #include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/crypto/Symmetric.hpp"
 #include "opentxs/api/crypto/Util.hpp"
 #include "opentxs/api/Native.hpp"
@@ -81,9 +82,154 @@
 #include <cstdint>
 #include <ostream>
 #include <string>
+#include <vector>
+
+// Each EC session key in a sealed letter is tagged with a short value derived
+// from the ECDH secret of its recipient, so Open can go straight to its own
+// entry. proto::Envelope has no field for this, so the tags are appended to
+// the serialized envelope as a field number the schema does not define,
+// which parsers skip as an unknown field. Letters without tags are opened by
+// trying every session key, as before.
+#define OT_LETTER_TAG_FIELD 63
+#define OT_LETTER_TAG_VERSION 1
+#define OT_LETTER_TAG_SIZE 4
+#define OT_LETTER_TAG_CONTEXT "opentxs-letter-session-key-tag"
 
 namespace opentxs
 {
+namespace
+{
+void AppendSessionKeyTags(
+    const std::vector<std::uint32_t>& tags,
+    Data& envelope)
+{
+    std::vector<std::uint8_t> field{};
+    const std::uint32_t key = (OT_LETTER_TAG_FIELD << 3) | 2;
+    const std::size_t length = 1 + (tags.size() * OT_LETTER_TAG_SIZE);
+
+    for (std::uint64_t value : {std::uint64_t(key), std::uint64_t(length)}) {
+        while (0x7f < value) {
+            field.push_back(static_cast<std::uint8_t>(0x80 | (value & 0x7f)));
+            value >>= 7;
+        }
+
+        field.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    field.push_back(OT_LETTER_TAG_VERSION);
+
+    for (const auto& tag : tags) {
+        for (int i = OT_LETTER_TAG_SIZE - 1; i >= 0; --i) {
+            field.push_back(static_cast<std::uint8_t>(tag >> (8 * i)));
+        }
+    }
+
+    envelope.Concatenate(field.data(), field.size());
+}
+
+// Walks the top level fields of a serialized envelope looking for the session
+// key tags written by AppendSessionKeyTags.
+bool ReadSessionKeyTags(
+    const Data& envelope,
+    std::vector<std::uint32_t>& tags)
+{
+    tags.clear();
+    const auto* it = static_cast<const std::uint8_t*>(envelope.GetPointer());
+    const auto* const end = it + envelope.GetSize();
+    auto varint = [&](std::uint64_t& value) -> bool {
+        value = 0;
+
+        for (int shift = 0; (it < end) && (shift < 64); shift += 7) {
+            const auto byte = *it++;
+            value |= std::uint64_t(byte & 0x7f) << shift;
+
+            if (0 == (byte & 0x80)) { return true; }
+        }
+
+        return false;
+    };
+
+    while (it < end) {
+        std::uint64_t key{0};
+        std::uint64_t length{0};
+
+        if (false == varint(key)) { return false; }
+
+        switch (key & 0x07) {
+            case 0: {
+                if (false == varint(length)) { return false; }
+
+                continue;
+            }
+            case 1: {
+                length = 8;
+            } break;
+            case 2: {
+                if (false == varint(length)) { return false; }
+            } break;
+            case 5: {
+                length = 4;
+            } break;
+            default: {
+
+                return false;
+            }
+        }
+
+        if (length > std::uint64_t(end - it)) { return false; }
+
+        if (OT_LETTER_TAG_FIELD == (key >> 3)) {
+            const bool valid = (0 < length) &&
+                               (OT_LETTER_TAG_VERSION == it[0]) &&
+                               (0 == ((length - 1) % OT_LETTER_TAG_SIZE));
+
+            if (false == valid) { return false; }
+
+            for (auto tag = it + 1; tag < it + length;
+                 tag += OT_LETTER_TAG_SIZE) {
+                std::uint32_t value{0};
+
+                for (int i = 0; i < OT_LETTER_TAG_SIZE; ++i) {
+                    value = (value << 8) | tag[i];
+                }
+
+                tags.push_back(value);
+            }
+
+            return true;
+        }
+
+        it += length;
+    }
+
+    return false;
+}
+
+bool SessionKeyTag(const OTPassword& secret, std::uint32_t& tag)
+{
+    OTPassword digest;
+    const auto context = Data::Factory(
+        OT_LETTER_TAG_CONTEXT, sizeof(OT_LETTER_TAG_CONTEXT) - 1);
+    const bool hashed = OT::App().Crypto().Hash().HMAC(
+        proto::HASHTYPE_SHA256, secret, context, digest);
+
+    if ((false == hashed) || (OT_LETTER_TAG_SIZE > digest.getMemorySize())) {
+        otErr << __FUNCTION__ << ": Failed to calculate tag." << std::endl;
+
+        return false;
+    }
+
+    const auto* bytes = static_cast<const std::uint8_t*>(digest.getMemory());
+    tag = 0;
+
+    for (int i = 0; i < OT_LETTER_TAG_SIZE; ++i) {
+        tag = (tag << 8) | bytes[i];
+    }
+
+    return true;
+}
+}  // namespace
+
 bool Letter::AddRSARecipients(
     __attribute__((unused)) const mapOfAsymmetricKeys& recipients,
     __attribute__((unused)) const SymmetricKey& sessionKey,
@@ -199,6 +345,7 @@ bool Letter::Seal(
 
     proto::Envelope output;
     output.set_version(1);
+    std::vector<std::uint32_t> tags{};
     auto iv = Data::Factory();
     const bool encrypted = sessionKey->Encrypt(
         theInput, iv, defaultPassword, *output.mutable_ciphertext(), false);
@@ -249,9 +396,12 @@ bool Letter::Seal(
                 *sessionKey,
                 newKeyPassword);
 
-            if (haveSessionKey) {
+            std::uint32_t tag{0};
+
+            if (haveSessionKey && SessionKeyTag(newKeyPassword, tag)) {
                 auto& serializedSessionKey = *output.add_sessionkey();
                 sessionKey->Serialize(serializedSessionKey);
+                tags.push_back(tag);
             } else {
                 otErr << __FUNCTION__ << ": Session key encryption failed."
                       << std::endl;
@@ -299,9 +449,12 @@ bool Letter::Seal(
                 *sessionKey,
                 newKeyPassword);
 
-            if (haveSessionKey) {
+            std::uint32_t tag{0};
+
+            if (haveSessionKey && SessionKeyTag(newKeyPassword, tag)) {
                 auto& serializedSessionKey = *output.add_sessionkey();
                 sessionKey->Serialize(serializedSessionKey);
+                tags.push_back(tag);
             } else {
                 otErr << __FUNCTION__ << ": Session key encryption failed."
                       << std::endl;
@@ -314,6 +467,8 @@ bool Letter::Seal(
     auto temp = proto::ProtoAsData(output);
     dataOutput.Assign(temp->GetPointer(), temp->GetSize());
 
+    if (0 < tags.size()) { AppendSessionKeyTags(tags, dataOutput); }
+
     return true;
 }
 
@@ -392,13 +547,43 @@ bool Letter::Open(
                 OTAsymmetricKey::KeyFactory(ephemeralPubkey)));
         }
 
-        // The only way to know which session key (might) belong to us to try
-        // them all
-        for (auto& it : serialized.sessionkey()) {
+        if (false == bool(dhPublicKey)) {
+            otErr << __FUNCTION__ << ": Invalid ephemeral public key."
+                  << std::endl;
+
+            return false;
+        }
+
+        // The same secret unlocks whichever session key belongs to us, so it
+        // is only calculated once.
+        OTPassword secret;
+        const bool haveSecret = ecKey->ECDSA().SessionKeySecret(
+            *ecKey, *dhPublicKey, keyPassword, secret);
+
+        if (false == haveSecret) {
+            otErr << __FUNCTION__ << ": Failed to calculate ECDH secret."
+                  << std::endl;
+
+            return false;
+        }
+
+        OTPasswordData unlockPassword("");
+        unlockPassword.SetOverride(secret);
+        std::vector<std::uint32_t> tags{};
+        std::uint32_t ownTag{0};
+        const bool tagged =
+            ReadSessionKeyTags(dataInput, tags) &&
+            (static_cast<int>(tags.size()) == serialized.sessionkey_size()) &&
+            SessionKeyTag(secret, ownTag);
+
+        // Untagged letters don't say which session key belongs to us, so the
+        // only way to find out is to try them all
+        for (int i = 0; i < serialized.sessionkey_size(); ++i) {
+            if (tagged && (ownTag != tags[i])) { continue; }
+
             key = OT::App().Crypto().Symmetric().Key(
-                it, serialized.ciphertext().mode());
-            haveSessionKey = ecKey->ECDSA().DecryptSessionKeyECDH(
-                *ecKey, *dhPublicKey, keyPassword, *key);
+                serialized.sessionkey(i), serialized.ciphertext().mode());
+            haveSessionKey = key->Unlock(unlockPassword);
 
             if (haveSessionKey) { break; }
         }
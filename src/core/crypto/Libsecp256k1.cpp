@@ -60,7 +60,12 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/OT.hpp"
 
+#include "core/util/Workers.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <ostream>
 
 namespace opentxs
@@ -180,24 +185,17 @@ bool Libsecp256k1::Verify(
     __attribute__((unused)) const OTPasswordData* pPWData) const
 {
     auto hash = Data::Factory();
-    ;
     bool haveDigest =
         OT::App().Crypto().Hash().Digest(hashType, plaintext, hash);
 
     if (!haveDigest) { return false; }
 
-    const AsymmetricKeyEC* key =
-        dynamic_cast<const AsymmetricKeySecp256k1*>(&theKey);
+    const auto* key = dynamic_cast<const AsymmetricKeySecp256k1*>(&theKey);
 
     if (nullptr == key) { return false; }
 
-    auto ecdsaPubkey = Data::Factory();
-    const bool havePublicKey = AsymmetricKeyToECPubkey(*key, ecdsaPubkey);
-
-    if (!havePublicKey) { return false; }
-
     secp256k1_pubkey point;
-    const bool pubkeyParsed = ParsePublicKey(ecdsaPubkey, point);
+    const bool pubkeyParsed = ParsePublicKey(*key, point);
 
     if (!pubkeyParsed) { return false; }
 
@@ -213,28 +211,45 @@ bool Libsecp256k1::Verify(
         &point);
 }
 
+bool Libsecp256k1::Verify(
+    const std::vector<VerifyItem>& items,
+    const proto::HashType hashType,
+    std::vector<bool>& results) const
+{
+    // std::vector<bool> packs its elements, so the workers write to bytes.
+    std::vector<std::uint8_t> verified(items.size(), 0);
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() -> void {
+        for (auto i = next++; i < items.size(); i = next++) {
+            const auto& [key, plaintext, signature] = items[i];
+            verified[i] = Verify(plaintext, key, signature, hashType);
+        }
+    };
+    RunWorkers(std::min(items.size(), WorkerThreads()), worker);
+    results.assign(verified.begin(), verified.end());
+
+    return std::all_of(verified.begin(), verified.end(), [](std::uint8_t i) {
+        return 0 != i;
+    });
+}
+
 bool Libsecp256k1::DataToECSignature(
     const Data& inSignature,
     secp256k1_ecdsa_signature& outSignature) const
 {
-    const std::uint8_t* sigStart =
-        static_cast<const std::uint8_t*>(inSignature.GetPointer());
+    if (nullptr == inSignature.GetPointer()) { return false; }
 
-    if (nullptr != sigStart) {
+    if (sizeof(secp256k1_ecdsa_signature) != inSignature.GetSize()) {
 
-        if (sizeof(secp256k1_ecdsa_signature) == inSignature.GetSize()) {
-            secp256k1_ecdsa_signature ecdsaSignature;
-
-            for (std::uint32_t i = 0; i < inSignature.GetSize(); i++) {
-                ecdsaSignature.data[i] = *(sigStart + i);
-            }
+        return false;
+    }
 
-            outSignature = ecdsaSignature;
+    std::memcpy(
+        outSignature.data,
+        inSignature.GetPointer(),
+        sizeof(secp256k1_ecdsa_signature));
 
-            return true;
-        }
-    }
-    return false;
+    return true;
 }
 
 bool Libsecp256k1::ECDH(
@@ -280,6 +295,41 @@ bool Libsecp256k1::ParsePublicKey(const Data& input, secp256k1_pubkey& output)
         input.GetSize());
 }
 
+bool Libsecp256k1::ParsePublicKey(
+    const AsymmetricKeySecp256k1& key,
+    secp256k1_pubkey& output) const
+{
+    static_assert(
+        sizeof(output.data) == std::tuple_size<decltype(key.parsed_)>::value,
+        "Unexpected secp256k1_pubkey size");
+
+    Lock lock(key.parsed_lock_);
+
+    if (key.parsed_generation_ == key.generation_) {
+        std::memcpy(output.data, key.parsed_.data(), sizeof(output.data));
+
+        return true;
+    }
+
+    const auto generation = key.generation_;
+    lock.unlock();
+    auto serialized = Data::Factory();
+
+    if (!AsymmetricKeyToECPubkey(key, serialized)) { return false; }
+
+    if (!ParsePublicKey(serialized, output)) { return false; }
+
+    lock.lock();
+
+    // The key was set again while it was being parsed
+    if (generation != key.generation_) { return true; }
+
+    std::memcpy(key.parsed_.data(), output.data, sizeof(output.data));
+    key.parsed_generation_ = generation;
+
+    return true;
+}
+
 bool Libsecp256k1::ScalarBaseMultiply(
     const OTPassword& privateKey,
     Data& publicKey) const
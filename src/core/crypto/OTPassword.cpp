@@ -40,6 +40,8 @@
 
 #include "opentxs/core/crypto/OTPassword.hpp"
 
+#include "SecureArena.hpp"
+
 #include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/crypto/Util.hpp"
 #include "opentxs/api/Native.hpp"
@@ -50,39 +52,11 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/OT.hpp"
 
-// For SecureZeroMemory
-#ifdef _WIN32
-#else  // not _WIN32
-
-#include <sys/mman.h>
-
-#ifndef PAGESIZE
-#include <unistd.h>
-
 #include <cstdint>
 #include <cstring>
 #include <ostream>
 #include <string>
 
-#define PAGESIZE sysconf(_SC_PAGESIZE)
-#endif
-
-// FT: Credit to the Bitcoin team for the mlock / munlock defines.
-
-#define mlock(a, b)                                                            \
-    mlock(                                                                     \
-        (reinterpret_cast<void*>(                                              \
-            (reinterpret_cast<size_t>(a)) & (~((PAGESIZE)-1)))),               \
-        ((((reinterpret_cast<size_t>(a)) + (b)-1) | ((PAGESIZE)-1)) + 1) -     \
-            ((reinterpret_cast<size_t>(a)) & (~((PAGESIZE)-1))))
-#define munlock(a, b)                                                          \
-    munlock(                                                                   \
-        (reinterpret_cast<void*>(                                              \
-            (reinterpret_cast<size_t>(a)) & (~((PAGESIZE)-1)))),               \
-        ((((reinterpret_cast<size_t>(a)) + (b)-1) | ((PAGESIZE)-1)) + 1) -     \
-            ((reinterpret_cast<size_t>(a)) & (~((PAGESIZE)-1))))
-#endif
-
 namespace opentxs
 {
 
@@ -107,10 +81,7 @@ void* ot_secure_memset(void* v, std::uint8_t c, std::uint32_t n)
 
 // TODO, security: Generate a session key, and encrypt the password string to
 // that key whenever setting it,
-// and decrypt it using that key whenever getting it. Also make sure to use the
-// lock / unlock functions
-// at that time (below). Also change so that the contents are dynamically
-// allocated.
+// and decrypt it using that key whenever getting it.
 // NOTE: Given that OTSymmetricKey works with OTPassword, this is a bit circular
 // in logic. Therefore might
 // need to add a function to OTEnvelope so that it takes a const char * instead
@@ -121,77 +92,20 @@ void* ot_secure_memset(void* v, std::uint8_t c, std::uint32_t n)
 // way to do this without duplication,
 // as I get deeper into it.
 
-// THE PURPOSE OF LOCKING A PAGE:
-//
-// "So that it won't get swapped to disk, where the secret
-// could be recovered maliciously from the swap file."
-//
-bool OTPassword::ot_lockPage(void* addr, size_t len)
-{
-#ifdef _WIN32
-// return VirtualLock(addr, len);
-#elif defined(PREDEF_PLATFORM_UNIX)
-    static bool bWarned = false;
-    if (mlock(addr, len) && !bWarned) {
-        bWarned = true;
-        otErr << "ot_lockPage: WARNING: unable to lock memory. \n"
-                 "   (Passwords / secret keys may be swapped to disk!)\n";
-    }
-    return true;
-#else
-    OT_FAIL_MSG("ASSERT: ot_lockPage unable to lock memory.");
-#endif
-    return false;
-}
-
-// TODO:  Note: may need to add directives here so that mlock and munlock are
-// not
-// used except where the user is running as a privileged process. (Because that
-// may be the only way we CAN use those functions...)
-
-bool OTPassword::ot_unlockPage(void* addr, size_t len)
-{
-#ifdef _WIN32
-//    return VirtualUnlock(addr, len);
-#elif defined(PREDEF_PLATFORM_UNIX)
-    static bool bWarned = false;
-    if (munlock(addr, len) && !bWarned) {
-        bWarned = true;
-        otErr << "ot_unlockPage: WARNING: unable to unlock memory used for "
-                 "storing secrets.\n";
-    }
-    return true;
-#else
-    OT_FAIL_MSG("ASSERT: ot_unlockPage unable to unlock secret memory.");
-#endif
-    return false;
-}
-
 // PURPOSE OF ZERO'ING MEMORY:
 //
 // So the secret is not stored in memory any longer than absolutely necessary.
 // Once it has been used, we want to wipe it from memory ASAP. (The least amount
 // of time spent in memory, the better.)
 
+//
+// The buffer itself is kept so the next secret can reuse it. It is returned
+// to the secure arena (which zeros it again) when this object is destroyed.
 void OTPassword::zeroMemory()
 {
     size_ = 0;
 
-    OTPassword::zeroMemory(static_cast<void*>(&(data_[0])), getBlockSize());
-
-//
-#ifndef _WIN32
-    // UNLOCK the page, now that we're AFTER the point where
-    // the memory was safely ZERO'd out.
-    //
-    if (isPageLocked_) {
-        if (ot_unlockPage(static_cast<void*>(&(data_[0])), getBlockSize())) {
-            isPageLocked_ = false;
-        } else
-            otErr << "OTPassword::zeroMemory: Error: Memory page was locked, "
-                     "but then failed to unlock it.\n";
-    }
-#endif
+    OTPassword::zeroMemory(static_cast<void*>(data_), capacity_);
 }
 
 // static
@@ -356,11 +270,11 @@ OTPassword* OTPassword::CreateTextBuffer()  // asserts already.
 
 OTPassword::OTPassword()
     : size_(0)
+    , data_(nullptr)
+    , capacity_(0)
     , isText_(true)
     , isBinary_(false)
-    , isPageLocked_(false)
 {
-    data_[0] = '\0';
     setPassword_uint8(reinterpret_cast<const std::uint8_t*>(""), 0);
 }
 
@@ -377,14 +291,12 @@ OTPassword& OTPassword::operator=(const OTPassword& rhs)
 
 OTPassword::OTPassword(const OTPassword& rhs)
     : size_(0)
+    , data_(nullptr)
+    , capacity_(0)
     , isText_(rhs.isPassword())
     , isBinary_(rhs.isMemory())
-    , isPageLocked_(false)
-    , blockSize_(rhs.blockSize_)  // The buffer has this size+1 as its static
-                                  // size.
 {
     if (isText_) {
-        data_[0] = '\0';
         setPassword_uint8(rhs.getPassword_uint8(), rhs.getPasswordSize());
     } else if (isBinary_) {
         setMemory(rhs.getMemory_uint8(), rhs.getMemorySize());
@@ -393,40 +305,36 @@ OTPassword::OTPassword(const OTPassword& rhs)
 
 OTPassword::OTPassword(const char* szInput, std::uint32_t nInputSize)
     : size_(0)
+    , data_(nullptr)
+    , capacity_(0)
     , isText_(true)
     , isBinary_(false)
-    , isPageLocked_(false)
 {
-    data_[0] = '\0';
-
     setPassword_uint8(
         reinterpret_cast<const std::uint8_t*>(szInput), nInputSize);
 }
 
 OTPassword::OTPassword(const std::uint8_t* szInput, std::uint32_t nInputSize)
     : size_(0)
+    , data_(nullptr)
+    , capacity_(0)
     , isText_(true)
     , isBinary_(false)
-    , isPageLocked_(false)
 {
-    data_[0] = '\0';
-
     setPassword_uint8(szInput, nInputSize);
 }
 
 OTPassword::OTPassword(const void* vInput, std::uint32_t nInputSize)
     : size_(0)
+    , data_(nullptr)
+    , capacity_(0)
     , isText_(false)
     , isBinary_(true)
-    , isPageLocked_(false)
 {
     setMemory(vInput, nInputSize);
 }
 
-OTPassword::~OTPassword()
-{
-    if (size_ > 0) zeroMemory();
-}
+OTPassword::~OTPassword() { release(); }
 
 bool OTPassword::isPassword() const { return isText_; }
 
@@ -481,7 +389,10 @@ void* OTPassword::getMemoryWritable()
     return (size_ <= 0) ? nullptr : static_cast<void*>(&(data_[0]));
 }
 
-std::size_t OTPassword::getBlockSize() const { return blockSize_; }
+std::size_t OTPassword::getBlockSize() const
+{
+    return (0 == capacity_) ? OT_DEFAULT_BLOCKSIZE : capacity_ - 1;
+}
 
 std::uint32_t OTPassword::getPasswordSize() const
 {
@@ -498,13 +409,13 @@ std::uint32_t OTPassword::getMemorySize() const
 bool OTPassword::addChar(std::uint8_t theChar)
 {
     OT_ASSERT(isPassword());
-    if (getPasswordSize() < getBlockSize()) {
-        data_[size_] = theChar;
-        ++size_;
-        data_[size_] = '\0';
-        return true;
-    }
-    return false;
+
+    reserve(size_ + 2);
+    data_[size_] = theChar;
+    ++size_;
+    data_[size_] = '\0';
+
+    return true;
 }
 
 bool OTPassword::Compare(OTPassword& rhs) const
@@ -567,13 +478,6 @@ std::int32_t OTPassword::setPassword_uint8(
 
     if (0 == nInputSize) return 0;
 
-    // Make sure no input size is larger than our block size
-    const size_t maxSize = getBlockSize();
-
-    if (nInputSize > maxSize) {
-        nInputSize = maxSize;  // Truncated password beyond max size.
-    }
-
     // The szInput string passed into this function should never
     // be a different size than what is passed in. For example it shouldn't
     // be SMALLER than what the user claims either. If it is, we error out.
@@ -588,23 +492,7 @@ std::int32_t OTPassword::setPassword_uint8(
         return (-1);
     }
 
-#ifndef _WIN32
-
-    //
-    // Lock the memory page, before we copy the data over.
-    // (If it's not already locked, which I doubt it will be.)
-    //
-    // it won't be locked already, since we just zero'd it
-    // (above.) But I check this anyway...
-    if (!isPageLocked_) {
-        if (ot_lockPage(static_cast<void*>(&(data_[0])), getBlockSize())) {
-            isPageLocked_ = true;
-        } else {
-            otErr << szFunc
-                  << ": Error: Failed attempting to lock memory page.\n";
-        }
-    }
-#endif
+    reserve(nInputSize + 1);
 
 #ifdef _WIN32
     strncpy_s(
@@ -644,16 +532,11 @@ std::int32_t OTPassword::setPassword_uint8(
 bool OTPassword::SetSize(std::uint32_t uSize)
 {
     if (isBinary_) {
-        if (uSize > getBlockSize())
-            uSize = getBlockSize();  // Truncated password beyond max size.
+        reserve(uSize + 1);
         size_ = uSize;
         return true;
     } else if (isText_) {
-        // Cannot be as much as the blocksize,
-        // because no room for null-terminator.
-        if (uSize >= getBlockSize()) {
-            uSize = getBlockSize() - 1;  // Truncated password to blocksize-1.
-        }
+        reserve(uSize + 1);
         // The actual null-terminator.
         data_[uSize] = '\0';
         // If size is 3, the terminator is at
@@ -720,28 +603,8 @@ std::int32_t OTPassword::randomizePassword(std::uint32_t nNewSize)
 
     if (0 == nSize) return 0;
 
-    // Make sure no input size is larger than our block size
-    //
-    if (nSize > getBlockSize())
-        nSize = getBlockSize();  // Truncated password beyond max size.
-#ifndef _WIN32
-    //
-    // Lock the memory page, before we randomize 'size bytes' of the data.
-    // (If it's not already locked, which I doubt it will be.)
-    //
-    if (!isPageLocked_)  // it won't be locked already, since we just zero'd it
-                         // (above.) But I check this anyway...
-    {
-        if (ot_lockPage(static_cast<void*>(&(data_[0])), getBlockSize())) {
-            isPageLocked_ = true;
-        } else {
-            otErr << __FUNCTION__
-                  << ": Error: Failed attempting to lock memory page.\n";
-        }
-    }
-#endif
+    reserve(nSize + 1);
 
-    //
     if (!OTPassword::randomizePassword_uint8(
             &(data_[0]), static_cast<std::int32_t>(nSize + 1))) {
         // randomizeMemory (above) already logs, so I'm not logging again twice
@@ -787,29 +650,8 @@ std::int32_t OTPassword::randomizeMemory(std::uint32_t nNewSize)
 
     if (0 == nSize) return 0;
 
-    // Make sure no input size is larger than our block size
-    //
-    if (nSize > getBlockSize())
-        nSize = getBlockSize();  // Truncated password beyond max size.
+    reserve(nSize + 1);
 
-#ifndef _WIN32
-    //
-    // Lock the memory page, before we randomize 'size bytes' of the data.
-    // (If it's not already locked, which I doubt it will be.)
-    //
-    if (!isPageLocked_)  // it won't be locked already, since we just zero'd it
-                         // (above.) But I check this anyway...
-    {
-        if (ot_lockPage(static_cast<void*>(&(data_[0])), getBlockSize())) {
-            isPageLocked_ = true;
-        } else {
-            otErr << __FUNCTION__
-                  << ": Error: Failed attempting to lock memory page.\n";
-        }
-    }
-#endif
-
-    //
     if (!OTPassword::randomizeMemory_uint8(&(data_[0]), nSize)) {
         // randomizeMemory (above) already logs, so I'm not logging again twice
         // here.
@@ -823,8 +665,6 @@ std::int32_t OTPassword::randomizeMemory(std::uint32_t nNewSize)
     return size_;
 }
 
-// (FYI, truncates if nAppendSize + getPasswordSize() is larger than
-// getBlockSize.)
 // Returns number of bytes appended, or -1 for error.
 //
 std::int32_t OTPassword::addMemory(
@@ -847,42 +687,12 @@ std::int32_t OTPassword::addMemory(
     // Should already be set from the above setMemory call.
     OT_ASSERT(isBinary_);
 
-    // Make sure total new size isn't larger than our block size
-    //
-    if ((nAppendSize + size_) > getBlockSize()) {
-        // Truncated password beyond max size.
-        nAppendSize = (getBlockSize() - size_);
-    }
-    //  OT_ASSERT(nAppendSize >= 0);
-
-    if (0 == nAppendSize) return 0;
-
-    // By this point, I know nAppendSize is larger than 0, AND that appending it
-    // onto the
-    // existing memory of this object will not exceed the total allowed block
-    // size.
-    //
-    // Because we use setMemory when empty, and only use addMemory when we KNOW
-    // something
-    // is already there, therefore we know the page is already locked, so no
-    // need to go
-    // trying to lock it again.
-
+    reserve(size_ + nAppendSize + 1);
     OTPassword::safe_memcpy(
         static_cast<void*>(&(data_[size_])),
-        nAppendSize,  // dest size is based on the source
-                      // size, but guaranteed to be >0 and
-                      // <=getBlockSize
+        nAppendSize,
         vAppend,
-        nAppendSize);  // Since dest size is
-                       // known to be src size or
-                       // less (and >0) we use it
-                       // as src size. (We may
-                       // have truncated... and
-                       // we certainly don't want
-                       // to copy beyond our own
-                       // truncation.)
-
+        nAppendSize);
     size_ += nAppendSize;
 
     return nAppendSize;
@@ -914,49 +724,44 @@ std::int32_t OTPassword::setMemory(const void* vInput, std::uint32_t nInputSize)
 
     if (0 == nInputSize) return 0;
 
-    // Make sure no input size is larger than our block size
-    //
-    if (nInputSize > getBlockSize())
-        nInputSize = getBlockSize();  // Truncated password beyond max size.
-
-#ifndef _WIN32
-    //
-    // Lock the memory page, before we copy the data over.
-    // (If it's not already locked, which I doubt it will be.)
-    //
-    if (!isPageLocked_)  // it won't be locked already, since we just zero'd it
-                         // (above.) But I check this anyway...
-    {
-        if (ot_lockPage(static_cast<void*>(&(data_[0])), getBlockSize())) {
-            isPageLocked_ = true;
-        } else {
-            otErr << __FUNCTION__
-                  << ": Error: Failed attempting to lock memory page.\n";
-        }
-    }
-#endif
-
+    reserve(nInputSize + 1);
     OTPassword::safe_memcpy(
-        static_cast<void*>(&(data_[0])),
-        // dest size is based on the source
-        // size, but guaranteed to be >0 and
-        // <=getBlockSize
-        nInputSize,
-        // Since dest size is known
-        // to be src size or less
-        // (and >0) we use it as src
-        // size. (We may have
-        // truncated... and we
-        // certainly don't want to
-        // copy beyond our own
-        // truncation.)
-        vInput,
-        nInputSize);
+        static_cast<void*>(&(data_[0])), nInputSize, vInput, nInputSize);
 
     size_ = nInputSize;
     return size_;
 }
 
+void OTPassword::release()
+{
+    size_ = 0;
+    implementation::SecureArena::Free(data_, capacity_);
+    data_ = nullptr;
+    capacity_ = 0;
+}
+
+// Grows the buffer without losing its contents. Anything past size_ in the
+// old buffer is copied too, since callers may have written it through the
+// writable accessors before calling SetSize.
+void OTPassword::reserve(const std::size_t required)
+{
+    if (required <= capacity_) { return; }
+
+    std::size_t capacity{0};
+    auto* replacement = static_cast<std::uint8_t*>(
+        implementation::SecureArena::Allocate(required, capacity));
+
+    OT_ASSERT(nullptr != replacement);
+
+    if (nullptr != data_) {
+        OTPassword::safe_memcpy(replacement, capacity, data_, capacity_);
+        implementation::SecureArena::Free(data_, capacity_);
+    }
+
+    data_ = replacement;
+    capacity_ = capacity;
+}
+
 // First use reset() to set the internal position to 0.
 // Then you pass in the buffer where the results go.
 // You pass in the length of that buffer.
@@ -0,0 +1,232 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "SecureArena.hpp"
+
+#include "opentxs/core/crypto/OTPassword.hpp"
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/Types.hpp"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <ostream>
+
+// Usable pages per slab. Each slab costs one mmap and one mlock call
+// regardless of how many secrets it holds.
+#define OT_SECURE_ARENA_SLAB_PAGES 16
+
+#define OT_METHOD "opentxs::implementation::SecureArena::"
+
+namespace opentxs::implementation
+{
+// Multiples of 16 so every chunk in a slab stays suitably aligned. 272 holds
+// the default OTPassword block plus its terminator.
+const std::array<std::size_t, SecureArena::class_count_>
+    SecureArena::class_size_{{32, 64, 128, 272, 512, 1024, 2048}};
+
+SecureArena::SecureArena()
+#ifdef _WIN32
+    : page_size_(4096)
+#else
+    : page_size_(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)))
+#endif
+    , slab_size_(page_size_ * OT_SECURE_ARENA_SLAB_PAGES)
+    , lock_()
+    , free_()
+    , lock_failure_reported_(false)
+{
+}
+
+void* SecureArena::Allocate(const std::size_t size, std::size_t& capacity)
+{
+    return get().allocate(size, capacity);
+}
+
+void* SecureArena::allocate(const std::size_t size, std::size_t& capacity)
+{
+    OT_ASSERT(0 < size);
+
+    std::size_t index{0};
+
+    while ((index < class_count_) && (class_size_[index] < size)) { ++index; }
+
+    Lock lock(lock_);
+
+    if (class_count_ == index) {
+        capacity = ((size + page_size_ - 1) / page_size_) * page_size_;
+        auto* output = map(capacity);
+
+        OT_ASSERT(nullptr != output);
+
+        return output;
+    }
+
+    auto& available = free_[index];
+
+    if (available.empty()) {
+        const bool created = new_slab(index);
+
+        OT_ASSERT(created);
+    }
+
+    auto* output = available.back();
+    available.pop_back();
+    capacity = class_size_[index];
+
+    return output;
+}
+
+void SecureArena::Free(void* block, const std::size_t capacity)
+{
+    get().free(block, capacity);
+}
+
+void SecureArena::free(void* block, const std::size_t capacity)
+{
+    if (nullptr == block) { return; }
+
+    OTPassword::zeroMemory(block, static_cast<std::uint32_t>(capacity));
+    Lock lock(lock_);
+
+    if (class_size_[class_count_ - 1] < capacity) {
+        unmap(block, capacity);
+
+        return;
+    }
+
+    std::size_t index{0};
+
+    while (class_size_[index] != capacity) {
+        ++index;
+
+        OT_ASSERT(index < class_count_);
+    }
+
+    free_[index].push_back(block);
+}
+
+// Never destroyed, so secrets held by other static objects can still be
+// returned to the arena during shutdown
+SecureArena& SecureArena::get()
+{
+    static auto* arena = new SecureArena();
+
+    return *arena;
+}
+
+void* SecureArena::map(const std::size_t size)
+{
+#ifdef _WIN32
+    return new std::uint8_t[size]{};
+#else
+    const auto total = size + (2 * page_size_);
+    auto* region = ::mmap(
+        nullptr, total, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == region) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to map " << total
+              << " bytes." << std::endl;
+
+        return nullptr;
+    }
+
+    // The first and last pages stay inaccessible
+    auto* output = static_cast<std::uint8_t*>(region) + page_size_;
+
+    if (0 != ::mprotect(output, size, PROT_READ | PROT_WRITE)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to make secure memory writable." << std::endl;
+        ::munmap(region, total);
+
+        return nullptr;
+    }
+
+#ifdef MADV_DONTDUMP
+    ::madvise(output, size, MADV_DONTDUMP);
+#endif
+
+    if ((0 != ::mlock(output, size)) && (false == lock_failure_reported_)) {
+        lock_failure_reported_ = true;
+        otErr << OT_METHOD << __FUNCTION__
+              << ": WARNING: unable to lock memory. Passwords and secret keys "
+                 "may be swapped to disk."
+              << std::endl;
+    }
+
+    return output;
+#endif
+}
+
+bool SecureArena::new_slab(const std::size_t index)
+{
+    auto* slab = static_cast<std::uint8_t*>(map(slab_size_));
+
+    if (nullptr == slab) { return false; }
+
+    const auto chunk = class_size_[index];
+    const auto count = slab_size_ / chunk;
+    auto& available = free_[index];
+    available.reserve(available.size() + count);
+
+    // Pushed in reverse so the lowest addresses are handed out first
+    for (std::size_t i = count; i > 0; --i) {
+        available.push_back(slab + ((i - 1) * chunk));
+    }
+
+    return true;
+}
+
+void SecureArena::unmap(void* block, const std::size_t size)
+{
+#ifdef _WIN32
+    delete[] static_cast<std::uint8_t*>(block);
+#else
+    ::munlock(block, size);
+    ::munmap(
+        static_cast<std::uint8_t*>(block) - page_size_,
+        size + (2 * page_size_));
+#endif
+}
+}  // namespace opentxs::implementation
@@ -0,0 +1,91 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_CRYPTO_IMPLEMENTATION_SECUREARENA_HPP
+#define OPENTXS_CORE_CRYPTO_IMPLEMENTATION_SECUREARENA_HPP
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace opentxs::implementation
+{
+/** Process-wide allocator for secret material.
+ *
+ *  Small requests are carved out of slabs: page aligned mappings which are
+ *  locked into memory once when they are created, excluded from core dumps
+ *  where the platform allows it, and bracketed by inaccessible guard pages.
+ *  Requests larger than the biggest size class get a dedicated mapping with
+ *  its own guard pages. Every block is zeroed when it is freed. */
+class SecureArena
+{
+public:
+    /** Returns a block of at least size bytes and sets capacity to its real
+     *  size, which must be passed back to Free */
+    static void* Allocate(const std::size_t size, std::size_t& capacity);
+    static void Free(void* block, const std::size_t capacity);
+
+    ~SecureArena() = default;
+
+private:
+    static const std::size_t class_count_{7};
+    static const std::array<std::size_t, class_count_> class_size_;
+
+    const std::size_t page_size_{0};
+    const std::size_t slab_size_{0};
+    std::mutex lock_;
+    std::array<std::vector<void*>, class_count_> free_;
+    bool lock_failure_reported_{false};
+
+    static SecureArena& get();
+
+    void* allocate(const std::size_t size, std::size_t& capacity);
+    void free(void* block, const std::size_t capacity);
+    void* map(const std::size_t size);
+    bool new_slab(const std::size_t index);
+    void unmap(void* block, const std::size_t size);
+
+    SecureArena();
+    SecureArena(const SecureArena&) = delete;
+    SecureArena(SecureArena&&) = delete;
+    SecureArena& operator=(const SecureArena&) = delete;
+    SecureArena& operator=(SecureArena&&) = delete;
+};
+}  // namespace opentxs::implementation
+#endif  // OPENTXS_CORE_CRYPTO_IMPLEMENTATION_SECUREARENA_HPP
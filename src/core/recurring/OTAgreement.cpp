@@ -877,6 +877,17 @@ void OTAgreement::AddRecipientClosingTransactionNo(
     m_dequeRecipientClosingNumbers.push_back(closingNumber);
 }
 
+// Payments only move funds between the sender's and the recipient's accounts.
+bool OTAgreement::GetFootprint(std::set<std::string>& output) const
+{
+    output.insert(GetSenderNymID().str());
+    output.insert(GetSenderAcctID().str());
+    output.insert(GetRecipientNymID().str());
+    output.insert(GetRecipientAcctID().str());
+
+    return true;
+}
+
 // OTCron calls this regularly, which is my chance to expire, etc.
 // Child classes will override this, AND call it (to verify valid date range.)
 bool OTAgreement::ProcessCron()
@@ -1289,18 +1289,7 @@ void OTPaymentPlan::ProcessInitialPayment()
     // if it is dirty, or instruct it to update itself if it is.  Anyway, let's
     // save Cron...
 
-    GetCron()->SaveCron();
-
-    // Todo: put the actual Cron items in separate files, so I don't have to
-    // update
-    // the entire cron file every time an item changes. That way the main cron
-    // file
-    // can just keep a record of the active items, and will change only when an
-    // item
-    // is added or removed.
-    //
-    // Until then, the entire Cron file will have to save EVERY time this call
-    // happens.
+    GetCron()->SaveCronItem(*this);
     //
     // (I'll add something to Cron so it can't save more than once per second or
     // something.)
@@ -1370,7 +1359,7 @@ void OTPaymentPlan::ProcessPaymentPlan()
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    GetCron()->SaveCron();
+    GetCron()->SaveCronItem(*this);
 }
 
 // OTCron calls this regularly, which is my chance to expire, etc.
@@ -3050,8 +3050,9 @@ bool OTSmartContract::StashFunds(
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    pCron->SaveCron();  // TODO No need to call this here if I can make sure
-                        // it's being called higher up somewhere
+    pCron->SaveCronItem(*this);  // TODO No need to call this here if I can
+                                 // make sure it's being called higher up
+                                 // somewhere
     // (Imagine a script that has 10 account moves in it -- maybe don't need to
     // save cron until
     // after all 10 are done. Or maybe DO need to do in between. Todo research
@@ -6528,7 +6529,7 @@ bool OTSmartContract::MoveFunds(
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    GetCron()->SaveCron();
+    GetCron()->SaveCronItem(*this);
 
     return bSuccess;
 }
@@ -1957,10 +1957,11 @@ void OTMarket::ProcessTrade(
                 // that have just updated.
                 SaveMarket();
 
-                // The Trade has changed, and it is stored as a CronItem. So I
-                // save Cron as well, for
-                // the same reason I saved the Market.
-                pCron->SaveCron();
+                // The Trades have changed, and they are stored as CronItems.
+                // So I save them as well, for the same reason I saved the
+                // Market.
+                pCron->SaveCronItem(theTrade);
+                pCron->SaveCronItem(*pOtherTrade);
             }
 
             //
@@ -1017,6 +1017,19 @@ void OTTrade::onFinalReceipt(
     // onto cron in the first place.
 }
 
+// A trade settles against the other offers on its market, so every trade on
+// the same instrument / currency pair shares the market key. (This groups
+// markets of different scales together, which is merely conservative.)
+bool OTTrade::GetFootprint(std::set<std::string>& output) const
+{
+    output.insert(GetSenderNymID().str());
+    output.insert(GetSenderAcctID().str());
+    output.insert(GetCurrencyAcctID().str());
+    output.insert(GetInstrumentDefinitionID().str() + GetCurrencyID().str());
+
+    return true;
+}
+
 // OTCron calls this regularly, which is my chance to expire, etc.
 // Return True if I should stay on the Cron list for more processing.
 // Return False if I should be removed and deleted.
@@ -367,7 +367,21 @@ OTTransaction* LoadBoxReceipt(
     // local storage, into a string.
     // Then, try to load the transaction from that string and see if successful.
     // If it verifies, then return it. Otherwise return nullptr.
+    String strRawFile;
 
+    if (false == ReadBoxReceipt(theAbbrev, lLedgerType, strRawFile)) {
+
+        return nullptr;  // This already logs -- no need to log twice, here.
+    }
+
+    return InstantiateBoxReceipt(theAbbrev, strRawFile);
+}
+
+bool ReadBoxReceipt(
+    OTTransaction& theAbbrev,
+    std::int64_t lLedgerType,
+    String& strOutput)
+{
     // Can only load abbreviated transactions (so they'll become their full
     // form.)
     //
@@ -376,7 +390,7 @@ OTTransaction* LoadBoxReceipt(
               << theAbbrev.GetTransactionNum()
               << ": "
                  "(Because argument 'theAbbrev' wasn't abbreviated.)\n";
-        return nullptr;
+        return false;
     }
 
     // Next, see if the appropriate file exists, and load it up from
@@ -392,7 +406,7 @@ OTTransaction* LoadBoxReceipt(
             strFolder2name,
             strFolder3name,
             strFilename))
-        return nullptr;  // This already logs -- no need to log twice, here.
+        return false;  // This already logs -- no need to log twice, here.
 
     // See if the box receipt exists before trying to load it...
     //
@@ -405,7 +419,7 @@ OTTransaction* LoadBoxReceipt(
                << ": Box receipt does not exist: " << strFolder1name
                << Log::PathSeparator() << strFolder2name << Log::PathSeparator()
                << strFolder3name << Log::PathSeparator() << strFilename << "\n";
-        return nullptr;
+        return false;
     }
 
     // Try to load the box receipt from local storage.
@@ -419,34 +433,40 @@ OTTransaction* LoadBoxReceipt(
         otErr << __FUNCTION__ << ": Error reading file: " << strFolder1name
               << Log::PathSeparator() << strFolder2name << Log::PathSeparator()
               << strFolder3name << Log::PathSeparator() << strFilename << "\n";
-        return nullptr;
+        return false;
     }
 
-    String strRawFile(strFileContents.c_str());
+    strOutput.Set(strFileContents.c_str());
 
-    if (!strRawFile.Exists()) {
+    if (!strOutput.Exists()) {
         otErr << __FUNCTION__
               << ": Error reading file (resulting output "
                  "string is empty): "
               << strFolder1name << Log::PathSeparator() << strFolder2name
               << Log::PathSeparator() << strFolder3name << Log::PathSeparator()
               << strFilename << "\n";
-        return nullptr;
+        return false;
     }
 
-    // Finally, try to load the transaction from that string and see if
-    // successful.
+    return true;
+}
+
+OTTransaction* InstantiateBoxReceipt(
+    OTTransaction& theAbbrev,
+    const String& strRawFile)
+{
+    const auto lTransactionNum = theAbbrev.GetTransactionNum();
+
+    // Try to load the transaction from that string and see if successful.
     //
     OTTransactionType* pTransType =
         OTTransactionType::TransactionFactory(strRawFile);
 
     if (nullptr == pTransType) {
         otErr << __FUNCTION__
-              << ": Error instantiating transaction "
-                 "type based on strRawFile: "
-              << strFolder1name << Log::PathSeparator() << strFolder2name
-              << Log::PathSeparator() << strFolder3name << Log::PathSeparator()
-              << strFilename << "\n";
+              << ": Error instantiating transaction type based on box "
+                 "receipt for transaction number: "
+              << lTransactionNum << "\n";
         return nullptr;
     }
 
@@ -454,11 +474,9 @@ OTTransaction* LoadBoxReceipt(
 
     if (nullptr == pBoxReceipt) {
         otErr << __FUNCTION__
-              << ": Error dynamic_cast from transaction "
-                 "type to transaction, based on strRawFile: "
-              << strFolder1name << Log::PathSeparator() << strFolder2name
-              << Log::PathSeparator() << strFolder3name << Log::PathSeparator()
-              << strFilename << "\n";
+              << ": Error dynamic_cast from transaction type to transaction, "
+                 "based on box receipt for transaction number: "
+              << lTransactionNum << "\n";
         delete pTransType;
         pTransType = nullptr;  // cleanup!
         return nullptr;
@@ -473,19 +491,17 @@ OTTransaction* LoadBoxReceipt(
     bool bSuccess = theAbbrev.VerifyBoxReceipt(*pBoxReceipt);
 
     if (!bSuccess) {
-        otErr << __FUNCTION__ << ": Failed verifying Box Receipt:\n"
-              << strFolder1name << Log::PathSeparator() << strFolder2name
-              << Log::PathSeparator() << strFolder3name << Log::PathSeparator()
-              << strFilename << "\n";
+        otErr << __FUNCTION__
+              << ": Failed verifying Box Receipt for transaction number: "
+              << lTransactionNum << "\n";
 
         delete pBoxReceipt;
         pBoxReceipt = nullptr;
         return nullptr;
     } else
-        otInfo << __FUNCTION__ << ": Successfully loaded Box Receipt in:\n"
-               << strFolder1name << Log::PathSeparator() << strFolder2name
-               << Log::PathSeparator() << strFolder3name << Log::PathSeparator()
-               << strFilename << "\n";
+        otInfo << __FUNCTION__
+               << ": Successfully loaded Box Receipt for transaction number: "
+               << lTransactionNum << "\n";
 
     // Todo: security analysis. By this point we've verified the hash of the
     // transaction against the stored
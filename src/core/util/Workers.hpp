@@ -0,0 +1,58 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_CORE_UTIL_WORKERS_HPP
+#define OPENTXS_CORE_UTIL_WORKERS_HPP
+
+#include <cstddef>
+#include <functional>
+
+namespace opentxs
+{
+/** Runs worker on the requested number of threads and returns once all of
+ *  them have finished. The calling thread is one of the workers, so a count
+ *  of zero or one runs worker once on the calling thread. */
+void RunWorkers(
+    const std::size_t threads,
+    const std::function<void()>& worker);
+
+/** std::thread::hardware_concurrency(), or one if that is unknown */
+std::size_t WorkerThreads();
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_UTIL_WORKERS_HPP
@@ -48,9 +48,11 @@
 #include "opentxs/network/zeromq/PushSocket.hpp"
 #include "opentxs/network/zeromq/ReplySocket.hpp"
 #include "opentxs/network/zeromq/RequestSocket.hpp"
+#include "opentxs/network/zeromq/RouterSocket.hpp"
 #include "opentxs/network/zeromq/SubscribeSocket.hpp"
 
 #include "PairEventListener.hpp"
+#include "Poller.hpp"
 
 #include <zmq.h>
 
@@ -68,9 +70,14 @@ namespace opentxs::network::zeromq::implementation
 {
 Context::Context()
     : context_(zmq_ctx_new())
+    , poller_(nullptr)
 {
     OT_ASSERT(nullptr != context_);
     OT_ASSERT(1 == zmq_has("curve"));
+
+    poller_.reset(new class Poller(context_));
+
+    OT_ASSERT(poller_);
 }
 
 Context::operator void*() const { return context_; }
@@ -110,6 +117,13 @@ OTZMQProxy Context::Proxy(
     return opentxs::network::zeromq::Proxy::Factory(*this, frontend, backend);
 }
 
+class Poller& Context::Poller() const
+{
+    OT_ASSERT(poller_);
+
+    return *poller_;
+}
+
 OTZMQPublishSocket Context::PublishSocket() const
 {
     return PublishSocket::Factory(*this);
@@ -142,6 +156,11 @@ OTZMQRequestSocket Context::RequestSocket() const
     return RequestSocket::Factory(*this);
 }
 
+OTZMQRouterSocket Context::RouterSocket(const ListenCallback& callback) const
+{
+    return RouterSocket::Factory(*this, callback);
+}
+
 OTZMQSubscribeSocket Context::SubscribeSocket(
     const ListenCallback& callback) const
 {
@@ -150,6 +169,8 @@ OTZMQSubscribeSocket Context::SubscribeSocket(
 
 Context::~Context()
 {
+    poller_.reset();
+
     if (nullptr != context_) { zmq_ctx_shutdown(context_); }
 }
 }  // namespace opentxs::network::zeromq::implementation
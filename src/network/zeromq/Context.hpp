@@ -43,6 +43,8 @@
 
 #include "opentxs/network/zeromq/Context.hpp"
 
+#include <memory>
+
 namespace opentxs::network::zeromq::implementation
 {
 class Context : virtual public zeromq::Context
@@ -71,15 +73,21 @@ public:
     OTZMQPushSocket PushSocket(const bool client) const override;
     OTZMQReplySocket ReplySocket(const ReplyCallback& callback) const override;
     OTZMQRequestSocket RequestSocket() const override;
+    OTZMQRouterSocket RouterSocket(
+        const ListenCallback& callback) const override;
     OTZMQSubscribeSocket SubscribeSocket(
         const ListenCallback& callback) const override;
 
+    /** Shared by every listening socket created from this context */
+    class Poller& Poller() const;
+
     ~Context();
 
 private:
     friend network::zeromq::Context;
 
     void* context_{nullptr};
+    std::unique_ptr<class Poller> poller_{nullptr};
 
     Context* clone() const override;
 
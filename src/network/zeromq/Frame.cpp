@@ -46,6 +46,8 @@
 
 #include <zmq.h>
 
+#include <utility>
+
 template class opentxs::Pimpl<opentxs::network::zeromq::Frame>;
 
 namespace opentxs::network::zeromq
@@ -61,8 +63,21 @@ OTZMQFrame Frame::Factory(const std::string& input)
 {
     return OTZMQFrame(new implementation::Frame(input));
 }
+
+OTZMQFrame Frame::Factory(std::string&& input)
+{
+    return OTZMQFrame(new implementation::Frame(std::move(input)));
+}
 }  // namespace opentxs::network::zeromq
 
+namespace
+{
+void release_string(void*, void* hint)
+{
+    delete static_cast<std::string*>(hint);
+}
+}  // namespace
+
 namespace opentxs::network::zeromq::implementation
 {
 Frame::Frame()
@@ -107,6 +122,30 @@ Frame::Frame(const std::string& input)
     OT_ASSERT(0 == init);
 }
 
+Frame::Frame(std::string&& input)
+    : message_(new zmq_msg_t)
+{
+    OT_ASSERT(nullptr != message_);
+
+    if (input.empty()) {
+        const auto init = zmq_msg_init(message_);
+
+        OT_ASSERT(0 == init);
+
+        return;
+    }
+
+    // zmq frees the buffer via release_string once the frame has been sent
+    auto buffer = new std::string(std::move(input));
+
+    OT_ASSERT(nullptr != buffer);
+
+    const auto init = zmq_msg_init_data(
+        message_, &(*buffer)[0], buffer->size(), release_string, buffer);
+
+    OT_ASSERT(0 == init);
+}
+
 Frame::operator zmq_msg_t*() { return message_; }
 
 Frame::operator std::string() const
@@ -116,7 +155,19 @@ Frame::operator std::string() const
     return output;
 }
 
-Frame* Frame::clone() const { return new Frame(std::string(*this)); }
+Frame* Frame::clone() const
+{
+    auto output = new Frame();
+
+    OT_ASSERT(nullptr != output);
+
+    // Shares the reference counted buffer instead of copying it
+    const auto copied = zmq_msg_copy(output->message_, message_);
+
+    OT_ASSERT(0 == copied);
+
+    return output;
+}
 
 const void* Frame::data() const
 {
@@ -134,6 +185,10 @@ std::size_t Frame::size() const
 
 Frame::~Frame()
 {
-    if (nullptr != message_) { zmq_msg_close(message_); }
+    if (nullptr != message_) {
+        zmq_msg_close(message_);
+        delete message_;
+        message_ = nullptr;
+    }
 }
 }  // namespace opentxs::network::zeromq::implementation
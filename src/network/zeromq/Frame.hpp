@@ -67,6 +67,7 @@ private:
     Frame();
     explicit Frame(const Data& input);
     explicit Frame(const std::string& input);
+    explicit Frame(std::string&& input);
     Frame(const Frame&) = delete;
     Frame(Frame&&) = delete;
     Frame& operator=(Frame&&) = delete;
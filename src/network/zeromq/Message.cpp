@@ -45,6 +45,8 @@
 
 #include <zmq.h>
 
+#include <utility>
+
 template class opentxs::Pimpl<opentxs::network::zeromq::Message>;
 
 namespace opentxs::network::zeromq
@@ -81,7 +83,10 @@ OTZMQMessage Message::ReplyFactory(const Message& request)
     auto output = new implementation::Message();
 
     if (0 < request.Header().size()) {
-        for (const auto& frame : request.Header()) { output->AddFrame(frame); }
+        // Copies of a frame share its buffer
+        for (const auto& frame : request.Header()) {
+            output->messages_.emplace_back(frame);
+        }
 
         output->AddFrame();
     }
@@ -99,25 +104,29 @@ Message::Message()
 
 Frame& Message::AddFrame()
 {
-    OTZMQFrame message = Frame::Factory();
+    messages_.emplace_back(Frame::Factory());
 
-    messages_.emplace_back(message);
     return messages_.back().get();
 }
 
 Frame& Message::AddFrame(const opentxs::Data& input)
 {
-    OTZMQFrame message = Frame::Factory(input);
+    messages_.emplace_back(Frame::Factory(input));
 
-    messages_.emplace_back(message);
     return messages_.back().get();
 }
 
 Frame& Message::AddFrame(const std::string& input)
 {
-    OTZMQFrame message = Frame::Factory(input);
+    messages_.emplace_back(Frame::Factory(input));
+
+    return messages_.back().get();
+}
+
+Frame& Message::AddFrame(std::string&& input)
+{
+    messages_.emplace_back(Frame::Factory(std::move(input)));
 
-    messages_.emplace_back(message);
     return messages_.back().get();
 }
 
@@ -188,7 +197,9 @@ std::size_t Message::findDivider() const
 bool Message::hasDivider() const
 {
     return std::find_if(
-               messages_.begin(), messages_.end(), [](OTZMQFrame msg) -> bool {
+               messages_.begin(),
+               messages_.end(),
+               [](const OTZMQFrame& msg) -> bool {
                    return 0 == msg->size();
                }) != messages_.end();
 }
@@ -88,7 +88,7 @@ PairSocket::PairSocket(
     const bool listener,
     const bool startThread)
     : ot_super(context, SocketType::Pair)
-    , Receiver(lock_, socket_, startThread)
+    , Receiver(context, lock_, socket_, startThread)
     , callback_(callback)
     , endpoint_(endpoint)
     , bind_(listener)
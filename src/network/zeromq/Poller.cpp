@@ -0,0 +1,322 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "stdafx.hpp"
+
+#include "Poller.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <zmq.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+
+#define DEFER_MILLISECONDS 10
+#define MINIMUM_WORKERS 4
+#define POLL_MILLISECONDS 1000
+#define STALL_SECONDS 10
+#define WAKE_ENDPOINT_PREFIX "inproc://opentxs/poller/wake/"
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Poller::"
+
+namespace opentxs::network::zeromq::implementation
+{
+Poller::Poller(void* context)
+    : wake_send_(zmq_socket(context, ZMQ_PAIR))
+    , wake_receive_(zmq_socket(context, ZMQ_PAIR))
+    , wake_lock_()
+    , lock_()
+    , changed_()
+    , items_()
+    , ready_()
+    , cycle_(0)
+    , idle_(0)
+    , stalled_()
+    , stall_reported_(false)
+    , running_(Flag::Factory(true))
+    , poll_thread_(nullptr)
+    , workers_()
+{
+    OT_ASSERT(nullptr != wake_send_)
+    OT_ASSERT(nullptr != wake_receive_)
+
+    static std::atomic<std::uint64_t> counter{0};
+    const auto endpoint =
+        std::string(WAKE_ENDPOINT_PREFIX) + std::to_string(++counter);
+    const auto bound = zmq_bind(wake_receive_, endpoint.c_str());
+
+    OT_ASSERT(0 == bound)
+
+    const auto connected = zmq_connect(wake_send_, endpoint.c_str());
+
+    OT_ASSERT(0 == connected)
+
+    const auto workers = std::max(
+        std::thread::hardware_concurrency(), unsigned(MINIMUM_WORKERS));
+    idle_ = workers;
+
+    for (unsigned int i = 0; i < workers; ++i) {
+        workers_.emplace_back(&Poller::worker, this);
+    }
+
+    poll_thread_.reset(new std::thread(&Poller::poll, this));
+
+    OT_ASSERT(poll_thread_)
+}
+
+void Poller::Add(void* socket, const Callback& callback) const
+{
+    OT_ASSERT(nullptr != socket)
+
+    Lock lock(lock_);
+    auto& item = items_[socket];
+    item.callback_ = callback;
+    item.armed_ = true;
+    item.removed_ = false;
+    item.deferred_ = false;
+    lock.unlock();
+    wake();
+}
+
+// Called by the poll thread
+void Poller::check_stall(const Lock& lock)
+{
+    OT_ASSERT(lock.mutex() == &lock_)
+
+    if (ready_.empty() || (0 < idle_)) {
+        stalled_ = {};
+        stall_reported_ = false;
+
+        return;
+    }
+
+    const auto now = Clock::now();
+
+    if (Clock::time_point{} == stalled_) {
+        stalled_ = now;
+
+        return;
+    }
+
+    if (stall_reported_ ||
+        ((now - stalled_) < std::chrono::seconds(STALL_SECONDS))) {
+
+        return;
+    }
+
+    otErr << OT_METHOD << __FUNCTION__ << ": Every worker has been busy for "
+          << STALL_SECONDS << " seconds with " << ready_.size()
+          << " sockets waiting. A callback may be blocked on a socket served "
+             "by this Poller."
+          << std::endl;
+    stall_reported_ = true;
+}
+
+void Poller::poll()
+{
+    std::vector<zmq_pollitem_t> items{};
+    std::vector<void*> sockets{};
+
+    while (running_.get()) {
+        items.clear();
+        sockets.clear();
+        items.push_back({wake_receive_, 0, ZMQ_POLLIN, 0});
+        sockets.push_back(nullptr);
+        long timeout{POLL_MILLISECONDS};
+
+        {
+            Lock lock(lock_);
+            const auto now = Clock::now();
+
+            for (auto& it : items_) {
+                const auto& socket = it.first;
+                auto& item = it.second;
+
+                if (item.deferred_) {
+                    if (item.retry_ <= now) {
+                        item.deferred_ = false;
+                        item.armed_ = (false == item.removed_);
+                    } else {
+                        timeout = DEFER_MILLISECONDS;
+                    }
+                }
+
+                if (item.armed_) {
+                    items.push_back({socket, 0, ZMQ_POLLIN, 0});
+                    sockets.push_back(socket);
+                }
+            }
+        }
+
+        const auto events = zmq_poll(items.data(), items.size(), timeout);
+
+        if (-1 == events) {
+            const auto error = zmq_errno();
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Poll error: " << zmq_strerror(error) << std::endl;
+        }
+
+        if (0 != (items[0].revents & ZMQ_POLLIN)) {
+            zmq_msg_t message;
+            zmq_msg_init(&message);
+
+            while (-1 != zmq_msg_recv(&message, wake_receive_, ZMQ_DONTWAIT)) {
+                ;
+            }
+
+            zmq_msg_close(&message);
+        }
+
+        Lock lock(lock_);
+        ++cycle_;
+
+        for (std::size_t i = 1; i < items.size(); ++i) {
+            if (0 == (items[i].revents & ZMQ_POLLIN)) { continue; }
+
+            auto it = items_.find(sockets[i]);
+
+            if (items_.end() == it) { continue; }
+
+            auto& item = it->second;
+
+            if (false == item.armed_) { continue; }
+
+            item.armed_ = false;
+            item.busy_ = true;
+            ready_.push_back(sockets[i]);
+        }
+
+        check_stall(lock);
+        lock.unlock();
+        changed_.notify_all();
+    }
+}
+
+void Poller::Remove(void* socket) const
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    auto it = items_.find(socket);
+
+    if (items_.end() == it) { return; }
+
+    auto& item = it->second;
+    item.armed_ = false;
+    item.removed_ = true;
+    changed_.wait(lock, [&]() -> bool { return false == item.busy_; });
+    // The poll thread may be inside zmq_poll with this socket in its set
+    const auto cycle = cycle_ + 1;
+    wake();
+    changed_.wait(lock, [&]() -> bool {
+        return (cycle_ >= cycle) || (false == running_.get());
+    });
+    items_.erase(it);
+}
+
+void Poller::wake() const
+{
+    Lock lock(wake_lock_);
+    zmq_msg_t message;
+    zmq_msg_init(&message);
+
+    if (-1 == zmq_msg_send(&message, wake_send_, ZMQ_DONTWAIT)) {
+        zmq_msg_close(&message);
+    }
+}
+
+void Poller::worker()
+{
+    while (running_.get()) {
+        std::unique_lock<std::mutex> lock(lock_);
+        changed_.wait_for(
+            lock, std::chrono::milliseconds(POLL_MILLISECONDS), [&]() -> bool {
+                return (false == ready_.empty()) || (false == running_.get());
+            });
+
+        if (ready_.empty()) { continue; }
+
+        auto socket = ready_.front();
+        ready_.pop_front();
+        auto it = items_.find(socket);
+
+        OT_ASSERT(items_.end() != it)
+
+        // Remove() waits for busy_ to clear, so the entry stays valid
+        auto& item = it->second;
+        --idle_;
+        lock.unlock();
+        const bool done = item.callback_();
+        lock.lock();
+        ++idle_;
+        item.busy_ = false;
+
+        if (done) {
+            item.armed_ = (false == item.removed_);
+        } else {
+            item.deferred_ = true;
+            item.retry_ =
+                Clock::now() + std::chrono::milliseconds(DEFER_MILLISECONDS);
+        }
+
+        lock.unlock();
+        changed_.notify_all();
+        wake();
+    }
+}
+
+Poller::~Poller()
+{
+    running_->Off();
+    wake();
+    changed_.notify_all();
+
+    if (poll_thread_ && poll_thread_->joinable()) {
+        poll_thread_->join();
+        poll_thread_.reset();
+    }
+
+    for (auto& worker : workers_) { worker.join(); }
+
+    workers_.clear();
+    Lock lock(wake_lock_);
+    zmq_close(wake_send_);
+    zmq_close(wake_receive_);
+}
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,131 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_POLLER_HPP
+#define OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_POLLER_HPP
+
+#include "Internal.hpp"
+
+#include "opentxs/core/Flag.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opentxs::network::zeromq::implementation
+{
+/** Shared reactor for every listening socket created by a Context.
+ *
+ *  One thread polls all registered sockets in a single zmq_poll set. When a
+ *  socket becomes readable it is taken out of the set and its callback is
+ *  run on a small pool of worker threads. The socket is put back into the
+ *  set once the callback returns, so callbacks for one socket never run
+ *  concurrently and the socket is never polled while a worker reads it.
+ *
+ *  A callback which can not make progress yet returns false. Its socket is
+ *  left out of the poll set for a short while instead of being polled (and
+ *  found readable) again straight away.
+ *
+ *  The pool has a fixed size. A callback which blocks, for example on a
+ *  synchronous request to a socket served by the same Poller, holds its
+ *  worker until it returns, and enough of them can stall every socket. The
+ *  poll thread logs an error when every worker has been busy for too long
+ *  while sockets are waiting. */
+class Poller
+{
+public:
+    /** Returns false if the socket should be polled again later */
+    using Callback = std::function<bool()>;
+
+    void Add(void* socket, const Callback& callback) const;
+    /** Blocks until the socket is no longer polled and its callback is not
+     *  running */
+    void Remove(void* socket) const;
+
+    explicit Poller(void* context);
+
+    ~Poller();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Item {
+        Callback callback_{};
+        bool armed_{true};
+        bool busy_{false};
+        bool removed_{false};
+        bool deferred_{false};
+        Clock::time_point retry_{};
+    };
+
+    void* wake_send_{nullptr};
+    void* wake_receive_{nullptr};
+    mutable std::mutex wake_lock_;
+    mutable std::mutex lock_;
+    mutable std::condition_variable changed_;
+    mutable std::map<void*, Item> items_;
+    mutable std::deque<void*> ready_;
+    mutable std::uint64_t cycle_{0};
+    mutable std::size_t idle_{0};
+    Clock::time_point stalled_{};
+    bool stall_reported_{false};
+    OTFlag running_;
+    std::unique_ptr<std::thread> poll_thread_{nullptr};
+    std::vector<std::thread> workers_;
+
+    void check_stall(const Lock& lock);
+    void poll();
+    void wake() const;
+    void worker();
+
+    Poller() = delete;
+    Poller(const Poller&) = delete;
+    Poller(Poller&&) = delete;
+    Poller& operator=(const Poller&) = delete;
+    Poller& operator=(Poller&&) = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
+#endif  // OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_POLLER_HPP
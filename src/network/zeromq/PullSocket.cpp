@@ -79,7 +79,7 @@ PullSocket::PullSocket(
     const zeromq::ListenCallback& callback,
     const bool startThread)
     : ot_super(context, SocketType::Subscribe)
-    , Receiver(lock_, socket_, startThread)
+    , Receiver(context, lock_, socket_, startThread)
     , client_(client)
     , callback_(callback)
 {
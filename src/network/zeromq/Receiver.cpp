@@ -44,119 +44,72 @@
 #include "opentxs/network/zeromq/Message.hpp"
 
 #include <zmq.h>
+#include "Context.hpp"
 #include "Message.hpp"
-
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define POLL_MILLISECONDS 1000
+#include "Poller.hpp"
 
 #define OT_METHOD "opentxs::network::zeromq::implementation::Receiver::"
 
 namespace opentxs::network::zeromq::implementation
 {
-Receiver::Receiver(std::mutex& lock, void* socket, const bool startThread)
-    : receiver_lock_(lock)
+Receiver::Receiver(
+    const zeromq::Context& context,
+    std::mutex& lock,
+    void* socket,
+    const bool startThread)
+    : receiver_poller_(
+          dynamic_cast<const implementation::Context&>(context).Poller())
+    , receiver_lock_(lock)
     , receiver_socket_(socket)
-    , receiver_run_(Flag::Factory(true))
-    , receiver_thread_(nullptr)
+    , receiver_registered_(startThread)
 {
-    if (startThread) {
-        receiver_thread_.reset(new std::thread(&Receiver::thread, this));
-
-        OT_ASSERT(receiver_thread_)
+    if (receiver_registered_) {
+        receiver_poller_.Add(receiver_socket_, [this]() -> bool {
+            return this->receive();
+        });
     }
 }
 
-void Receiver::thread()
+// Called by a Poller worker when the socket is readable. If the message can't
+// be handled yet the Poller parks the socket and tries again later, rather
+// than holding the worker.
+bool Receiver::receive()
 {
-    otInfo << OT_METHOD << __FUNCTION__ << ": Starting listener" << std::endl;
-
-    while (receiver_run_.get()) {
-        if (have_callback()) { break; }
+    // The derived class has not finished construction yet
+    if (false == have_callback()) { return false; }
 
-        Log::Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
-    }
-
-    otInfo << OT_METHOD << __FUNCTION__ << ": Callback ready" << std::endl;
-    zmq_pollitem_t poll[1];
+    Lock lock(receiver_lock_, std::try_to_lock);
 
-    while (receiver_run_.get()) {
-        poll[0].socket = receiver_socket_;
-        poll[0].events = ZMQ_POLLIN;
-        const auto events = zmq_poll(poll, 1, POLL_MILLISECONDS);
+    if (false == lock.owns_lock()) { return false; }
 
-        if (0 == events) {
-            otInfo << OT_METHOD << __FUNCTION__ << ": No messages."
-                   << std::endl;
+    auto reply = Message::Factory();
+    bool receiving{true};
 
-            continue;
-        }
+    while (receiving) {
+        auto& frame = reply->AddFrame();
+        const bool received = (-1 != zmq_msg_recv(frame, receiver_socket_, 0));
 
-        if (-1 == events) {
-            const auto error = zmq_errno();
+        if (false == received) {
             otErr << OT_METHOD << __FUNCTION__
-                  << ": Poll error: " << zmq_strerror(error) << std::endl;
-
-            continue;
-        }
-
-        Lock lock(receiver_lock_, std::try_to_lock);
-        if (!lock.owns_lock()) { return; }
-
-        auto reply = Message::Factory();
-
-        bool receiving{true};
+                  << ": Receive error: " << zmq_strerror(zmq_errno())
+                  << std::endl;
 
-        while (receiving) {
-            auto& frame = reply->AddFrame();
-            const bool received =
-                (-1 != zmq_msg_recv(frame, receiver_socket_, 0));
-
-            if (false == received) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": Receive error: " << zmq_strerror(zmq_errno())
-                      << std::endl;
-
-                return;
-            }
-
-            int option{0};
-            std::size_t optionBytes{sizeof(option)};
-
-            const bool haveOption =
-                (-1 !=
-                 zmq_getsockopt(
-                     receiver_socket_, ZMQ_RCVMORE, &option, &optionBytes));
-
-            if (false == haveOption) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": Failed to check socket options error:\n"
-                      << zmq_strerror(zmq_errno()) << std::endl;
-
-                return;
-            }
-
-            OT_ASSERT(optionBytes == sizeof(option))
-
-            if (1 != option) { receiving = false; }
+            return true;
         }
 
-        process_incoming(lock, reply);
-
-        lock.unlock();
+        receiving = (1 == zmq_msg_more(frame));
     }
 
-    otInfo << OT_METHOD << __FUNCTION__ << ": Shutting down" << std::endl;
+    process_incoming(lock, reply);
+
+    return true;
 }
 
 Receiver::~Receiver()
 {
     Lock lock(receiver_lock_);
-    receiver_run_->Off();
 
-    if (receiver_thread_ && receiver_thread_->joinable()) {
-        receiver_thread_->join();
-        receiver_thread_.reset();
-    }
+    if (receiver_registered_) { receiver_poller_.Remove(receiver_socket_); }
 
     receiver_socket_ = nullptr;
 }
@@ -41,33 +41,41 @@
 
 #include "Internal.hpp"
 
-#include "opentxs/core/Flag.hpp"
 #include "opentxs/Types.hpp"
 
-#include <memory>
 #include <mutex>
-#include <thread>
 
 namespace opentxs::network::zeromq::implementation
 {
+class Poller;
+
+/** Incoming messages are read and dispatched by the Context's Poller rather
+ * than by a thread belonging to the socket.
+ *
+ * process_incoming runs on one of the Poller's shared workers. It must not
+ * block on another socket served by the same Context (see Poller). */
 class Receiver
 {
 protected:
-    Receiver(std::mutex& lock, void* socket, const bool startThread);
+    Receiver(
+        const zeromq::Context& context,
+        std::mutex& lock,
+        void* socket,
+        const bool startThread);
 
     virtual ~Receiver();
 
 private:
+    Poller& receiver_poller_;
     std::mutex& receiver_lock_;
     // Not owned by this class
     void* receiver_socket_{nullptr};
-    OTFlag receiver_run_;
-    std::unique_ptr<std::thread> receiver_thread_{nullptr};
+    const bool receiver_registered_{false};
 
     virtual bool have_callback() const { return false; }
 
     virtual void process_incoming(const Lock& lock, Message& message) = 0;
-    void thread();
+    bool receive();
 
     Receiver() = delete;
     Receiver(const Receiver&) = delete;
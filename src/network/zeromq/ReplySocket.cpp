@@ -69,7 +69,7 @@ ReplySocket::ReplySocket(
     const ReplyCallback& callback)
     : ot_super(context, SocketType::Reply)
     , CurveServer(lock_, socket_)
-    , Receiver(lock_, socket_, true)
+    , Receiver(context, lock_, socket_, true)
     , callback_(callback)
 {
 }
@@ -94,7 +94,7 @@ void ReplySocket::process_incoming(const Lock&, Message& message)
 
         if (++counter < parts) { flags = ZMQ_SNDMORE; }
 
-        sent |= (-1 != zmq_msg_send(frame, socket_, flags));
+        sent &= (-1 != zmq_msg_send(frame, socket_, flags));
     }
 
     if (false == sent) {
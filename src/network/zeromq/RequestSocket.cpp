@@ -144,23 +144,7 @@ Socket::MultipartSendResult RequestSocket::SendRequest(
             return output;
         }
 
-        int option{0};
-        std::size_t optionBytes{sizeof(option)};
-
-        const bool haveOption =
-            (-1 != zmq_getsockopt(socket_, ZMQ_RCVMORE, &option, &optionBytes));
-
-        if (false == haveOption) {
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Failed to check socket options error:\n"
-                  << zmq_strerror(zmq_errno()) << std::endl;
-
-            return output;
-        }
-
-        OT_ASSERT(optionBytes == sizeof(option))
-
-        if (1 != option) { receiving = false; }
+        receiving = (1 == zmq_msg_more(frame));
     }
 
     status = SendResult::VALID_REPLY;
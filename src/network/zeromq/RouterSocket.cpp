@@ -0,0 +1,252 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "stdafx.hpp"
+
+#include "RouterSocket.hpp"
+
+#include "opentxs/core/Log.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/FrameIterator.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+
+#include <zmq.h>
+
+#include <atomic>
+
+template class opentxs::Pimpl<opentxs::network::zeromq::RouterSocket>;
+
+#define OUTGOING_ENDPOINT_PREFIX "inproc://opentxs/router/outgoing/"
+#define POLL_MILLISECONDS 1000
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::RouterSocket::"
+
+namespace opentxs::network::zeromq
+{
+OTZMQRouterSocket RouterSocket::Factory(
+    const class Context& context,
+    const ListenCallback& callback)
+{
+    return OTZMQRouterSocket(
+        new implementation::RouterSocket(context, callback));
+}
+}  // namespace opentxs::network::zeromq
+
+namespace opentxs::network::zeromq::implementation
+{
+RouterSocket::RouterSocket(
+    const zeromq::Context& context,
+    const ListenCallback& callback)
+    : ot_super(context, SocketType::Router)
+    , CurveServer(lock_, socket_)
+    , callback_(callback)
+    , outgoing_pull_(zmq_socket(context, ZMQ_PULL))
+    , outgoing_push_(zmq_socket(context, ZMQ_PUSH))
+    , push_lock_()
+    , running_(Flag::Factory(true))
+    , thread_(nullptr)
+{
+    OT_ASSERT(nullptr != outgoing_pull_)
+    OT_ASSERT(nullptr != outgoing_push_)
+
+    static std::atomic<std::uint64_t> counter{0};
+    const auto endpoint =
+        std::string(OUTGOING_ENDPOINT_PREFIX) + std::to_string(++counter);
+    const auto bound = zmq_bind(outgoing_pull_, endpoint.c_str());
+
+    OT_ASSERT(0 == bound)
+
+    const auto connected = zmq_connect(outgoing_push_, endpoint.c_str());
+
+    OT_ASSERT(0 == connected)
+
+    thread_.reset(new std::thread(&RouterSocket::thread, this));
+
+    OT_ASSERT(thread_)
+}
+
+RouterSocket* RouterSocket::clone() const
+{
+    return new RouterSocket(context_, callback_);
+}
+
+// Moves one message from the outgoing pipe to the router socket.
+bool RouterSocket::forward(const Lock& lock) const
+{
+    OT_ASSERT(verify_lock(lock))
+
+    bool more{true};
+
+    while (more) {
+        zmq_msg_t frame;
+        zmq_msg_init(&frame);
+
+        if (-1 == zmq_msg_recv(&frame, outgoing_pull_, 0)) {
+            zmq_msg_close(&frame);
+
+            return false;
+        }
+
+        more = (1 == zmq_msg_more(&frame));
+        const auto sent =
+            zmq_msg_send(&frame, socket_, more ? ZMQ_SNDMORE : 0);
+
+        if (-1 == sent) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Send error:\n"
+                  << zmq_strerror(zmq_errno()) << std::endl;
+            zmq_msg_close(&frame);
+        }
+    }
+
+    return true;
+}
+
+bool RouterSocket::receive(const Lock& lock, zeromq::Message& message) const
+{
+    OT_ASSERT(verify_lock(lock))
+
+    bool receiving{true};
+
+    while (receiving) {
+        auto& frame = message.AddFrame();
+
+        if (-1 == zmq_msg_recv(frame, socket_, 0)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Receive error: " << zmq_strerror(zmq_errno())
+                  << std::endl;
+
+            return false;
+        }
+
+        receiving = (1 == zmq_msg_more(frame));
+    }
+
+    return true;
+}
+
+bool RouterSocket::Send(zeromq::Message& message) const
+{
+    Lock lock(push_lock_);
+    bool sent{true};
+    const auto parts = message.size();
+    std::size_t counter{0};
+
+    for (auto& frame : message) {
+        int flags{0};
+
+        if (++counter < parts) { flags = ZMQ_SNDMORE; }
+
+        sent &= (-1 != zmq_msg_send(frame, outgoing_push_, flags));
+    }
+
+    if (false == sent) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Send error:\n"
+              << zmq_strerror(zmq_errno()) << std::endl;
+    }
+
+    return sent;
+}
+
+bool RouterSocket::SetCurve(const OTPassword& key) const
+{
+    return set_curve(key);
+}
+
+bool RouterSocket::Start(const std::string& endpoint) const
+{
+    Lock lock(lock_);
+
+    return bind(lock, endpoint);
+}
+
+void RouterSocket::thread()
+{
+    otInfo << OT_METHOD << __FUNCTION__ << ": Starting listener" << std::endl;
+    zmq_pollitem_t poll[2];
+
+    while (running_.get()) {
+        poll[0].socket = socket_;
+        poll[0].events = ZMQ_POLLIN;
+        poll[1].socket = outgoing_pull_;
+        poll[1].events = ZMQ_POLLIN;
+        const auto events = zmq_poll(poll, 2, POLL_MILLISECONDS);
+
+        if (0 == events) { continue; }
+
+        if (-1 == events) {
+            const auto error = zmq_errno();
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Poll error: " << zmq_strerror(error) << std::endl;
+
+            continue;
+        }
+
+        Lock lock(lock_);
+
+        if (0 != (poll[1].revents & ZMQ_POLLIN)) { forward(lock); }
+
+        if (0 == (poll[0].revents & ZMQ_POLLIN)) { continue; }
+
+        auto message = zeromq::Message::Factory();
+
+        if (false == receive(lock, message)) { continue; }
+
+        lock.unlock();
+        callback_.Process(message);
+    }
+
+    otInfo << OT_METHOD << __FUNCTION__ << ": Shutting down" << std::endl;
+}
+
+RouterSocket::~RouterSocket()
+{
+    running_->Off();
+
+    if (thread_ && thread_->joinable()) {
+        thread_->join();
+        thread_.reset();
+    }
+
+    Lock lock(push_lock_);
+    zmq_close(outgoing_push_);
+    zmq_close(outgoing_pull_);
+}
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,97 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_ROUTERSOCKET_HPP
+#define OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_ROUTERSOCKET_HPP
+
+#include "opentxs/Forward.hpp"
+
+#include "opentxs/core/Flag.hpp"
+#include "opentxs/network/zeromq/RouterSocket.hpp"
+
+#include "CurveServer.hpp"
+#include "Socket.hpp"
+
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace opentxs::network::zeromq::implementation
+{
+/** zeromq sockets may only be used by one thread, so Send doesn't touch the
+ * router socket. Outgoing messages are pushed over an inproc pipe to the
+ * thread which owns the router socket, and which polls both. */
+class RouterSocket : virtual public zeromq::RouterSocket,
+                     public Socket,
+                     CurveServer
+{
+public:
+    bool Send(zeromq::Message& message) const override;
+    bool SetCurve(const OTPassword& key) const override;
+    bool Start(const std::string& endpoint) const override;
+
+    ~RouterSocket();
+
+private:
+    friend opentxs::network::zeromq::RouterSocket;
+    typedef Socket ot_super;
+
+    const ListenCallback& callback_;
+    void* outgoing_pull_{nullptr};
+    void* outgoing_push_{nullptr};
+    mutable std::mutex push_lock_;
+    OTFlag running_;
+    std::unique_ptr<std::thread> thread_{nullptr};
+
+    RouterSocket* clone() const override;
+    bool forward(const Lock& lock) const;
+    bool receive(const Lock& lock, zeromq::Message& message) const;
+    void thread();
+
+    RouterSocket(
+        const zeromq::Context& context,
+        const ListenCallback& callback);
+    RouterSocket() = delete;
+    RouterSocket(const RouterSocket&) = delete;
+    RouterSocket(RouterSocket&&) = delete;
+    RouterSocket& operator=(const RouterSocket&) = delete;
+    RouterSocket& operator=(RouterSocket&&) = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
+#endif  // OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_ROUTERSOCKET_HPP
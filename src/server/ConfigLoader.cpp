@@ -103,6 +103,80 @@ bool ConfigLoader::load(
         Log::vOutput(0, "Using Wallet: %s\n", strValue.Get());
     }
 
+    // LEGACY STORAGE
+    {
+        const char* szComment = ";; LEGACY STORAGE  (accounts, boxes, receipts "
+                                "and other signed files)\n";
+
+        bool b_SectionExist = false;
+        config.CheckSetSection("legacy_storage", szComment, b_SectionExist);
+    }
+
+    {
+        const char* szComment = "; backend is either fs (one file per object) "
+                                "or pack (a single append-only\n"
+                                "; pack file with an index.)\n";
+
+        bool bIsNewKey = false;
+        String strValue;
+        config.CheckSet_str(
+            "legacy_storage",
+            "backend",
+            "fs",
+            strValue,
+            bIsNewKey,
+            szComment);
+        ServerSettings::__legacy_storage_pack = strValue.Compare("pack");
+    }
+
+    {
+        const char* szComment = "; import copies the existing file tree into "
+                                "the pack on the next startup,\n"
+                                "; and is then switched off again.\n";
+
+        bool bIsNewKey = false;
+        bool bValue = false;
+        config.CheckSet_bool(
+            "legacy_storage", "import", false, bValue, bIsNewKey, szComment);
+        ServerSettings::__legacy_storage_import = bValue;
+    }
+
+    {
+        const char* szComment = "; receipt_budget is the number of bytes of "
+                                "full box receipts kept in memory\n"
+                                "; for a box which is only partly needed to "
+                                "answer a request. 0 loads them all.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            "legacy_storage",
+            "receipt_budget",
+            ServerSettings::__receipt_budget,
+            lValue,
+            bIsNewKey,
+            szComment);
+        ServerSettings::__receipt_budget = (0 > lValue) ? 0 : lValue;
+    }
+
+    {
+        const char* szComment = "; hot_cache_budget is the number of bytes "
+                                "of verified accounts and boxes\n"
+                                "; kept in memory between requests. 0 "
+                                "disables the cache.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            "legacy_storage",
+            "hot_cache_budget",
+            ServerSettings::__hot_cache_budget,
+            lValue,
+            bIsNewKey,
+            szComment);
+        ServerSettings::__hot_cache_budget = (0 > lValue) ? 0 : lValue;
+    }
+
     // CRON
     {
         const char* szComment = ";; CRON  (regular events like market trades "
@@ -159,6 +233,34 @@ bool ConfigLoader::load(
         OTCron::SetCronMaxItemsPerNym(static_cast<std::int32_t>(lValue));
     }
 
+    {
+        const char* szComment = "; worker_threads is the maximum number of "
+                                "threads processing cron items.\n"
+                                "; Items that share no account, nym or market "
+                                "run in parallel. 0 means one per core.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            "cron", "worker_threads", 0, lValue, bIsNewKey, szComment);
+        OTCron::SetCronWorkerThreads(
+            static_cast<std::int32_t>((0 > lValue) ? 0 : lValue));
+    }
+
+    {
+        const char* szComment = "; journal_compact is the number of cron "
+                                "items added or removed before the\n"
+                                "; item index is rewritten and the journal "
+                                "of those changes is discarded.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            "cron", "journal_compact", 1000, lValue, bIsNewKey, szComment);
+        OTCron::SetCronJournalCompact(
+            static_cast<std::int32_t>((1 > lValue) ? 1 : lValue));
+    }
+
     // HEARTBEAT
 
     {
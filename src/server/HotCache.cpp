@@ -0,0 +1,191 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "HotCache.hpp"
+
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/Types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace opentxs::server
+{
+namespace
+{
+// Writes staged by a batch on the calling thread are not committed yet, so
+// the cache must neither hide them nor hold on to them.
+bool staged(const std::string& key)
+{
+    const auto* batch = OTDB::WriteBatch::Current();
+
+    if (nullptr == batch) { return false; }
+
+    std::string part[4]{};
+    std::size_t start{0};
+
+    for (auto& value : part) {
+        const auto end = key.find('\0', start);
+        value = key.substr(start, end - start);
+
+        if (std::string::npos == end) { break; }
+
+        start = end + 1;
+    }
+
+    std::string notUsed{};
+    bool exists{false};
+
+    return batch->Query(notUsed, exists, part[0], part[1], part[2], part[3]);
+}
+}  // namespace
+
+HotCache::HotCache()
+    : lock_()
+    , budget_(0)
+    , size_(0)
+    , writes_(0)
+    , entries_()
+    , lru_()
+{
+}
+
+void HotCache::erase(const std::map<std::string, Entry>::iterator& it)
+{
+    size_ -= it->first.size() + it->second.contents_.size();
+    lru_.erase(it->second.position_);
+    entries_.erase(it);
+}
+
+bool HotCache::Get(const std::string& key, std::string& contents)
+{
+    if (staged(key)) { return false; }
+
+    Lock lock(lock_);
+    auto it = entries_.find(key);
+
+    if (entries_.end() == it) { return false; }
+
+    auto& entry = it->second;
+    lru_.splice(lru_.begin(), lru_, entry.position_);
+    contents = entry.contents_;
+
+    return true;
+}
+
+void HotCache::insert(const std::string& key, const std::string& contents)
+{
+    auto it = entries_.find(key);
+
+    if (entries_.end() != it) { erase(it); }
+
+    const auto cost = key.size() + contents.size();
+
+    if (cost > budget_) { return; }
+
+    lru_.push_front(key);
+    auto& entry = entries_[key];
+    entry.contents_ = contents;
+    entry.position_ = lru_.begin();
+    size_ += cost;
+    trim();
+}
+
+// Same layout as the keys OTDB uses for the locations it reports
+std::string HotCache::Key(
+    const std::string& folder,
+    const std::string& one,
+    const std::string& two,
+    const std::string& three)
+{
+    return folder + '\0' + one + '\0' + two + '\0' + three;
+}
+
+void HotCache::Put(
+    const std::string& key,
+    const std::string& contents,
+    const std::uint64_t snapshot)
+{
+    if (staged(key)) { return; }
+
+    Lock lock(lock_);
+
+    if (snapshot != writes_) { return; }
+
+    insert(key, contents);
+}
+
+void HotCache::SetBudget(const std::size_t budget)
+{
+    Lock lock(lock_);
+    budget_ = budget;
+    trim();
+}
+
+std::uint64_t HotCache::Snapshot() const
+{
+    Lock lock(lock_);
+
+    return writes_;
+}
+
+void HotCache::trim()
+{
+    while (size_ > budget_) { erase(entries_.find(lru_.back())); }
+}
+
+void HotCache::Update(const std::string& key, const std::string* contents)
+{
+    Lock lock(lock_);
+    ++writes_;
+    auto it = entries_.find(key);
+
+    if (entries_.end() == it) { return; }
+
+    // Only locations which were loaded recently are kept current. Everything
+    // else the server writes would just evict them.
+    if (nullptr == contents) {
+        erase(it);
+    } else {
+        insert(key, *contents);
+    }
+}
+}  // namespace opentxs::server
@@ -0,0 +1,117 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_SERVER_HOTCACHE_HPP
+#define OPENTXS_SERVER_HOTCACHE_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace opentxs
+{
+namespace server
+{
+/** Keeps the serialized form of recently used accounts and boxes whose
+ *  signatures are known to be good, so they can be loaded again without
+ *  reading storage or verifying the notary signature.
+ *
+ *  Contents are cached after they pass verification, and are replaced
+ *  whenever the server saves the same location through OTDB. A location with
+ *  a write staged in the calling thread's OTDB::WriteBatch bypasses the
+ *  cache until that batch is committed. Least recently used entries are
+ *  evicted once the cached contents exceed the budget. */
+class HotCache
+{
+public:
+    static std::string Key(
+        const std::string& folder,
+        const std::string& one,
+        const std::string& two = "",
+        const std::string& three = "");
+
+    bool Get(const std::string& key, std::string& contents);
+    /** Caches contents which were loaded from storage and then verified.
+     *  Ignored if anything was written after snapshot was taken. */
+    void Put(
+        const std::string& key,
+        const std::string& contents,
+        const std::uint64_t snapshot);
+    void SetBudget(const std::size_t budget);
+    /** Take a snapshot before loading anything which will be passed to Put */
+    std::uint64_t Snapshot() const;
+    /** Called for every write through OTDB, to replace or drop the cached
+     *  contents of that location. contents is nullptr for erasures and
+     *  failed writes. */
+    void Update(const std::string& key, const std::string* contents);
+
+    HotCache();
+
+    ~HotCache() = default;
+
+private:
+    struct Entry {
+        std::string contents_{};
+        std::list<std::string>::iterator position_{};
+    };
+
+    mutable std::mutex lock_;
+    std::size_t budget_{0};
+    std::size_t size_{0};
+    std::uint64_t writes_{0};
+    std::map<std::string, Entry> entries_;
+    std::list<std::string> lru_;
+
+    void erase(const std::map<std::string, Entry>::iterator& it);
+    void insert(const std::string& key, const std::string& contents);
+    void trim();
+
+    HotCache(const HotCache&) = delete;
+    HotCache(HotCache&&) = delete;
+    HotCache& operator=(const HotCache&) = delete;
+    HotCache& operator=(HotCache&&) = delete;
+};
+}  // namespace server
+}  // namespace opentxs
+
+#endif  // OPENTXS_SERVER_HOTCACHE_HPP
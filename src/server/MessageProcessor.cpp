@@ -53,16 +53,19 @@
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/ReplyCallback.hpp"
-#include "opentxs/network/zeromq/ReplySocket.hpp"
+#include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/RouterSocket.hpp"
 
 #include "Server.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <stddef.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <functional>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #define OT_METHOD "opentxs::MessageProcessor::"
 
@@ -76,33 +79,126 @@ MessageProcessor::MessageProcessor(
     : server_(server)
     , running_(running)
     , context_(context)
-    , reply_socket_callback_(network::zeromq::ReplyCallback::Factory(
-          [this](const network::zeromq::Message& incoming) -> OTZMQMessage {
-              return this->processSocket(incoming);
-          }))
-    , reply_socket_(context.ReplySocket(reply_socket_callback_.get()))
+    , requests_()
+    , replies_()
     , thread_(nullptr)
+    , request_thread_(nullptr)
+    , finalizer_threads_()
+    , frontend_callback_(network::zeromq::ListenCallback::Factory(
+          [this](const network::zeromq::Message& incoming) -> void {
+              this->processSocket(incoming);
+          }))
+    , frontend_socket_(context.RouterSocket(frontend_callback_.get()))
 {
+    const auto finalizers =
+        std::max(std::thread::hardware_concurrency(), 1u);
+
+    for (std::size_t i = 0; i < finalizers; ++i) {
+        replies_.emplace_back(new Queue<Reply>);
+    }
 }
 
 void MessageProcessor::cleanup()
 {
+    // running_ is already off. Taking each queue lock before notifying makes
+    // sure no thread misses the wakeup between checking it and waiting.
+    wake(requests_);
+
+    for (auto& queue : replies_) { wake(*queue); }
+
     if (thread_) {
         thread_->join();
         thread_.reset();
     }
+
+    if (request_thread_) {
+        request_thread_->join();
+        request_thread_.reset();
+    }
+
+    for (auto& thread : finalizer_threads_) { thread.join(); }
+
+    finalizer_threads_.clear();
+}
+
+bool MessageProcessor::finalize(Message& reply, std::string& output) const
+{
+    // An empty serialization means the signature was deferred to this stage.
+    // SignContract serializes signing with the server nym on the nym itself,
+    // so this does not wait for the request thread to finish processing.
+    if (false == String(reply).Exists()) {
+        reply.SignContract(server_.GetServerNym());
+        reply.SaveContract();
+    }
+
+    String serializedReply(reply);
+
+    if (false == serializedReply.Exists()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to serialize reply."
+              << std::endl;
+
+        return false;
+    }
+
+    OTASCIIArmor armoredReply(serializedReply);
+
+    if (false == armoredReply.Exists()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to armor reply."
+              << std::endl;
+
+        return false;
+    }
+
+    output.assign(armoredReply.Get(), armoredReply.GetLength());
+
+    return true;
+}
+
+void MessageProcessor::finalizer(Queue<Reply>& queue)
+{
+    while (running_) {
+        std::unique_lock<std::mutex> lock(queue.lock_);
+        queue.ready_.wait(lock, [&] {
+            return (false == queue.items_.empty()) || (false == running_);
+        });
+
+        if (queue.items_.empty()) { continue; }
+
+        auto item = std::move(queue.items_.front());
+        queue.items_.pop_front();
+        lock.unlock();
+        std::string reply{};
+
+        if (item.reply_) {
+            if (false == finalize(*item.reply_, reply)) { reply = ""; }
+        }
+
+        item.envelope_->AddFrame(std::move(reply));
+        frontend_socket_->Send(item.envelope_);
+    }
 }
 
 void MessageProcessor::init(const int port, const OTPassword& privkey)
 {
     if (port == 0) { OT_FAIL; }
 
-    const auto set = reply_socket_->SetCurve(privkey);
+    const auto set = frontend_socket_->SetCurve(privkey);
 
     OT_ASSERT(set);
 
+    // The pipeline must be running before the first request can arrive
+    if (false == bool(request_thread_)) {
+        request_thread_.reset(
+            new std::thread(&MessageProcessor::processRequests, this));
+
+        for (auto& queue : replies_) {
+            finalizer_threads_.emplace_back(
+                &MessageProcessor::finalizer, this, std::ref(*queue));
+        }
+    }
+
     const auto endpoint = std::string("tcp://*:") + std::to_string(port);
-    const auto bound = reply_socket_->Start(endpoint);
+    const auto bound = frontend_socket_->Start(endpoint);
 
     OT_ASSERT(bound);
 }
@@ -114,7 +210,7 @@ void MessageProcessor::run()
         const auto timeout = server_.computeTimeout();
 
         if (timeout <= 0) {
-            // ProcessCron and processSocket must not run simultaneously
+            // ProcessCron and processRequests must not run simultaneously
             Lock lock(lock_);
             server_.ProcessCron();
         }
@@ -123,36 +219,15 @@ void MessageProcessor::run()
     }
 }
 
-OTZMQMessage MessageProcessor::processSocket(
-    const network::zeromq::Message& incoming)
-{
-    // ProcessCron and processSocket must not run simultaneously
-    Lock lock(lock_);
-    std::string reply{};
-
-    std::string messageString{};
-    if (0 < incoming.Body().size()) {
-        messageString = *incoming.Body().begin();
-    }
-
-    bool error = processMessage(messageString, reply);
-
-    if (error) { reply = ""; }
-
-    auto output = network::zeromq::Message::ReplyFactory(incoming);
-    output->AddFrame(reply);
-
-    return output;
-}
-
 bool MessageProcessor::processMessage(
-    const std::string& messageString,
-    std::string& reply)
+    const network::zeromq::Frame& frame,
+    Message& reply)
 {
-    if (messageString.size() < 1) { return true; }
+    if (frame.size() < 1) { return false; }
 
+    // Parse straight out of the zmq buffer
     OTASCIIArmor armored;
-    armored.MemSet(messageString.data(), messageString.size());
+    armored.MemSet(static_cast<const char*>(frame.data()), frame.size());
     String serialized;
     armored.GetString(serialized);
     Message request;
@@ -161,19 +236,20 @@ bool MessageProcessor::processMessage(
         otErr << OT_METHOD << __FUNCTION__ << ": Empty serialized request."
               << std::endl;
 
-        return true;
+        return false;
     }
 
     if (false == request.LoadContractFromString(serialized)) {
         otErr << OT_METHOD << __FUNCTION__
               << ": Failed to deserialized request." << std::endl;
 
-        return true;
+        return false;
     }
 
-    Message repy{};
-    const bool processed =
-        server_.userCommandProcessor_.ProcessUserCommand(request, repy);
+    // The reply is signed later by a finalizer thread, unless a copy of it
+    // had to be dropped into the nymbox, in which case it is already signed.
+    const bool processed = server_.userCommandProcessor_.ProcessUserCommand(
+        request, reply, false);
 
     if (false == processed) {
         otWarn << OT_METHOD << __FUNCTION__
@@ -186,27 +262,60 @@ bool MessageProcessor::processMessage(
                << request.m_strCommand << std::endl;
     }
 
-    String serializedReply(repy);
+    return true;
+}
 
-    if (false == serializedReply.Exists()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to serialize reply."
-              << std::endl;
+void MessageProcessor::processRequests()
+{
+    while (running_) {
+        std::unique_lock<std::mutex> queueLock(requests_.lock_);
+        requests_.ready_.wait(queueLock, [&] {
+            return (false == requests_.items_.empty()) || (false == running_);
+        });
 
-        return true;
-    }
+        if (requests_.items_.empty()) { continue; }
 
-    OTASCIIArmor armoredReply(serializedReply);
+        auto incoming = std::move(requests_.items_.front());
+        requests_.items_.pop_front();
+        queueLock.unlock();
+        const bool haveBody = (0 < incoming->Body().size());
+        Reply item{network::zeromq::Message::ReplyFactory(incoming), nullptr};
+        item.reply_.reset(new Message);
 
-    if (false == armoredReply.Exists()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to armor reply."
-              << std::endl;
+        OT_ASSERT(item.reply_);
 
-        return true;
-    }
+        {
+            // ProcessCron and processRequests must not run simultaneously
+            Lock lock(lock_);
+
+            if ((false == haveBody) ||
+                (false == processMessage(incoming->Body_at(0), *item.reply_))) {
+                item.reply_.reset();
+            }
+        }
 
-    reply.assign(armoredReply.Get(), armoredReply.GetLength());
+        // Replies to the same client always go through the same finalizer
+        std::string client{};
 
-    return false;
+        if (0 < incoming->Header().size()) {
+            client = *incoming->Header().begin();
+        }
+
+        auto& queue = *replies_.at(std::hash<std::string>{}(client) %
+                                   replies_.size());
+        Lock replyLock(queue.lock_);
+        queue.items_.emplace_back(std::move(item));
+        replyLock.unlock();
+        queue.ready_.notify_one();
+    }
+}
+
+void MessageProcessor::processSocket(const network::zeromq::Message& incoming)
+{
+    Lock lock(requests_.lock_);
+    requests_.items_.emplace_back(incoming);
+    lock.unlock();
+    requests_.ready_.notify_one();
 }
 
 void MessageProcessor::Start()
@@ -216,5 +325,13 @@ void MessageProcessor::Start()
     }
 }
 
+template <class T>
+void MessageProcessor::wake(Queue<T>& queue)
+{
+    Lock lock(queue.lock_);
+    lock.unlock();
+    queue.ready_.notify_all();
+}
+
 MessageProcessor::~MessageProcessor() {}
 }  // namespace opentxs::server
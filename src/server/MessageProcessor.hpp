@@ -46,14 +46,25 @@
 #include "opentxs/network/zeromq/Socket.hpp"
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace opentxs
 {
 namespace server
 {
+/** Requests are handled in two stages. The request thread runs the business
+ * logic (UserCommandProcessor) one request at a time, holding lock_. The
+ * finished reply is handed to a finalizer thread which signs, serializes and
+ * armors it while the request thread moves on to the next request. Signing
+ * only waits on the server nym's signing lock, which the request thread holds
+ * just while it signs something itself, never for a whole request. Every
+ * client is assigned to one finalizer, so its replies are sent in order. */
 class MessageProcessor : Lockable
 {
 public:
@@ -69,16 +80,40 @@ public:
     EXPORT ~MessageProcessor();
 
 private:
+    struct Reply {
+        OTZMQMessage envelope_;
+        std::unique_ptr<Message> reply_{nullptr};
+    };
+
+    template <class T>
+    struct Queue {
+        std::mutex lock_{};
+        std::condition_variable ready_{};
+        std::deque<T> items_{};
+    };
+
     Server& server_;
     const Flag& running_;
     [[maybe_unused]] const network::zeromq::Context& context_;
-    OTZMQReplyCallback reply_socket_callback_;
-    OTZMQReplySocket reply_socket_;
+    Queue<OTZMQMessage> requests_;
+    std::vector<std::unique_ptr<Queue<Reply>>> replies_;
     std::unique_ptr<std::thread> thread_{nullptr};
+    std::unique_ptr<std::thread> request_thread_{nullptr};
+    std::vector<std::thread> finalizer_threads_;
+    // Declared last, so the socket (and its callback) goes away first.
+    OTZMQListenCallback frontend_callback_;
+    OTZMQRouterSocket frontend_socket_;
 
-    bool processMessage(const std::string& messageString, std::string& reply);
-    OTZMQMessage processSocket(const network::zeromq::Message& incoming);
+    bool finalize(Message& reply, std::string& output) const;
+    void finalizer(Queue<Reply>& queue);
+    bool processMessage(
+        const network::zeromq::Frame& frame,
+        Message& reply);
+    void processRequests();
+    void processSocket(const network::zeromq::Message& incoming);
     void run();
+    template <class T>
+    void wake(Queue<T>& queue);
 };
 }  // namespace server
 }  // namespace opentxs
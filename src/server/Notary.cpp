@@ -70,6 +70,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/NumList.hpp"
 #include "opentxs/core/Nym.hpp"
+#include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/ext/OTPayment.hpp"
@@ -235,9 +236,10 @@ void Notary::NotarizeTransfer(
         pResponseBalanceItem->SetNumberOfOrigin(*pItem);
 
         // Set the ID on the To Account based on what the transaction request
-        // said. (So we can load it up.)
-        std::unique_ptr<Account> pDestinationAcct(Account::LoadExistingAccount(
-            pItem->GetDestinationAcctID(), NOTARY_ID));
+        // said. (So we can load it up.) The signature on it is verified here
+        // too, unless it was verified recently and is still in the hot cache.
+        auto pDestinationAcct =
+            server_.load_account(pItem->GetDestinationAcctID(), NOTARY_ID);
 
         // Only accept transfers with positive amounts.
         if (0 > pItem->GetAmount()) {
@@ -262,7 +264,7 @@ void Notary::NotarizeTransfer(
             Log::Output(
                 0,
                 "Notary::NotarizeTransfer: ERROR verifying "
-                "existence of the 'to' account.\n");
+                "existence or signature of the 'to' account.\n");
         }
         // Is the destination a legitimate other user's acct, or is it just an
         // internal server account?
@@ -292,15 +294,6 @@ void Notary::NotarizeTransfer(
                 strFromInstrumentDefinitionID.Get(),
                 strDestinationInstrumentDefinitionID.Get());
         }
-        // Does it verify?
-        // I call VerifySignature here since VerifyContractID was already called
-        // in LoadExistingAccount().
-        else if (!pDestinationAcct->VerifySignature(server_.m_nymServer)) {
-            Log::Output(
-                0,
-                "ERROR verifying signature on, the 'to' account "
-                "in Notary::NotarizeTransfer\n");
-        }
 
         // This entire function can be divided into the top and bottom halves.
         // The top half is oriented around finding the "transfer" item (in the
@@ -320,6 +313,11 @@ void Notary::NotarizeTransfer(
             Ledger theFromOutbox(NYM_ID, IDFromAccount, NOTARY_ID),
                 theToInbox(pItem->GetDestinationAcctID(), NOTARY_ID);
 
+            // The new pending transfer is only appended to these two boxes,
+            // so their existing box receipts are left abbreviated.
+            theFromOutbox.SetLazyReceipts(ServerSettings::__receipt_budget);
+            theToInbox.SetLazyReceipts(ServerSettings::__receipt_budget);
+
             bool bSuccessLoadingInbox = theToInbox.LoadInbox();
             bool bSuccessLoadingOutbox = theFromOutbox.LoadOutbox();
             // ...or generate them otherwise...
@@ -360,10 +358,10 @@ void Notary::NotarizeTransfer(
                 Log::Error("Notary::NotarizeTransfer: Error loading 'from' "
                            "outbox.\n");
 
-            std::unique_ptr<Ledger> pInbox(
-                theFromAccount.LoadInbox(server_.m_nymServer));
-            std::unique_ptr<Ledger> pOutbox(
-                theFromAccount.LoadOutbox(server_.m_nymServer));
+            std::unique_ptr<Ledger> pInbox(theFromAccount.LoadInbox(
+                server_.m_nymServer, ServerSettings::__receipt_budget));
+            std::unique_ptr<Ledger> pOutbox(theFromAccount.LoadOutbox(
+                server_.m_nymServer, ServerSettings::__receipt_budget));
 
             if (nullptr == pInbox) {
                 Log::Error("Error loading or verifying inbox.\n");
@@ -791,10 +789,10 @@ void Notary::NotarizeWithdrawal(
         // contains the server's funds to back vouchers of a specific instrument
         // definition
         std::shared_ptr<Account> pVoucherReserveAcct;
-        std::unique_ptr<Ledger> pInbox(
-            theAccount.LoadInbox(server_.m_nymServer));
-        std::unique_ptr<Ledger> pOutbox(
-            theAccount.LoadOutbox(server_.m_nymServer));
+        std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(
+            server_.m_nymServer, ServerSettings::__receipt_budget));
+        std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(
+            server_.m_nymServer, ServerSettings::__receipt_budget));
 
         // I'm using the operator== because it exists.
         // If the ID on the "from" account that was passed in,
@@ -1070,10 +1068,10 @@ void Notary::NotarizeWithdrawal(
             pItem->GetTransactionNum());  // This response item is IN RESPONSE
                                           // to
                                           // pItem and its Owner Transaction.
-        std::unique_ptr<Ledger> pInbox(
-            theAccount.LoadInbox(server_.m_nymServer));
-        std::unique_ptr<Ledger> pOutbox(
-            theAccount.LoadOutbox(server_.m_nymServer));
+        std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(
+            server_.m_nymServer, ServerSettings::__receipt_budget));
+        std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(
+            server_.m_nymServer, ServerSettings::__receipt_budget));
 
         std::shared_ptr<Mint> pMint{nullptr};
         Account* pMintCashReserveAcct = nullptr;
@@ -1779,10 +1777,10 @@ void Notary::NotarizePayDividend(
                 // individual receipts, containing the vouchers
                 // for any failures, so he can have a record of them, and so he
                 // can recover the funds.
-                std::unique_ptr<Ledger> pInbox(
-                    theSourceAccount.LoadInbox(server_.m_nymServer));
-                std::unique_ptr<Ledger> pOutbox(
-                    theSourceAccount.LoadOutbox(server_.m_nymServer));
+                std::unique_ptr<Ledger> pInbox(theSourceAccount.LoadInbox(
+                    server_.m_nymServer, ServerSettings::__receipt_budget));
+                std::unique_ptr<Ledger> pOutbox(theSourceAccount.LoadOutbox(
+                    server_.m_nymServer, ServerSettings::__receipt_budget));
                 // contains the server's funds to back vouchers of a specific
                 // instrument definition.
                 std::shared_ptr<Account> pVoucherReserveAcct;
@@ -2469,10 +2467,10 @@ void Notary::NotarizeDeposit(
             pItem->GetTransactionNum());  // This response item is IN RESPONSE
                                           // to
                                           // pItem and its Owner Transaction.
-        std::unique_ptr<Ledger> pInbox(
-            theAccount.LoadInbox(server_.m_nymServer));
-        std::unique_ptr<Ledger> pOutbox(
-            theAccount.LoadOutbox(server_.m_nymServer));
+        std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(
+            server_.m_nymServer, ServerSettings::__receipt_budget));
+        std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(
+            server_.m_nymServer, ServerSettings::__receipt_budget));
 
         if (nullptr == pInbox)  // ||
                                 // !pInbox->VerifyAccount(server_.m_nymServer))
@@ -2829,6 +2827,11 @@ void Notary::NotarizeDeposit(
                     NOTARY_ID);  // voucherReceipt goes here.
                 Ledger* pSenderInbox = &theSenderInbox;
                 Ledger* pRemitterInbox = &theRemitterInbox;
+                // The receipts are only appended to these boxes.
+                theSenderInbox.SetLazyReceipts(
+                    ServerSettings::__receipt_budget);
+                theRemitterInbox.SetLazyReceipts(
+                    ServerSettings::__receipt_budget);
                 Account* pRemitterAcct =
                     nullptr;  // Only used in the case of vouchers.
                 std::unique_ptr<Account> theRemitterAcctGuardian;
@@ -3898,10 +3901,10 @@ void Notary::NotarizeDeposit(
                 "account ID on the transaction does not match "
                 "'from' account ID on the deposit item.\n");
         } else {
-            std::unique_ptr<Ledger> pInbox(
-                theAccount.LoadInbox(server_.m_nymServer));
-            std::unique_ptr<Ledger> pOutbox(
-                theAccount.LoadOutbox(server_.m_nymServer));
+            std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(
+                server_.m_nymServer, ServerSettings::__receipt_budget));
+            std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(
+                server_.m_nymServer, ServerSettings::__receipt_budget));
 
             if (nullptr == pInbox) {
                 Log::Error("Notary::NotarizeDeposit: Error loading or "
@@ -5910,8 +5913,10 @@ void Notary::NotarizeExchangeBasket(
 
     const String strNymID(NYM_ID);
 
-    std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(server_.m_nymServer));
-    std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(server_.m_nymServer));
+    std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(
+        server_.m_nymServer, ServerSettings::__receipt_budget));
+    std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(
+        server_.m_nymServer, ServerSettings::__receipt_budget));
 
     pResponseItem =
         Item::CreateItemFromTransaction(tranOut, Item::atExchangeBasket);
@@ -6196,7 +6201,8 @@ void Notary::NotarizeExchangeBasket(
                                     // account, so we can drop the receipt.
                                     //
                                     Ledger* pSubInbox = pUserAcct->LoadInbox(
-                                        server_.m_nymServer);
+                                        server_.m_nymServer,
+                                        ServerSettings::__receipt_budget);
 
                                     if (nullptr == pSubInbox) {
                                         Log::Error("Error loading or "
@@ -7231,6 +7237,9 @@ void Notary::NotarizeTransaction(
     OTTransaction& tranOut,
     bool& bOutSuccess)
 {
+    // The accounts, ledgers and box receipts saved while notarizing this
+    // transaction are written together before it is signed.
+    OTDB::WriteBatch batch{};
     const std::int64_t lTransactionNumber = tranIn.GetTransactionNum();
     const auto NOTARY_ID = Identifier::Factory(server_.m_strNotaryID);
     auto NYM_ID = Identifier::Factory();
@@ -7650,6 +7659,16 @@ void Notary::NotarizeTransaction(
         }
     }
 
+    // Nothing about this transaction may reach the client until everything
+    // it changed is durable. A failed batch may still be replayed from the
+    // storage journal, so the server can neither report success nor failure.
+    if (false == batch.Commit()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to store transaction "
+              << lTransactionNumber << std::endl;
+
+        OT_FAIL;
+    }
+
     // sign the outoing transaction
     tranOut.SignContract(server_.m_nymServer);
     tranOut.SaveContract();  // don't forget to save (to internal raw file
@@ -7686,6 +7705,7 @@ void Notary::NotarizeProcessNymbox(
     OTTransaction& tranOut,
     bool& bOutSuccess)
 {
+    OTDB::WriteBatch batch{};
     // The outgoing transaction is an "atProcessNymbox", that is, "a reply to
     // the process nymbox request"
     tranOut.SetType(OTTransaction::atProcessNymbox);
@@ -7700,6 +7720,8 @@ void Notary::NotarizeProcessNymbox(
                NYM_ID = Identifier::Factory(theNym);
     std::set<TransactionNumber> newNumbers;
     Ledger theNymbox(NYM_ID, NYM_ID, NOTARY_ID);
+    // Only the entries the user is processing are loaded in full, below.
+    theNymbox.SetLazyReceipts(ServerSettings::__receipt_budget);
     String strNymID(NYM_ID);
     bool bSuccessLoadingNymbox = theNymbox.LoadNymbox();
 
@@ -7770,7 +7792,7 @@ void Notary::NotarizeProcessNymbox(
 
             if (pItem->GetType() == Item::acceptTransaction) {
                 OTTransaction* pTransaction =
-                    theNymbox.GetTransaction(pItem->GetReferenceToNum());
+                    theNymbox.GetFullTransaction(pItem->GetReferenceToNum());
 
                 if ((nullptr != pTransaction) &&
                     (pTransaction->GetType() ==
@@ -7937,7 +7959,7 @@ void Notary::NotarizeProcessNymbox(
                     OTTransaction* pServerTransaction = nullptr;
 
                     if ((nullptr !=
-                         (pServerTransaction = theNymbox.GetTransaction(
+                         (pServerTransaction = theNymbox.GetFullTransaction(
                               pItem->GetReferenceToNum()))) &&
                         ((OTTransaction::finalReceipt ==
                           pServerTransaction->GetType()) ||  // finalReceipt
@@ -8284,6 +8306,14 @@ void Notary::NotarizeProcessNymbox(
         const char* szFoldername = OTFolders::Receipt().Get();
         tranOut.SaveContract(szFoldername, strPath.Get());
     }
+
+    // Before the caller builds the reply (see NotarizeTransaction)
+    if (false == batch.Commit()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to store transaction "
+              << tranIn.GetTransactionNum() << std::endl;
+
+        OT_FAIL;
+    }
 }
 
 /// The client may send multiple transactions in the ledger when he calls
@@ -8299,6 +8329,7 @@ void Notary::NotarizeProcessInbox(
     OTTransaction& processInboxResponse,
     bool& bOutSuccess)
 {
+    OTDB::WriteBatch batch{};
     // The outgoing transaction is an "atProcessInbox", that is, "a reply to the
     // process inbox request"
     processInboxResponse.SetType(OTTransaction::atProcessInbox);
@@ -8321,8 +8352,10 @@ void Notary::NotarizeProcessInbox(
     const auto& NYM_ID(context.Nym()->GetConstID());
     const std::string strNymID(String(NYM_ID).Get());
     std::set<TransactionNumber> closedNumbers, closedCron;
-    std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(server_.m_nymServer));
-    std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(server_.m_nymServer));
+    std::unique_ptr<Ledger> pInbox(theAccount.LoadInbox(
+        server_.m_nymServer, ServerSettings::__receipt_budget));
+    std::unique_ptr<Ledger> pOutbox(theAccount.LoadOutbox(
+        server_.m_nymServer, ServerSettings::__receipt_budget));
     pResponseBalanceItem = Item::CreateItemFromTransaction(
         processInboxResponse, Item::atBalanceStatement);
     pResponseBalanceItem->SetStatus(Item::rejection);  // the default.
@@ -8414,7 +8447,7 @@ void Notary::NotarizeProcessInbox(
             case Item::disputeFinalReceipt:
             case Item::disputeBasketReceipt: {
                 pServerTransaction =
-                    pInbox->GetTransaction(pItem->GetReferenceToNum());
+                    pInbox->GetFullTransaction(pItem->GetReferenceToNum());
             } break;
             // Accept an incoming (pending) transfer.
             case Item::acceptPending:
@@ -8423,7 +8456,7 @@ void Notary::NotarizeProcessInbox(
             case Item::rejectPending:
             case Item::disputeItemReceipt: {
                 pServerTransaction =
-                    pInbox->GetTransaction(pItem->GetReferenceToNum());
+                    pInbox->GetFullTransaction(pItem->GetReferenceToNum());
             } break;
             default: {
                 String strItemType;
@@ -8960,6 +8993,8 @@ void Notary::NotarizeProcessInbox(
         // theAcctID is the ID on the client Account that was
         // passed in.
         Ledger theInbox(NYM_ID, ACCOUNT_ID, NOTARY_ID);
+        // Only the receipt being processed is loaded in full, below.
+        theInbox.SetLazyReceipts(ServerSettings::__receipt_budget);
 
         OTTransaction* pServerTransaction = nullptr;
 
@@ -8984,7 +9019,7 @@ void Notary::NotarizeProcessInbox(
              // keeping this safe.
              )  // especially in case this block moves
             // or is used elsewhere.
-            && (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            && (nullptr != (pServerTransaction = theInbox.GetFullTransaction(
                                 pItem->GetReferenceToNum()))) &&
             ((OTTransaction::paymentReceipt == pServerTransaction->GetType()) ||
              (OTTransaction::marketReceipt == pServerTransaction->GetType()))) {
@@ -9016,7 +9051,7 @@ void Notary::NotarizeProcessInbox(
              // keeping this safe.
              )  // especially in case this block moves
             // or is used elsewhere.
-            && (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            && (nullptr != (pServerTransaction = theInbox.GetFullTransaction(
                                 pItem->GetReferenceToNum()))) &&
             ((OTTransaction::finalReceipt == pServerTransaction->GetType()))) {
             // pItem contains the current user's attempt to
@@ -9047,7 +9082,7 @@ void Notary::NotarizeProcessInbox(
              // keeping this safe.
              )  // especially in case this block moves
             // or is used elsewhere.
-            && (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            && (nullptr != (pServerTransaction = theInbox.GetFullTransaction(
                                 pItem->GetReferenceToNum()))) &&
             ((OTTransaction::basketReceipt == pServerTransaction->GetType()))) {
             // pItem contains the current user's attempt to
@@ -9099,7 +9134,7 @@ void Notary::NotarizeProcessInbox(
                                                             // checkReceipts.
                                                             // Because they are
              ) &&
-            (nullptr != (pServerTransaction = theInbox.GetTransaction(
+            (nullptr != (pServerTransaction = theInbox.GetFullTransaction(
                              pItem->GetReferenceToNum()))) &&
             ((OTTransaction::pending ==
               pServerTransaction->GetType()) ||  // pending
@@ -9294,6 +9329,12 @@ void Notary::NotarizeProcessInbox(
                             IDFromAccount,
                             NOTARY_ID);  // Sender's *INBOX*
 
+                    // A receipt is appended to the inbox and the pending is
+                    // removed from the outbox, by number.
+                    theFromInbox.SetLazyReceipts(
+                        ServerSettings::__receipt_budget);
+                    theFromOutbox.SetLazyReceipts(
+                        ServerSettings::__receipt_budget);
                     bool bSuccessLoadingInbox = theFromInbox.LoadInbox();
                     bool bSuccessLoadingOutbox = theFromOutbox.LoadOutbox();
 
@@ -9606,5 +9647,13 @@ send_message:
     // Save the receipt. (My outgoing transaction including the client's signed
     // request that triggered it.)
     processInboxResponse.SaveContract(szFoldername, strPath.Get());
+
+    // Before the caller builds the reply (see NotarizeTransaction)
+    if (false == batch.Commit()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to store transaction "
+              << processInbox.GetTransactionNum() << std::endl;
+
+        OT_FAIL;
+    }
 }
 }  // namespace opentxs::server
@@ -63,13 +63,15 @@ ReplyMessage::ReplyMessage(
     const Message& input,
     Server& server,
     const MessageType& type,
-    Message& output)
+    Message& output,
+    const bool sign)
     : wallet_(wallet)
     , signer_(signer)
     , original_(input)
     , notary_id_(Identifier::Factory(notaryID))
     , message_(output)
     , server_(server)
+    , sign_(sign)
     , nymfile_(input.m_strNymID)
     , init_(false)
     , drop_(false)
@@ -354,10 +356,15 @@ void ReplyMessage::SetTargetNym(const String& nymID)
 
 ReplyMessage::~ReplyMessage()
 {
-    message_.SignContract(signer_);
-    message_.SaveContract();
+    const bool drop = drop_ && bool(context_);
+    const bool sign = sign_ || drop;
 
-    if (drop_ && context_) {
+    if (sign) {
+        message_.SignContract(signer_);
+        message_.SaveContract();
+    }
+
+    if (drop) {
         UserCommandProcessor::drop_reply_notice_to_nymbox(
             String(message_),
             original_.m_strRequestNum.ToLong(),
@@ -367,6 +374,7 @@ ReplyMessage::~ReplyMessage()
             &nymfile_);
     }
 
+    // A reply whose signature is deferred is signed with the hash included
     if (context_ && context_->It().HaveLocalNymboxHash()) {
         SetNymboxHash(context_->It().LocalNymboxHash());
     }
@@ -78,7 +78,8 @@ public:
         const Message& input,
         Server& server,
         const MessageType& type,
-        Message& output);
+        Message& output,
+        const bool sign = true);
 
     std::set<RequestNumber> Acknowledged() const;
     bool HaveContext() const;
@@ -120,6 +121,9 @@ private:
     const OTIdentifier notary_id_;
     Message& message_;
     Server& server_;
+    // When false, the reply is left for the caller to sign, unless it has to
+    // be signed here to drop a copy into the Nymbox.
+    const bool sign_{true};
     Nym nymfile_;
     bool init_{false};
     bool drop_{false};
@@ -55,7 +55,9 @@
 #include "opentxs/core/crypto/OTEnvelope.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/OTDataFolder.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/Account.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Log.hpp"
@@ -67,6 +69,7 @@
 #include "opentxs/ext/OTPayment.hpp"
 
 #include "ConfigLoader.hpp"
+#include "ServerSettings.hpp"
 #include "Transactor.hpp"
 
 #include <sys/types.h>
@@ -123,6 +126,7 @@ Server::Server(
     , notary_(*this, mint_, wallet_)
     , transactor_(this)
     , userCommandProcessor_(*this, config_, mint_, wallet_)
+    , hot_cache_()
     , m_strWalletFilename()
     , m_bReadOnly(false)
     , m_bShutdownFlag(false)
@@ -180,8 +184,63 @@ const Identifier& Server::GetServerID() const { return m_strNotaryID; }
 
 const Nym& Server::GetServerNym() const { return m_nymServer; }
 
+Transactor& Server::GetTransactor() { return transactor_; }
+
+UserCommandProcessor& Server::GetUserCommandProcessor()
+{
+    return userCommandProcessor_;
+}
+
 bool Server::IsFlaggedForShutdown() const { return m_bShutdownFlag; }
 
+std::unique_ptr<Account> Server::load_account(
+    const Identifier& accountID,
+    const Identifier& notaryID)
+{
+    const String id(accountID);
+    const auto key = HotCache::Key(OTFolders::Account().Get(), id.Get());
+    const auto snapshot = hot_cache_.Snapshot();
+    std::string cached{};
+
+    if (hot_cache_.Get(key, cached)) {
+        std::unique_ptr<Account> account(
+            new Account(Identifier::Factory(), accountID, notaryID));
+
+        OT_ASSERT(account);
+
+        if (account->LoadContractFromString(String(cached)) &&
+            account->VerifyContractID()) {
+
+            return account;
+        }
+
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Discarding invalid cached account " << id << std::endl;
+        hot_cache_.Update(key, nullptr);
+    }
+
+    std::unique_ptr<Account> account(
+        Account::LoadExistingAccount(accountID, notaryID));
+
+    if (false == bool(account)) { return {}; }
+
+    // VerifyContractID was already called in LoadExistingAccount
+    if (false == account->VerifySignature(m_nymServer)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid signature on account "
+              << id << std::endl;
+
+        return {};
+    }
+
+    String raw;
+
+    if (account->SaveContractRaw(raw)) {
+        hot_cache_.Put(key, raw.Get(), snapshot);
+    }
+
+    return account;
+}
+
 std::pair<std::string, std::string> Server::parse_seed_backup(
     const std::string& input) const
 {
@@ -490,6 +549,16 @@ void Server::Init(bool readOnly)
         OT_FAIL;
     }
 
+    hot_cache_.SetBudget(ServerSettings::__hot_cache_budget);
+    OTDB::SetWriteObserver([this](
+                               const std::string& folder,
+                               const std::string& one,
+                               const std::string& two,
+                               const std::string& three,
+                               const std::string* contents) -> void {
+        hot_cache_.Update(HotCache::Key(folder, one, two, three), contents);
+    });
+
     String dataPath;
     bool bGetDataFolderSuccess = OTDataFolder::Get(dataPath);
 
@@ -569,7 +638,23 @@ void Server::Init(bool readOnly)
             }
         }
     }
-    OTDB::InitDefaultStorage(OTDB_DEFAULT_STORAGE, OTDB_DEFAULT_PACKER);
+    OTDB::InitDefaultStorage(
+        ServerSettings::__legacy_storage_pack ? OTDB::STORE_PACK
+                                              : OTDB_DEFAULT_STORAGE,
+        OTDB_DEFAULT_PACKER);
+
+    if (ServerSettings::__legacy_storage_pack &&
+        ServerSettings::__legacy_storage_import && (false == readOnly)) {
+        auto* pack =
+            dynamic_cast<OTDB::StoragePack*>(OTDB::GetDefaultStorage());
+
+        if ((nullptr != pack) && (0 <= pack->ImportLegacy())) {
+            bool notUsed{false};
+            config_.Set_bool("legacy_storage", "import", false, notUsed);
+            config_.Save();
+            ServerSettings::__legacy_storage_import = false;
+        }
+    }
 
     // Load up the transaction number and other Server data members.
     bool mainFileExists = m_strWalletFilename.Exists()
@@ -995,6 +1080,11 @@ std::unique_ptr<OTPassword> Server::TransportKey(Data& pubkey) const
 
 Server::~Server()
 {
+    OTDB::SetWriteObserver({});
+    auto* pack = dynamic_cast<OTDB::StoragePack*>(OTDB::GetDefaultStorage());
+
+    if (nullptr != pack) { pack->Flush(); }
+
     // PID -- Set it to 0 in the lock file so the next time we run OT, it knows
     // there isn't
     // another copy already running (otherwise we might wind up with two copies
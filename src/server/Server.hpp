@@ -46,6 +46,7 @@
 #include "opentxs/core/Nym.hpp"
 #include "opentxs/core/OTTransaction.hpp"
 
+#include "HotCache.hpp"
 #include "Transactor.hpp"
 #include "Notary.hpp"
 #include "MainFile.hpp"
@@ -83,6 +84,9 @@ public:
         const;
     EXPORT const Identifier& GetServerID() const;
     EXPORT const Nym& GetServerNym() const;
+    /** For in-process drivers which bypass the network layer */
+    EXPORT Transactor& GetTransactor();
+    EXPORT UserCommandProcessor& GetUserCommandProcessor();
     EXPORT std::unique_ptr<OTPassword> TransportKey(Data& pubkey) const;
     EXPORT bool IsFlaggedForShutdown() const;
 
@@ -111,6 +115,7 @@ private:
     Notary notary_;
     Transactor transactor_;
     UserCommandProcessor userCommandProcessor_;
+    HotCache hot_cache_;
     String m_strWalletFilename;
     // Used at least for whether or not to write to the PID.
     bool m_bReadOnly{false};
@@ -150,6 +155,11 @@ private:
         const Identifier& recipientNymID,
         OTTransaction::transactionType transactionType,
         const Message& msg);
+    // Loads an account and verifies its ID and the server signature on it.
+    // The signature is not checked again if the account is in the hot cache.
+    std::unique_ptr<Account> load_account(
+        const Identifier& accountID,
+        const Identifier& notaryID);
     std::pair<std::string, std::string> parse_seed_backup(
         const std::string& input) const;
 
@@ -50,6 +50,10 @@ namespace opentxs::server
 // (static)
 
 std::int64_t ServerSettings::__min_market_scale = 1;
+bool ServerSettings::__legacy_storage_pack = false;
+bool ServerSettings::__legacy_storage_import = false;
+std::int64_t ServerSettings::__receipt_budget = 8 * 1024 * 1024;
+std::int64_t ServerSettings::__hot_cache_budget = 64 * 1024 * 1024;
 // The number of client requests that will be processed per heartbeat.
 std::int32_t ServerSettings::__heartbeat_no_requests = 10;
 // number of ms between each heartbeat.
@@ -86,6 +86,15 @@ struct ServerSettings {
 
     static std::int64_t __min_market_scale;
 
+    // Use OTDB::StoragePack instead of one file per object
+    static bool __legacy_storage_pack;
+    // Copy the existing file tree into the pack on startup
+    static bool __legacy_storage_import;
+    // Bytes of full box receipts kept in memory per box in lazy mode
+    static std::int64_t __receipt_budget;
+    // Bytes of verified accounts and boxes kept in memory across requests
+    static std::int64_t __hot_cache_budget;
+
     static std::int32_t __heartbeat_no_requests;
     static std::int32_t __heartbeat_ms_between_beats;
 
@@ -72,6 +72,7 @@
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/String.hpp"
 
+#include "HotCache.hpp"
 #include "Macros.hpp"
 #include "MainFile.hpp"
 #include "Notary.hpp"
@@ -649,8 +650,11 @@ bool UserCommandProcessor::cmd_delete_asset_account(ReplyMessage& reply) const
     //        return false;
     //    }
 
-    std::unique_ptr<Ledger> inbox(account->LoadInbox(serverNym));
-    std::unique_ptr<Ledger> outbox(account->LoadOutbox(serverNym));
+    // Only the number of entries is needed
+    std::unique_ptr<Ledger> inbox(
+        account->LoadInbox(serverNym, ServerSettings::__receipt_budget));
+    std::unique_ptr<Ledger> outbox(
+        account->LoadOutbox(serverNym, ServerSettings::__receipt_budget));
 
     if (false == bool(inbox)) {
         otErr << OT_METHOD << __FUNCTION__
@@ -1907,6 +1911,8 @@ bool UserCommandProcessor::cmd_register_account(ReplyMessage& reply) const
 
     Ledger outbox(nymID, accountID, serverID);
     Ledger inbox(nymID, accountID, serverID);
+    inbox.SetLazyReceipts(ServerSettings::__receipt_budget);
+    outbox.SetLazyReceipts(ServerSettings::__receipt_budget);
 
     bool inboxLoaded = inbox.LoadInbox();
     bool outboxLoaded = outbox.LoadOutbox();
@@ -2077,6 +2083,8 @@ bool UserCommandProcessor::cmd_register_instrument_definition(
 
     Ledger outbox(nymID, accountID, serverID);
     Ledger inbox(nymID, accountID, serverID);
+    inbox.SetLazyReceipts(ServerSettings::__receipt_budget);
+    outbox.SetLazyReceipts(ServerSettings::__receipt_budget);
 
     bool inboxLoaded = inbox.LoadInbox();
     bool outboxLoaded = outbox.LoadOutbox();
@@ -2204,6 +2212,7 @@ bool UserCommandProcessor::cmd_register_nym(ReplyMessage& reply) const
          NOTARY_ID = Identifier::Factory(server_.m_strNotaryID);
     nymfile.GetIdentifier(theNewNymID);
     Ledger theNymbox(theNewNymID, theNewNymID, NOTARY_ID);
+    theNymbox.SetLazyReceipts(ServerSettings::__receipt_budget);
     bool bSuccessLoadingNymbox = theNymbox.LoadNymbox();
 
     if (bSuccessLoadingNymbox) {
@@ -2714,16 +2723,9 @@ std::unique_ptr<Account> UserCommandProcessor::load_account(
     const Nym& clientNym,
     const Nym& serverNym) const
 {
-    std::unique_ptr<Account> account(new Account(nymID, accountID, serverID));
+    auto account = server_.load_account(accountID, serverID);
 
     if (false == bool(account)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to construct account "
-              << String(accountID) << " for " << String(nymID) << std::endl;
-
-        return {};
-    }
-
-    if (false == account->LoadContract()) {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed loading account "
               << String(accountID) << " for " << String(nymID) << std::endl;
 
@@ -2737,28 +2739,108 @@ std::unique_ptr<Account> UserCommandProcessor::load_account(
         return {};
     }
 
-    if (false == account->VerifyContractID()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Invalid ID on account "
+    if (false == account->VerifyOwner(clientNym)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Wrong owner on account "
               << String(accountID) << " for " << String(nymID) << std::endl;
 
         return {};
     }
 
-    if (false == account->VerifyOwner(clientNym)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Wrong owner on account "
-              << String(accountID) << " for " << String(nymID) << std::endl;
+    return account;
+}
 
-        return {};
+bool UserCommandProcessor::load_box(
+    const Identifier& ownerID,
+    Ledger& box,
+    const Ledger::ledgerType type,
+    const Nym& serverNym,
+    const bool full) const
+{
+    const char* folder = nullptr;
+
+    switch (type) {
+        case Ledger::nymbox: {
+            folder = OTFolders::Nymbox().Get();
+        } break;
+        case Ledger::inbox: {
+            folder = OTFolders::Inbox().Get();
+        } break;
+        case Ledger::outbox: {
+            folder = OTFolders::Outbox().Get();
+        } break;
+        default: {
+            OT_FAIL;
+        }
     }
 
-    if (false == account->VerifySignature(server_.m_nymServer)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Invalid signature on account "
-              << String(accountID) << " for " << String(nymID) << std::endl;
+    String boxID;
+    box.GetIdentifier(boxID);
+    auto& cache = server_.hot_cache_;
+    const auto key =
+        HotCache::Key(folder, String(box.GetRealNotaryID()).Get(), boxID.Get());
+    const auto snapshot = cache.Snapshot();
+    std::string cached{};
+
+    if (cache.Get(key, cached)) {
+        const String contents(cached);
+        bool loaded{false};
+
+        switch (type) {
+            case Ledger::nymbox: {
+                loaded = box.LoadNymboxFromString(contents);
+            } break;
+            case Ledger::inbox: {
+                loaded = box.LoadInboxFromString(contents);
+            } break;
+            default: {
+                loaded = box.LoadOutboxFromString(contents);
+            }
+        }
 
-        return {};
+        // The signature was verified before the box was cached
+        if (loaded && box.VerifyContractID()) {
+            if (full && (false == box.LazyReceipts())) {
+                std::set<std::int64_t> unloaded{};
+                box.LoadBoxReceipts(&unloaded);
+            }
+
+            return true;
+        }
+
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Discarding invalid cached box for " << String(ownerID)
+              << std::endl;
+        cache.Update(key, nullptr);
     }
 
-    return account;
+    bool loaded{false};
+
+    switch (type) {
+        case Ledger::nymbox: {
+            loaded = box.LoadNymbox();
+        } break;
+        case Ledger::inbox: {
+            loaded = box.LoadInbox();
+        } break;
+        default: {
+            loaded = box.LoadOutbox();
+        }
+    }
+
+    if (false == loaded) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load box for "
+              << String(ownerID) << std::endl;
+
+        return false;
+    }
+
+    if (false == verify_box(ownerID, box, serverNym, full)) { return false; }
+
+    String raw;
+
+    if (box.SaveContractRaw(raw)) { cache.Put(key, raw.Get(), snapshot); }
+
+    return true;
 }
 
 std::unique_ptr<Ledger> UserCommandProcessor::load_inbox(
@@ -2786,15 +2868,11 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_inbox(
         return {};
     }
 
-    if (false == inbox->LoadInbox()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load inbox for "
-              << String(nymID) << std::endl;
-
-        return {};
-    }
+    inbox->SetLazyReceipts(ServerSettings::__receipt_budget);
 
-    if (false == verify_box(nymID, *inbox, serverNym, verifyAccount)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to verify inbox for "
+    if (false ==
+        load_box(nymID, *inbox, Ledger::inbox, serverNym, verifyAccount)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load inbox for "
               << String(nymID) << std::endl;
 
         return {};
@@ -2824,15 +2902,11 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_nymbox(
         return {};
     }
 
-    if (false == nymbox->LoadNymbox()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load nymbox for "
-              << String(nymID) << std::endl;
-
-        return {};
-    }
+    nymbox->SetLazyReceipts(ServerSettings::__receipt_budget);
 
-    if (false == verify_box(nymID, *nymbox, serverNym, verifyAccount)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to verify nymbox for "
+    if (false ==
+        load_box(nymID, *nymbox, Ledger::nymbox, serverNym, verifyAccount)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load nymbox for "
               << String(nymID) << std::endl;
 
         return {};
@@ -2872,15 +2946,11 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_outbox(
         return {};
     }
 
-    if (false == outbox->LoadOutbox()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load outbox for "
-              << String(nymID) << std::endl;
+    outbox->SetLazyReceipts(ServerSettings::__receipt_budget);
 
-        return {};
-    }
-
-    if (false == verify_box(nymID, *outbox, serverNym, verifyAccount)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to verify outbox for "
+    if (false ==
+        load_box(nymID, *outbox, Ledger::outbox, serverNym, verifyAccount)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load outbox for "
               << String(nymID) << std::endl;
 
         return {};
@@ -2897,7 +2967,8 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_outbox(
 
 bool UserCommandProcessor::ProcessUserCommand(
     const Message& msgIn,
-    Message& msgOut)
+    Message& msgOut,
+    const bool sign)
 {
     const std::string command(msgIn.m_strCommand.Get());
     const auto type = Message::Type(command);
@@ -2908,7 +2979,8 @@ bool UserCommandProcessor::ProcessUserCommand(
         msgIn,
         server_,
         type,
-        msgOut);
+        msgOut,
+        sign);
 
     if (false == reply.Init()) { return false; }
 
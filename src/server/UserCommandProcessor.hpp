@@ -41,6 +41,7 @@
 
 #include "Internal.hpp"
 
+#include "opentxs/core/Ledger.hpp"
 #include "opentxs/Types.hpp"
 
 #include <cstdint>
@@ -52,7 +53,6 @@ class Account;
 class ClientContext;
 class Data;
 class Identifier;
-class Ledger;
 class Message;
 class Nym;
 class NumList;
@@ -95,7 +95,12 @@ public:
         Nym* actualNym = nullptr);
     static bool isAdmin(const Identifier& nymID);
 
-    bool ProcessUserCommand(const Message& msgIn, Message& msgOut);
+    /** When sign is false, msgOut is only signed if a copy of it was dropped
+     * into the Nymbox. Otherwise the caller must sign it. */
+    bool ProcessUserCommand(
+        const Message& msgIn,
+        Message& msgOut,
+        const bool sign = true);
 
 private:
     friend class Server;
@@ -189,6 +194,13 @@ private:
         const Identifier& serverID,
         const Nym& clientNym,
         const Nym& serverNym) const;
+    // Loads and verifies a box, from the hot cache if possible
+    bool load_box(
+        const Identifier& ownerID,
+        Ledger& box,
+        const Ledger::ledgerType type,
+        const Nym& serverNym,
+        const bool full) const;
     std::unique_ptr<Ledger> load_inbox(
         const Identifier& nymID,
         const Identifier& accountID,
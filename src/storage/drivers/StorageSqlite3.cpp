@@ -101,7 +101,8 @@ bool StorageSqlite3::commit_transaction(const std::string& rootHash) const
     set_root(rootHash, sql);
     commit(sql);
     pending_.clear();
-    otInfo << sql.str() << std::endl;
+    OT_LOG_RECORD(2, "StorageSqlite3::commit_transaction")
+        .Add("sql", sql.str());
 
     return (
         SQLITE_OK ==
@@ -195,7 +196,7 @@ bool StorageSqlite3::Select(
         "SELECT v FROM '" + tablename + "' WHERE k GLOB ?1;";
     const auto sql = bind_key(query, key, 1);
     sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, 0);
-    otInfo << sql << std::endl;
+    OT_LOG_RECORD(2, "StorageSqlite3::Select").Add("sql", sql);
     auto result = sqlite3_step(statement);
     bool success = false;
     std::size_t retry{3};
@@ -348,7 +349,13 @@ bool StorageSqlite3::Upsert(
     sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, 0);
     sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
     sqlite3_bind_blob(statement, 2, value.c_str(), value.size(), SQLITE_STATIC);
-    otInfo << sqlite3_expanded_sql(statement) << std::endl;
+
+    if (OT_LOG_ENABLED(2)) {
+        auto* expanded = sqlite3_expanded_sql(statement);
+        OT_LOG_RECORD(2, "StorageSqlite3::Upsert").Add("sql", expanded);
+        sqlite3_free(expanded);
+    }
+
     const auto result = sqlite3_step(statement);
     sqlite3_finalize(statement);
 
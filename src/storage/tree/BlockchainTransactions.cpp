@@ -71,7 +71,7 @@ bool BlockchainTransactions::Delete(const std::string& id)
 void BlockchainTransactions::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageBlockchainTransactions> serialized{nullptr};
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (false == bool(serialized)) {
         otErr << OT_METHOD << __FUNCTION__
@@ -115,7 +115,7 @@ bool BlockchainTransactions::save(const Lock& lock) const
 
     if (false == proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageBlockchainTransactions BlockchainTransactions::serialize() const
@@ -123,17 +123,6 @@ proto::StorageBlockchainTransactions BlockchainTransactions::serialize() const
     proto::StorageBlockchainTransactions serialized{};
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(
-                item.first, item.second, *serialized.add_transaction());
-        }
-    }
-
     return serialized;
 }
 
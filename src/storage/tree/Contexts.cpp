@@ -64,7 +64,7 @@ bool Contexts::Delete(const std::string& id) { return delete_item(id); }
 void Contexts::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageNymList> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load servers index file."
@@ -103,7 +103,7 @@ bool Contexts::save(const std::unique_lock<std::mutex>& lock) const
 
     if (false == proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageNymList Contexts::serialize() const
@@ -111,16 +111,6 @@ proto::StorageNymList Contexts::serialize() const
     proto::StorageNymList serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
-
     return serialized;
 }
 
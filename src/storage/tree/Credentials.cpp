@@ -101,7 +101,7 @@ bool Credentials::Delete(const std::string& id) { return delete_item(id); }
 void Credentials::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageCredentials> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load credentials index file."
@@ -160,7 +160,7 @@ bool Credentials::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageCredentials Credentials::serialize() const
@@ -168,16 +168,6 @@ proto::StorageCredentials Credentials::serialize() const
     proto::StorageCredentials serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_cred());
-        }
-    }
-
     return serialized;
 }
 
@@ -197,6 +187,7 @@ bool Credentials::Store(const proto::Credential& cred, const std::string& alias)
 
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    item_changed(id);
 
     if (existingKey && incomingPublic) {
         if (!check_existing(incomingPrivate, metadata)) {
@@ -0,0 +1,443 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "stdafx.hpp"
+
+#include "IndexTrie.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <vector>
+
+#define INDEX_TRIE_BUCKET_SIZE 32
+#define INDEX_TRIE_MAX_DEPTH 16
+
+#define OT_METHOD "opentxs::storage::IndexTrie::"
+
+namespace opentxs::storage
+{
+const std::string IndexTrie::NODE_MAGIC{"opentxs-index-node"};
+const std::string IndexTrie::ROOT_MAGIC{"opentxs-index"};
+
+IndexTrie::IndexTrie(const opentxs::api::storage::Driver& driver)
+    : driver_(driver)
+    , meta_()
+    , trie_(new TrieNode)
+{
+    OT_ASSERT(trie_)
+}
+
+void IndexTrie::append(const std::string& field, std::string& output)
+{
+    output += std::to_string(field.size());
+    output += ':';
+    output += field;
+}
+
+bool IndexTrie::Check(const std::string& raw)
+{
+    std::size_t position{0};
+    std::string magic{};
+
+    if (false == read(raw, position, magic)) { return false; }
+
+    return ROOT_MAGIC == magic;
+}
+
+void IndexTrie::erase(const std::string& id)
+{
+    const auto hash = key_hash(id);
+    std::vector<std::pair<TrieNode*, std::uint8_t>> parents{};
+    TrieNode* node = trie_.get();
+    std::size_t depth{0};
+
+    while (false == node->leaf_) {
+        const auto position = slot(hash, depth++);
+        auto it = node->children_.find(position);
+
+        if (node->children_.end() == it) { return; }
+
+        parents.emplace_back(node, position);
+        node = it->second.get();
+    }
+
+    if (0 == node->keys_.erase(id)) { return; }
+
+    node->hash_.clear();
+
+    for (auto i = parents.rbegin(); i != parents.rend(); ++i) {
+        auto& [parent, position] = *i;
+        parent->hash_.clear();
+        const auto& child = parent->children_.at(position);
+
+        if (child->leaf_ && child->keys_.empty()) {
+            parent->children_.erase(position);
+        }
+
+        merge(*parent);
+    }
+}
+
+void IndexTrie::insert(const std::string& id)
+{
+    const auto hash = key_hash(id);
+    TrieNode* node = trie_.get();
+    std::size_t depth{0};
+
+    while (false == node->leaf_) {
+        node->hash_.clear();
+        auto& child = node->children_[slot(hash, depth++)];
+
+        if (false == bool(child)) { child.reset(new TrieNode); }
+
+        OT_ASSERT(child)
+
+        node = child.get();
+    }
+
+    node->hash_.clear();
+    node->keys_.emplace(id);
+
+    if ((INDEX_TRIE_BUCKET_SIZE < node->keys_.size()) &&
+        (INDEX_TRIE_MAX_DEPTH > depth)) {
+        split(*node, depth);
+    }
+}
+
+// FNV-1a, which only needs to be stable so entries can be found again
+std::uint64_t IndexTrie::key_hash(const std::string& id)
+{
+    std::uint64_t output{14695981039346656037ULL};
+
+    for (const auto& c : id) {
+        output ^= static_cast<std::uint8_t>(c);
+        output *= 1099511628211ULL;
+    }
+
+    return output;
+}
+
+bool IndexTrie::Load(const std::string& raw, std::string& meta, Entries& output)
+{
+    std::size_t position{0};
+    std::string magic{};
+    std::string root{};
+    bool valid = read(raw, position, magic);
+    valid &= read(raw, position, meta);
+    valid &= read(raw, position, root);
+
+    if ((false == valid) || (ROOT_MAGIC != magic)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid root object"
+              << std::endl;
+
+        return false;
+    }
+
+    meta_ = meta;
+    trie_.reset(new TrieNode);
+    output.clear();
+
+    OT_ASSERT(trie_)
+
+    return load_node(root, *trie_, output);
+}
+
+bool IndexTrie::load_node(
+    const std::string& hash,
+    TrieNode& node,
+    Entries& output)
+{
+    std::string raw{};
+
+    if (false == driver_.Load(hash, false, raw)) { return false; }
+
+    std::size_t position{0};
+    std::string magic{};
+    std::string type{};
+    bool valid = read(raw, position, magic);
+    valid &= read(raw, position, type);
+
+    if ((false == valid) || (NODE_MAGIC != magic)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid node " << hash
+              << std::endl;
+
+        return false;
+    }
+
+    node.hash_ = hash;
+
+    if ("leaf" == type) {
+        node.leaf_ = true;
+        std::string id{};
+        std::string item{};
+        std::string alias{};
+
+        while (position < raw.size()) {
+            valid = read(raw, position, id);
+            valid &= read(raw, position, item);
+            valid &= read(raw, position, alias);
+
+            if (false == valid) { return false; }
+
+            node.keys_.emplace(id);
+            output[id] = {item, alias};
+        }
+
+        return true;
+    }
+
+    if ("branch" != type) { return false; }
+
+    node.leaf_ = false;
+    std::string index{};
+    std::string child{};
+
+    while (position < raw.size()) {
+        valid = read(raw, position, index);
+        valid &= read(raw, position, child);
+
+        if (false == valid) { return false; }
+
+        std::uint8_t branch{0};
+
+        try {
+            branch = static_cast<std::uint8_t>(std::stoul(index));
+        } catch (...) {
+
+            return false;
+        }
+
+        auto& next = node.children_[branch];
+        next.reset(new TrieNode);
+
+        OT_ASSERT(next)
+
+        if (false == load_node(child, *next, output)) { return false; }
+    }
+
+    return true;
+}
+
+// Turns a branch back into a leaf once all of its entries fit in one bucket.
+// Returns true if the node is a leaf afterwards.
+bool IndexTrie::merge(TrieNode& node)
+{
+    if (node.leaf_) { return true; }
+
+    std::size_t count{0};
+
+    for (const auto& it : node.children_) {
+        const auto& child = *it.second;
+
+        if (false == child.leaf_) { return false; }
+
+        count += child.keys_.size();
+    }
+
+    if (INDEX_TRIE_BUCKET_SIZE < count) { return false; }
+
+    for (const auto& it : node.children_) {
+        const auto& child = *it.second;
+        node.keys_.insert(child.keys_.begin(), child.keys_.end());
+    }
+
+    node.children_.clear();
+    node.leaf_ = true;
+    node.hash_.clear();
+
+    return true;
+}
+
+bool IndexTrie::Migrate(const opentxs::api::storage::Driver& to) const
+{
+    bool output{true};
+
+    if (false == meta_.empty()) { output &= driver_.Migrate(meta_, to); }
+
+    output &= migrate_node(*trie_, to);
+
+    return output;
+}
+
+bool IndexTrie::migrate_node(
+    const TrieNode& node,
+    const opentxs::api::storage::Driver& to) const
+{
+    if (node.hash_.empty()) { return true; }
+
+    bool output = driver_.Migrate(node.hash_, to);
+
+    for (const auto& it : node.children_) {
+        output &= migrate_node(*it.second, to);
+    }
+
+    return output;
+}
+
+bool IndexTrie::read(
+    const std::string& input,
+    std::size_t& position,
+    std::string& field)
+{
+    const auto colon = input.find(':', position);
+
+    if (std::string::npos == colon) { return false; }
+
+    std::size_t size{0};
+
+    try {
+        size = std::stoul(input.substr(position, colon - position));
+    } catch (...) {
+
+        return false;
+    }
+
+    if ((colon + 1 + size) > input.size()) { return false; }
+
+    field = input.substr(colon + 1, size);
+    position = colon + 1 + size;
+
+    return true;
+}
+
+std::uint8_t IndexTrie::slot(const std::uint64_t hash, const std::size_t depth)
+{
+    return static_cast<std::uint8_t>((hash >> (60 - (4 * depth))) & 0xf);
+}
+
+void IndexTrie::split(TrieNode& node, const std::size_t depth)
+{
+    node.leaf_ = false;
+    node.hash_.clear();
+
+    for (const auto& id : node.keys_) {
+        auto& child = node.children_[slot(key_hash(id), depth)];
+
+        if (false == bool(child)) { child.reset(new TrieNode); }
+
+        OT_ASSERT(child)
+
+        child->keys_.emplace(id);
+    }
+
+    node.keys_.clear();
+
+    for (auto& it : node.children_) {
+        auto& child = *it.second;
+
+        if ((INDEX_TRIE_BUCKET_SIZE < child.keys_.size()) &&
+            (INDEX_TRIE_MAX_DEPTH > (depth + 1))) {
+            split(child, depth + 1);
+        }
+    }
+}
+
+bool IndexTrie::Store(
+    const std::string& meta,
+    const Items& items,
+    const std::set<std::string>& changed,
+    const std::function<bool(const std::string&)>& valid,
+    std::string& root)
+{
+    for (const auto& id : changed) {
+        const auto it = items.find(id);
+        const bool keep = (items.end() != it) && (false == id.empty()) &&
+                          valid(std::get<0>(it->second));
+
+        if (keep) {
+            insert(id);
+        } else {
+            erase(id);
+        }
+    }
+
+    if (false == write_node(*trie_, items)) { return false; }
+
+    std::string raw{};
+    append(ROOT_MAGIC, raw);
+    append(meta, raw);
+    append(trie_->hash_, raw);
+
+    if (false == driver_.Store(true, raw, root)) { return false; }
+
+    meta_ = meta;
+
+    return true;
+}
+
+bool IndexTrie::write_node(TrieNode& node, const Items& items)
+{
+    if (false == node.hash_.empty()) { return true; }
+
+    std::string raw{};
+    append(NODE_MAGIC, raw);
+
+    if (node.leaf_) {
+        append("leaf", raw);
+
+        for (const auto& id : node.keys_) {
+            const auto it = items.find(id);
+
+            if (items.end() == it) {
+                otErr << OT_METHOD << __FUNCTION__ << ": Missing item " << id
+                      << std::endl;
+
+                return false;
+            }
+
+            append(id, raw);
+            append(std::get<0>(it->second), raw);
+            append(std::get<1>(it->second), raw);
+        }
+    } else {
+        append("branch", raw);
+
+        for (auto& [position, child] : node.children_) {
+            OT_ASSERT(child)
+
+            if (false == write_node(*child, items)) { return false; }
+
+            append(std::to_string(position), raw);
+            append(child->hash_, raw);
+        }
+    }
+
+    return driver_.Store(true, raw, node.hash_);
+}
+}  // namespace opentxs::storage
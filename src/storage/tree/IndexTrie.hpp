@@ -0,0 +1,159 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_STORAGE_TREE_INDEXTRIE_HPP
+#define OPENTXS_STORAGE_TREE_INDEXTRIE_HPP
+
+#include "Internal.hpp"
+
+#include "opentxs/api/storage/Driver.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+
+namespace opentxs
+{
+namespace storage
+{
+/** Persistent hash array mapped trie used to store the item index of a Node
+ *
+ *  Entries are placed by a hash of their id, four bits per level. Leaves hold
+ *  up to INDEX_TRIE_BUCKET_SIZE entries and are split into branches when they
+ *  grow larger, and branches whose leaves fit in one bucket again are merged
+ *  back into a leaf. Every trie node is stored as a separate content-addressed
+ *  object, so a change only rewrites the nodes on the path to the changed
+ *  entries. Unchanged subtrees are shared with earlier roots, which therefore
+ *  remain valid snapshots until they are garbage collected.
+ *
+ *  Only the ids are kept in memory. The hash and alias of each entry are read
+ *  from the owning Node's index when a leaf is written.
+ *
+ *  The root object contains the hash of the trie root node and the hash of a
+ *  metadata object in which the owning Node stores everything except its
+ *  item index.
+ */
+class IndexTrie
+{
+public:
+    /** id, hash, alias */
+    typedef std::map<std::string, std::pair<std::string, std::string>> Entries;
+    /** The item index of a Node */
+    typedef std::map<
+        std::string,
+        std::tuple<std::string, std::string, std::uint64_t, bool>>
+        Items;
+
+    /** Returns true if raw is an IndexTrie root object */
+    static bool Check(const std::string& raw);
+
+    /** Read every entry from the root object in raw
+     *
+     *  \param[in] raw the root object
+     *  \param[out] meta the hash of the metadata object
+     *  \param[out] output the stored entries
+     */
+    bool Load(const std::string& raw, std::string& meta, Entries& output);
+    bool Migrate(const opentxs::api::storage::Driver& to) const;
+    /** Apply the changed entries to the trie and save a new root object
+     *
+     *  \param[in] meta the hash of the metadata object
+     *  \param[in] items the complete current index
+     *  \param[in] changed the ids added, modified or removed since the last
+     *                     Store
+     *  \param[in] valid filters out entries with an invalid hash
+     *  \param[out] root the hash of the new root object
+     */
+    bool Store(
+        const std::string& meta,
+        const Items& items,
+        const std::set<std::string>& changed,
+        const std::function<bool(const std::string&)>& valid,
+        std::string& root);
+
+    explicit IndexTrie(const opentxs::api::storage::Driver& driver);
+
+    ~IndexTrie() = default;
+
+private:
+    struct TrieNode {
+        std::string hash_{};
+        bool leaf_{true};
+        std::set<std::string> keys_{};
+        std::map<std::uint8_t, std::unique_ptr<TrieNode>> children_{};
+    };
+
+    static const std::string NODE_MAGIC;
+    static const std::string ROOT_MAGIC;
+
+    const opentxs::api::storage::Driver& driver_;
+    std::string meta_;
+    std::unique_ptr<TrieNode> trie_;
+
+    static void append(const std::string& field, std::string& output);
+    static std::uint64_t key_hash(const std::string& id);
+    static bool merge(TrieNode& node);
+    static bool read(
+        const std::string& input,
+        std::size_t& position,
+        std::string& field);
+    static std::uint8_t slot(const std::uint64_t hash, const std::size_t depth);
+
+    void erase(const std::string& id);
+    void insert(const std::string& id);
+    bool load_node(const std::string& hash, TrieNode& node, Entries& output);
+    bool migrate_node(
+        const TrieNode& node,
+        const opentxs::api::storage::Driver& to) const;
+    void split(TrieNode& node, const std::size_t depth);
+    bool write_node(TrieNode& node, const Items& items);
+
+    IndexTrie() = delete;
+    IndexTrie(const IndexTrie&) = delete;
+    IndexTrie(IndexTrie&&) = delete;
+    IndexTrie& operator=(const IndexTrie&) = delete;
+    IndexTrie& operator=(IndexTrie&&) = delete;
+};
+}  // namespace storage
+}  // namespace opentxs
+#endif  // OPENTXS_STORAGE_TREE_INDEXTRIE_HPP
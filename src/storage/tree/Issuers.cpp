@@ -66,7 +66,7 @@ bool Issuers::Delete(const std::string& id) { return delete_item(id); }
 void Issuers::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageIssuers> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load issuers index file."
@@ -104,7 +104,7 @@ bool Issuers::save(const std::unique_lock<std::mutex>& lock) const
 
     if (false == proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageIssuers Issuers::serialize() const
@@ -112,16 +112,6 @@ proto::StorageIssuers Issuers::serialize() const
     proto::StorageIssuers serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_issuer());
-        }
-    }
-
     return serialized;
 }
 
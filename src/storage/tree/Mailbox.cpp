@@ -44,6 +44,13 @@
 
 namespace opentxs
 {
+storage::Mailbox* Factory::StorageMailbox(
+    const api::storage::Driver& storage,
+    const std::string& hash)
+{
+    return new storage::Mailbox(storage, hash);
+}
+
 namespace storage
 {
 Mailbox::Mailbox(
@@ -64,7 +71,7 @@ bool Mailbox::Delete(const std::string& id) { return delete_item(id); }
 void Mailbox::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageNymList> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load mailbox index file."
@@ -103,7 +110,7 @@ bool Mailbox::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageNymList Mailbox::serialize() const
@@ -111,20 +118,6 @@ proto::StorageNymList Mailbox::serialize() const
     proto::StorageNymList serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(
-                item.first,
-                item.second,
-                *serialized.add_nym(),
-                proto::STORAGEHASH_RAW);
-        }
-    }
-
     return serialized;
 }
 
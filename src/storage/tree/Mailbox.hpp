@@ -55,6 +55,7 @@ class Nym;
 class Mailbox : public Node
 {
 private:
+    friend Factory;
     friend class Nym;
 
     void init(const std::string& hash) override;
@@ -72,6 +72,8 @@ bool Node::delete_item(const std::string& id)
 
     if (0 == items) { return false; }
 
+    item_changed(id);
+
     return save(lock);
 }
 
@@ -101,6 +103,11 @@ std::string Node::get_alias(const std::string& id) const
     return output;
 }
 
+void Node::item_changed(const std::string& id) const
+{
+    if (index_) { changed_.emplace(id); }
+}
+
 ObjectList Node::List() const
 {
     ObjectList output;
@@ -163,7 +170,7 @@ bool Node::Migrate(const opentxs::api::storage::Driver& to) const
     }
 
     bool output{true};
-    output &= migrate(root_, to);
+    output &= migrate_root(to);
 
     for (const auto& item : item_map_) {
         const auto& hash = std::get<0>(item.second);
@@ -173,6 +180,15 @@ bool Node::Migrate(const opentxs::api::storage::Driver& to) const
     return output;
 }
 
+bool Node::migrate_root(const opentxs::api::storage::Driver& to) const
+{
+    bool output = migrate(root_, to);
+
+    if (index_) { output &= index_->Migrate(to); }
+
+    return output;
+}
+
 std::string Node::normalize_hash(const std::string& hash)
 {
     if (hash.empty()) { return BLANK_HASH; }
@@ -223,6 +239,7 @@ bool Node::set_alias(const std::string& id, const std::string& alias)
     if (!exists) { return false; }
 
     std::get<1>(item_map_[id]) = alias;
+    item_changed(id);
 
     return save(lock);
 }
@@ -264,6 +281,7 @@ bool Node::store_raw(
 
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    item_changed(id);
 
     if (!driver_.Store(true, data, hash)) { return false; }
 
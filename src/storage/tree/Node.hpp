@@ -46,9 +46,12 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
+#include "IndexTrie.hpp"
+
 #include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <tuple>
 
@@ -75,6 +78,78 @@ typedef std::map<std::string, Metadata> Index;
 class Node
 {
 protected:
+    /** Load an index object which might be stored either as a single proto or
+     *  as an IndexTrie
+     *
+     *  Items stored in an IndexTrie are added to item_map_, and the proto
+     *  only contains the fields which are not part of the item index.
+     */
+    template <class T>
+    bool load_index(const std::string& hash, std::shared_ptr<T>& serialized)
+    {
+        std::string raw{};
+
+        if (false == driver_.Load(hash, false, raw)) { return false; }
+
+        if (false == IndexTrie::Check(raw)) {
+
+            return driver_.LoadProto(hash, serialized);
+        }
+
+        std::string meta{};
+        IndexTrie::Entries entries{};
+        index_.reset(new IndexTrie(driver_));
+
+        OT_ASSERT(index_)
+
+        if (false == index_->Load(raw, meta, entries)) { return false; }
+
+        for (const auto& [id, entry] : entries) {
+            const auto& [itemHash, alias] = entry;
+            item_map_.emplace(id, Metadata{itemHash, alias, 0, false});
+        }
+
+        return driver_.LoadProto(meta, serialized);
+    }
+
+    /** Store the contents of item_map_ as an IndexTrie, along with a proto
+     *  containing the fields which are not part of the item index
+     *
+     *  Only the items recorded by item_changed since the last successful
+     *  call are written. The first call for a node which was not loaded from
+     *  an IndexTrie writes every item.
+     */
+    template <class T>
+    bool store_index(const Lock& lock, const T& serialized) const
+    {
+        OT_ASSERT(verify_write_lock(lock))
+
+        std::string meta{};
+
+        if (false == driver_.StoreProto(serialized, meta)) { return false; }
+
+        if (false == bool(index_)) {
+            index_.reset(new IndexTrie(driver_));
+
+            for (const auto& it : item_map_) { changed_.emplace(it.first); }
+        }
+
+        OT_ASSERT(index_)
+
+        const bool output = index_->Store(
+            meta,
+            item_map_,
+            changed_,
+            [this](const std::string& hash) -> bool {
+                return check_hash(hash);
+            },
+            root_);
+
+        if (output) { changed_.clear(); }
+
+        return output;
+    }
+
     template <class T>
     bool store_proto(
         const Lock& lock,
@@ -87,6 +162,7 @@ protected:
 
         auto& metadata = item_map_[id];
         auto& hash = std::get<0>(metadata);
+        item_changed(id);
 
         if (!driver_.StoreProto<T>(data, hash, plaintext)) { return false; }
 
@@ -212,6 +288,8 @@ protected:
 
     mutable std::mutex write_lock_;
     mutable Index item_map_;
+    mutable std::unique_ptr<IndexTrie> index_{nullptr};
+    mutable std::set<std::string> changed_{};
 
     static std::string normalize_hash(const std::string& hash);
 
@@ -220,6 +298,10 @@ protected:
     std::uint64_t extract_revision(const proto::CredentialIndex& input) const;
     std::uint64_t extract_revision(const proto::Seed& input) const;
     std::string get_alias(const std::string& id) const;
+    /** Record a modification of item_map_ which the next store_index must
+     *  write to the IndexTrie
+     */
+    void item_changed(const std::string& id) const;
     bool load_raw(
         const std::string& id,
         std::string& output,
@@ -228,6 +310,8 @@ protected:
     bool migrate(
         const std::string& hash,
         const opentxs::api::storage::Driver& to) const;
+    /** Migrate the root object and, if present, the IndexTrie nodes */
+    bool migrate_root(const opentxs::api::storage::Driver& to) const;
     virtual bool save(const Lock& lock) const = 0;
     void serialize_index(
         const std::string& id,
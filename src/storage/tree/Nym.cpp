@@ -413,7 +413,7 @@ Mailbox* Nym::mail_inbox() const
     Lock lock(mail_inbox_lock_);
 
     if (!mail_inbox_) {
-        mail_inbox_.reset(new Mailbox(driver_, mail_inbox_root_));
+        mail_inbox_.reset(Factory::StorageMailbox(driver_, mail_inbox_root_));
 
         if (!mail_inbox_) {
             otErr << __FUNCTION__ << ": Unable to instantiate." << std::endl;
@@ -431,7 +431,8 @@ Mailbox* Nym::mail_outbox() const
     Lock lock(mail_outbox_lock_);
 
     if (!mail_outbox_) {
-        mail_outbox_.reset(new Mailbox(driver_, mail_outbox_root_));
+        mail_outbox_.reset(
+            Factory::StorageMailbox(driver_, mail_outbox_root_));
 
         if (!mail_outbox_) {
             otErr << __FUNCTION__ << ": Unable to instantiate." << std::endl;
@@ -82,7 +82,7 @@ bool Nyms::Exists(const std::string& id) const
 void Nyms::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageNymList> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         otErr << OT_METHOD << __FUNCTION__
@@ -142,7 +142,7 @@ bool Nyms::Migrate(const opentxs::api::storage::Driver& to) const
         output &= node.Migrate(to);
     }
 
-    output &= migrate(root_, to);
+    output &= migrate_root(to);
 
     return output;
 }
@@ -233,7 +233,7 @@ bool Nyms::save(const Lock& lock) const
 
     OT_ASSERT(CURRENT_VERSION == serialized.version())
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 void Nyms::save(class Nym* nym, const Lock& lock, const std::string& id)
@@ -253,6 +253,7 @@ void Nyms::save(class Nym* nym, const Lock& lock, const std::string& id)
     auto& alias = std::get<1>(index);
     hash = nym->Root();
     alias = nym->Alias();
+    item_changed(id);
 
     if (nym->private_.get()) { local_nyms_.emplace(nym->nymid_); }
 
@@ -267,16 +268,6 @@ proto::StorageNymList Nyms::serialize() const
     proto::StorageNymList serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
-
     for (const auto& nymID : local_nyms_) { serialized.add_localnymid(nymID); }
 
     return serialized;
@@ -64,7 +64,7 @@ bool PeerReplies::Delete(const std::string& id) { return delete_item(id); }
 void PeerReplies::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageNymList> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load peer reply index file."
@@ -128,7 +128,7 @@ bool PeerReplies::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageNymList PeerReplies::serialize() const
@@ -136,16 +136,6 @@ proto::StorageNymList PeerReplies::serialize() const
     proto::StorageNymList serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
-
     return serialized;
 }
 
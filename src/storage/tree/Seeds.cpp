@@ -77,7 +77,7 @@ bool Seeds::Delete(const std::string& id) { return delete_item(id); }
 void Seeds::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageSeeds> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load seed index file."
@@ -118,7 +118,7 @@ bool Seeds::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageSeeds Seeds::serialize() const
@@ -127,16 +127,6 @@ proto::StorageSeeds Seeds::serialize() const
     serialized.set_version(version_);
     serialized.set_defaultseed(default_seed_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_seed());
-        }
-    }
-
     return serialized;
 }
 bool Seeds::SetAlias(const std::string& id, const std::string& alias)
@@ -174,6 +164,7 @@ bool Seeds::Store(const proto::Seed& data, const std::string& alias)
     const bool existingKey = (item_map_.end() != item_map_.find(id));
     auto& metadata = item_map_[id];
     auto& hash = std::get<0>(metadata);
+    item_changed(id);
 
     if (existingKey) {
         const bool revisionCheck =
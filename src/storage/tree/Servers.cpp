@@ -69,7 +69,7 @@ bool Servers::Delete(const std::string& id) { return delete_item(id); }
 void Servers::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageServers> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load servers index file."
@@ -113,7 +113,7 @@ bool Servers::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageServers Servers::serialize() const
@@ -121,16 +121,6 @@ proto::StorageServers Servers::serialize() const
     proto::StorageServers serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_server());
-        }
-    }
-
     return serialized;
 }
 
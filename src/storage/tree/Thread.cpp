@@ -47,10 +47,38 @@
 #include "storage/Plugin.hpp"
 #include "Mailbox.hpp"
 
+#include <sstream>
+
+#define THREAD_PAGE_SIZE 256
+#define THREAD_ITEM_INDEX "items"
+
 #define OT_METHOD "opentxs::storage::Thread::"
 
 namespace opentxs
 {
+storage::Thread* Factory::StorageThread(
+    const api::storage::Driver& storage,
+    const std::string& id,
+    const std::string& hash,
+    const std::string& alias,
+    storage::Mailbox& mailInbox,
+    storage::Mailbox& mailOutbox)
+{
+    return new storage::Thread(
+        storage, id, hash, alias, mailInbox, mailOutbox);
+}
+
+storage::Thread* Factory::StorageThread(
+    const api::storage::Driver& storage,
+    const std::string& id,
+    const std::set<std::string>& participants,
+    storage::Mailbox& mailInbox,
+    storage::Mailbox& mailOutbox)
+{
+    return new storage::Thread(
+        storage, id, participants, mailInbox, mailOutbox);
+}
+
 namespace storage
 {
 Thread::Thread(
@@ -66,7 +94,16 @@ Thread::Thread(
     , index_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
+    , items_()
     , participants_()
+    , unread_(0)
+    , pages_()
+    , item_page_()
+    , dirty_pages_()
+    , indexed_(true)
+    , page_index_()
+    , index_changed_()
+    , item_index_(nullptr)
 {
     if (check_hash(hash)) {
         init(hash);
@@ -86,7 +123,16 @@ Thread::Thread(
     , id_(id)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
+    , items_()
     , participants_(participants)
+    , unread_(0)
+    , pages_()
+    , item_page_()
+    , dirty_pages_()
+    , indexed_(true)
+    , page_index_()
+    , index_changed_()
+    , item_index_(nullptr)
 {
     version_ = 1;
     root_ = Node::BLANK_HASH;
@@ -141,7 +187,9 @@ bool Thread::Add(
         return false;
     }
 
+    const bool exists = find(lock, id);
     auto& item = items_[id];
+    const auto previous = item;
     item.set_version(version_);
     item.set_id(id);
 
@@ -159,14 +207,54 @@ bool Thread::Add(
     const bool valid = proto::Validate(item, VERBOSE);
 
     if (!valid) {
-        items_.erase(id);
+        if (exists) {
+            item = previous;
+        } else {
+            items_.erase(id);
+        }
 
         return false;
     }
 
+    if (exists && previous.unread()) { --unread_; }
+
+    if (unread) { ++unread_; }
+
+    if (exists) {
+        dirty_pages_.emplace(item_page_.at(id));
+    } else {
+        add_to_page(lock, id);
+    }
+
     return save(lock);
 }
 
+void Thread::add_to_page(const Lock& lock, const std::string& id)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    std::size_t page{0};
+    const auto pages = page_list(lock);
+
+    if (false == pages.empty()) {
+        page = *pages.rbegin();
+
+        if (false == load_page(lock, page)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to load page "
+                  << page << std::endl;
+
+            OT_FAIL;
+        }
+
+        if (THREAD_PAGE_SIZE <= pages_.at(page).size()) { ++page; }
+    }
+
+    pages_[page].emplace(id);
+    item_page_[id] = page;
+    index_changed_.emplace(id);
+    dirty_pages_.emplace(page);
+}
+
 std::string Thread::Alias() const
 {
     Lock lock(write_lock_);
@@ -174,10 +262,46 @@ std::string Thread::Alias() const
     return alias_;
 }
 
+bool Thread::Check(const std::string& id) const
+{
+    Lock lock(write_lock_);
+
+    return find(lock, id);
+}
+
+// Loads the page which contains id. Threads without an item index load pages,
+// starting with the newest, until one of them contains id.
+bool Thread::find(const Lock& lock, const std::string& id) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    const auto page = item_page_.find(id);
+
+    if (item_page_.end() != page) { return load_page(lock, page->second); }
+
+    if (indexed_) { return false; }
+
+    const auto pages = page_list(lock);
+
+    for (auto it = pages.rbegin(); it != pages.rend(); ++it) {
+        const auto& page = *it;
+
+        if (pages_.end() != pages_.find(page)) { continue; }
+
+        if (false == load_page(lock, page)) { return false; }
+
+        if (item_page_.end() != item_page_.find(id)) { return true; }
+    }
+
+    return false;
+}
+
+std::string Thread::ID() const { return id_; }
+
 void Thread::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageThread> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (false == bool(serialized)) {
         otErr << OT_METHOD << __FUNCTION__
@@ -193,55 +317,217 @@ void Thread::init(const std::string& hash)
         participants_.emplace(participant);
     }
 
-    for (const auto& it : serialized->item()) {
-        const auto& index = it.index();
-        items_.emplace(it.id(), it);
+    Lock lock(write_lock_);
+
+    // A thread stored as a single StorageThread is split into pages. Nothing
+    // is written until the next save.
+    if (0 < serialized->item_size()) {
+        for (const auto& it : serialized->item()) { load_item(it); }
 
-        if (index >= index_) { index_ = index + 1; }
+        for (const auto& it : sort(lock)) {
+            add_to_page(lock, std::get<2>(it.first));
+        }
+    } else {
+        const auto it = item_map_.find(THREAD_ITEM_INDEX);
+
+        if (item_map_.end() != it) {
+            if (false == load_item_index(std::get<0>(it->second))) {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Failed to load thread item index." << std::endl;
+                OT_FAIL;
+            }
+        } else {
+            indexed_ = item_map_.empty();
+        }
+    }
+
+    for (const auto& [key, metadata] : item_map_) {
+        if (THREAD_ITEM_INDEX == key) { continue; }
+
+        std::istringstream summary(std::get<1>(metadata));
+        std::size_t unread{0};
+        std::size_t next{0};
+        summary >> unread >> next;
+        unread_ += unread;
+
+        if (next > index_) { index_ = next; }
     }
 
-    Lock lock(write_lock_);
     upgrade(lock);
 }
 
-bool Thread::Check(const std::string& id) const
+bool Thread::Item(const std::string& id, proto::StorageThreadItem& output) const
 {
     Lock lock(write_lock_);
 
-    return items_.end() != items_.find(id);
-}
+    if (false == find(lock, id)) { return false; }
 
-std::string Thread::ID() const { return id_; }
+    output = items_.at(id);
+
+    return true;
+}
 
 proto::StorageThread Thread::Items() const
 {
     Lock lock(write_lock_);
 
+    if (false == load_pages(lock)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to load thread items."
+              << std::endl;
+    }
+
     return serialize(lock);
 }
 
+void Thread::load_item(const proto::StorageThreadItem& item)
+{
+    const auto& index = item.index();
+    items_.emplace(item.id(), item);
+
+    if (item.unread()) { ++unread_; }
+
+    if (index >= index_) { index_ = index + 1; }
+}
+
+bool Thread::load_item_index(const std::string& hash)
+{
+    std::string raw{};
+
+    if (false == driver_.Load(hash, false, raw)) { return false; }
+
+    std::string meta{};
+    IndexTrie::Entries entries{};
+    item_index_.reset(new IndexTrie(driver_));
+
+    OT_ASSERT(item_index_)
+
+    if (false == item_index_->Load(raw, meta, entries)) { return false; }
+
+    for (const auto& [id, entry] : entries) {
+        try {
+            item_page_[id] = std::stoul(entry.first);
+        } catch (...) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Invalid page for item "
+                  << id << std::endl;
+
+            return false;
+        }
+
+        page_index_.emplace(id, Metadata{entry.first, "", 0, false});
+    }
+
+    return true;
+}
+
+// The unread count and next index of a page are already known from the page
+// table, so they are not updated here
+bool Thread::load_page(const Lock& lock, const std::size_t page) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (pages_.end() != pages_.find(page)) { return true; }
+
+    const auto it = item_map_.find(page_key(page));
+
+    if (item_map_.end() == it) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Page " << page
+              << " does not exist." << std::endl;
+
+        return false;
+    }
+
+    std::shared_ptr<proto::StorageThread> serialized;
+
+    if (false == driver_.LoadProto(std::get<0>(it->second), serialized)) {
+
+        return false;
+    }
+
+    auto& ids = pages_[page];
+
+    for (const auto& item : serialized->item()) {
+        items_.emplace(item.id(), item);
+        ids.emplace(item.id());
+        item_page_[item.id()] = page;
+    }
+
+    return true;
+}
+
+bool Thread::load_pages(const Lock& lock) const
+{
+    bool output{true};
+
+    for (const auto& page : page_list(lock)) {
+        output &= load_page(lock, page);
+    }
+
+    return output;
+}
+
 bool Thread::Migrate(const opentxs::api::storage::Driver& to) const
 {
-    return Node::migrate(root_, to);
+    Lock lock(write_lock_);
+    bool output = Node::Migrate(to);
+
+    if (item_index_) { output &= item_index_->Migrate(to); }
+
+    return output;
+}
+
+std::string Thread::page_key(const std::size_t page)
+{
+    return std::to_string(page);
+}
+
+// Page numbers from the page table, plus pages which have not been saved yet
+std::set<std::size_t> Thread::page_list(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    std::set<std::size_t> output{};
+
+    for (const auto& it : item_map_) {
+        if (THREAD_ITEM_INDEX == it.first) { continue; }
+
+        try {
+            output.emplace(std::stoul(it.first));
+        } catch (...) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Invalid page " << it.first
+                  << std::endl;
+        }
+    }
+
+    for (const auto& it : pages_) { output.emplace(it.first); }
+
+    return output;
 }
 
 bool Thread::Read(const std::string& id, const bool unread)
 {
     Lock lock(write_lock_);
 
-    auto it = items_.find(id);
-
-    if (items_.end() == it) {
+    if (false == find(lock, id)) {
         otErr << OT_METHOD << __FUNCTION__ << ": Item does not exist."
               << std::endl;
 
         return false;
     }
 
-    auto& item = it->second;
+    auto& item = items_.at(id);
+
+    if (item.unread() == unread) { return true; }
 
     item.set_unread(unread);
 
+    if (unread) {
+        ++unread_;
+    } else {
+        --unread_;
+    }
+
+    dirty_pages_.emplace(item_page_.at(id));
+
     return save(lock);
 }
 
@@ -249,13 +535,19 @@ bool Thread::Remove(const std::string& id)
 {
     Lock lock(write_lock_);
 
+    if (false == find(lock, id)) { return false; }
+
     auto it = items_.find(id);
 
-    if (items_.end() == it) { return false; }
+    OT_ASSERT(items_.end() != it);
 
     auto& item = it->second;
     StorageBox box = static_cast<StorageBox>(item.box());
+
+    if (item.unread()) { --unread_; }
+
     items_.erase(it);
+    remove_from_page(lock, id);
 
     switch (box) {
         case StorageBox::MAILINBOX: {
@@ -276,6 +568,10 @@ bool Thread::Remove(const std::string& id)
 bool Thread::Rename(const std::string& newID)
 {
     Lock lock(write_lock_);
+
+    // Every page contains the thread id and the participants
+    if (false == load_pages(lock)) { return false; }
+
     const auto oldID = id_;
     id_ = newID;
 
@@ -284,18 +580,144 @@ bool Thread::Rename(const std::string& newID)
         participants_.emplace(newID);
     }
 
+    for (const auto& it : pages_) { dirty_pages_.emplace(it.first); }
+
     return save(lock);
 }
 
+void Thread::remove_from_page(const Lock& lock, const std::string& id)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto it = item_page_.find(id);
+
+    if (item_page_.end() == it) { return; }
+
+    const auto page = it->second;
+    item_page_.erase(it);
+    index_changed_.emplace(id);
+    auto& ids = pages_.at(page);
+    ids.erase(id);
+
+    if (ids.empty()) {
+        const auto key = page_key(page);
+        pages_.erase(page);
+        dirty_pages_.erase(page);
+        item_map_.erase(key);
+        item_changed(key);
+    } else {
+        dirty_pages_.emplace(page);
+    }
+}
+
 bool Thread::save(const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    auto serialized = serialize(lock);
+    for (const auto& page : dirty_pages_) {
+        if (false == save_page(lock, page)) { return false; }
+    }
+
+    dirty_pages_.clear();
+
+    if (false == save_item_index(lock)) { return false; }
+
+    proto::StorageThread header;
+    header.set_version(version_);
+    header.set_id(id_);
+
+    for (const auto& nym : participants_) {
+        if (!nym.empty()) { *header.add_participant() = nym; }
+    }
+
+    if (!proto::Validate(header, VERBOSE)) { return false; }
+
+    return store_index(lock, header);
+}
+
+bool Thread::save_item_index(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    // Every page is read once to index a thread stored without an item index
+    if (false == indexed_) {
+        if (false == load_pages(lock)) { return false; }
+
+        for (const auto& it : item_page_) { index_changed_.emplace(it.first); }
+
+        indexed_ = true;
+    }
+
+    if (index_changed_.empty()) { return true; }
+
+    for (const auto& id : index_changed_) {
+        const auto it = item_page_.find(id);
+
+        if (item_page_.end() == it) {
+            page_index_.erase(id);
+        } else {
+            page_index_[id] = Metadata{page_key(it->second), "", 0, false};
+        }
+    }
+
+    if (false == bool(item_index_)) {
+        item_index_.reset(new IndexTrie(driver_));
+    }
+
+    OT_ASSERT(item_index_)
+
+    auto& metadata = item_map_[THREAD_ITEM_INDEX];
+    const bool stored = item_index_->Store(
+        "",
+        page_index_,
+        index_changed_,
+        [](const std::string& page) -> bool { return false == page.empty(); },
+        std::get<0>(metadata));
+
+    if (false == stored) { return false; }
+
+    item_changed(THREAD_ITEM_INDEX);
+    index_changed_.clear();
+
+    return true;
+}
+
+bool Thread::save_page(const Lock& lock, const std::size_t page) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    proto::StorageThread serialized;
+    serialized.set_version(version_);
+    serialized.set_id(id_);
+
+    for (const auto& nym : participants_) {
+        if (!nym.empty()) { *serialized.add_participant() = nym; }
+    }
+
+    SortedItems sorted{};
+    std::size_t unread{0};
+    std::size_t next{0};
+
+    for (const auto& id : pages_.at(page)) {
+        const auto& item = items_.at(id);
+        sorted.emplace(SortKey{item.index(), item.time(), id}, &item);
+
+        if (item.unread()) { ++unread; }
+
+        if (item.index() >= next) { next = item.index() + 1; }
+    }
+
+    for (const auto& it : sorted) { *serialized.add_item() = *it.second; }
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    const auto key = page_key(page);
+    auto& metadata = item_map_[key];
+    item_changed(key);
+    std::get<1>(metadata) =
+        std::to_string(unread) + " " + std::to_string(next);
+
+    return driver_.StoreProto(serialized, std::get<0>(metadata));
 }
 
 proto::StorageThread Thread::serialize(const Lock& lock) const
@@ -353,17 +775,12 @@ Thread::SortedItems Thread::sort(const Lock& lock) const
 std::size_t Thread::UnreadCount() const
 {
     Lock lock(write_lock_);
-    std::size_t output{0};
 
-    for (const auto& it : items_) {
-        const auto& item = it.second;
-
-        if (item.unread()) { ++output; }
-    }
-
-    return output;
+    return unread_;
 }
 
+// Only the items of a legacy thread are loaded at this point. Pages are
+// written by Add, which never stores unread outgoing items.
 void Thread::upgrade(const Lock& lock)
 {
     OT_ASSERT(verify_write_lock(lock));
@@ -379,6 +796,8 @@ void Thread::upgrade(const Lock& lock)
             case StorageBox::OUTGOINGBLOCKCHAIN: {
                 if (item.unread()) {
                     item.set_unread(false);
+                    --unread_;
+                    dirty_pages_.emplace(item_page_.at(it.first));
                     changed = true;
                 }
             } break;
@@ -49,6 +49,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 
 namespace opentxs
@@ -59,26 +60,75 @@ namespace storage
 class Mailbox;
 class Threads;
 
+/** Items are stored in pages of at most THREAD_PAGE_SIZE items. Each page is
+ *  a complete StorageThread containing the thread id, the participants and
+ *  the items of that page.
+ *
+ *  The page table is the Node item index, stored as an IndexTrie. Each entry
+ *  maps a page number to the hash of the page, and its alias holds the
+ *  number of unread items and the next item index of the page. The metadata
+ *  object of the index is a StorageThread without items.
+ *
+ *  The page of every item is recorded in a second IndexTrie, whose root is
+ *  the THREAD_ITEM_INDEX entry of the page table. Each entry maps an item id
+ *  to its page number, so an item is found, or known to be absent, without
+ *  searching the pages.
+ *
+ *  Pages are loaded the first time one of their items is needed, so loading a
+ *  thread only reads the page table and the item index. Adding an item only
+ *  rewrites the page it was added to, the changed parts of the item index and
+ *  the page table.
+ *
+ *  Threads stored as a single StorageThread, or stored in pages without an
+ *  item index, are still loaded, and are converted the next time they are
+ *  saved.
+ */
 class Thread : public Node
 {
 private:
+    friend Factory;
     friend class Threads;
     typedef std::tuple<std::size_t, std::int64_t, std::string> SortKey;
     typedef std::map<SortKey, const proto::StorageThreadItem*> SortedItems;
+    typedef std::set<std::string> Page;
 
     std::string id_;
     std::string alias_;
     std::size_t index_{0};
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
-    std::map<std::string, proto::StorageThreadItem> items_;
+    // Only contains the items of loaded pages
+    mutable std::map<std::string, proto::StorageThreadItem> items_;
 
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     std::set<std::string> participants_;
+    std::size_t unread_{0};
+    mutable std::map<std::size_t, Page> pages_;
+    // Contains every item once the thread is indexed
+    mutable std::map<std::string, std::size_t> item_page_;
+    mutable std::set<std::size_t> dirty_pages_;
+    // False for threads stored in pages before the item index existed
+    mutable bool indexed_{true};
+    // The stored form of item_page_. The hash of each entry is the page key.
+    mutable Index page_index_;
+    mutable std::set<std::string> index_changed_;
+    mutable std::unique_ptr<IndexTrie> item_index_{nullptr};
+
+    static std::string page_key(const std::size_t page);
 
+    void add_to_page(const Lock& lock, const std::string& id);
+    bool find(const Lock& lock, const std::string& id) const;
     void init(const std::string& hash) override;
+    bool load_item_index(const std::string& hash);
+    void load_item(const proto::StorageThreadItem& item);
+    bool load_page(const Lock& lock, const std::size_t page) const;
+    bool load_pages(const Lock& lock) const;
+    std::set<std::size_t> page_list(const Lock& lock) const;
+    void remove_from_page(const Lock& lock, const std::string& id);
     bool save(const Lock& lock) const override;
+    bool save_item_index(const Lock& lock) const;
+    bool save_page(const Lock& lock, const std::size_t page) const;
     proto::StorageThread serialize(const Lock& lock) const;
     SortedItems sort(const Lock& lock) const;
     void upgrade(const Lock& lock);
@@ -106,6 +156,7 @@ public:
     std::string Alias() const;
     bool Check(const std::string& id) const;
     std::string ID() const;
+    bool Item(const std::string& id, proto::StorageThreadItem& output) const;
     proto::StorageThread Items() const;
     bool Migrate(const opentxs::api::storage::Driver& to) const override;
     std::size_t UnreadCount() const;
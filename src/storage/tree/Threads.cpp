@@ -79,8 +79,8 @@ std::string Threads::create(
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    std::unique_ptr<class Thread> newThread(
-        new class Thread(driver_, id, participants, mail_inbox_, mail_outbox_));
+    std::unique_ptr<class Thread> newThread(Factory::StorageThread(
+        driver_, id, participants, mail_inbox_, mail_outbox_));
 
     if (!newThread) {
         std::cerr << __FUNCTION__ << ": Failed to instantiate thread."
@@ -147,7 +147,7 @@ bool Threads::FindAndDeleteItem(const std::string& itemID)
 void Threads::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageNymList> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load thread list index file."
@@ -196,7 +196,7 @@ bool Threads::Migrate(const opentxs::api::storage::Driver& to) const
         output &= node.Migrate(to);
     }
 
-    output &= migrate(root_, to);
+    output &= migrate_root(to);
 
     return output;
 }
@@ -233,7 +233,7 @@ class Thread* Threads::thread(
     auto& node = threads_[id];
 
     if (!node) {
-        node.reset(new class Thread(
+        node.reset(Factory::StorageThread(
             driver_, id, hash, alias, mail_inbox_, mail_outbox_));
 
         if (!node) {
@@ -291,6 +291,8 @@ bool Threads::Rename(const std::string& existingID, const std::string& newID)
         newID, std::unique_ptr<opentxs::storage::Thread>(newThread.release()));
     item_map_.erase(it);
     item_map_.emplace(newID, meta);
+    item_changed(existingID);
+    item_changed(newID);
 
     return save(lock);
 }
@@ -306,7 +308,7 @@ bool Threads::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 void Threads::save(
@@ -329,6 +331,7 @@ void Threads::save(
     auto& alias = std::get<1>(index);
     hash = nym->Root();
     alias = nym->Alias();
+    item_changed(id);
 
     if (!save(lock)) {
         std::cerr << __FUNCTION__ << ": Save error" << std::endl;
@@ -341,16 +344,6 @@ proto::StorageNymList Threads::serialize() const
     proto::StorageNymList serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_nym());
-        }
-    }
-
     return serialized;
 }
 }  // namespace storage
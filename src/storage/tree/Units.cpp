@@ -66,7 +66,7 @@ bool Units::Delete(const std::string& id) { return delete_item(id); }
 void Units::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageUnits> serialized;
-    driver_.LoadProto(hash, serialized);
+    load_index(hash, serialized);
 
     if (!serialized) {
         std::cerr << __FUNCTION__ << ": Failed to load unit index file."
@@ -107,7 +107,7 @@ bool Units::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return store_index(lock, serialized);
 }
 
 proto::StorageUnits Units::serialize() const
@@ -115,16 +115,6 @@ proto::StorageUnits Units::serialize() const
     proto::StorageUnits serialized;
     serialized.set_version(version_);
 
-    for (const auto item : item_map_) {
-        const bool goodID = !item.first.empty();
-        const bool goodHash = check_hash(std::get<0>(item.second));
-        const bool good = goodID && goodHash;
-
-        if (good) {
-            serialize_index(item.first, item.second, *serialized.add_unit());
-        }
-    }
-
     return serialized;
 }
 
@@ -109,6 +109,7 @@ ActivitySummary::ActivitySummary(
           }))
     , activity_subscriber_(
           zmq_.SubscribeSocket(activity_subscriber_callback_.get()))
+    , last_sequence_(activity.ThreadSequence(nymID))
 {
     OT_ASSERT(blank_p_)
 
@@ -169,10 +170,34 @@ void ActivitySummary::process_thread(const std::string& id)
 void ActivitySummary::process_thread(const network::zeromq::Message& message)
 {
     wait_for_startup();
+    api::Activity::ThreadUpdate threadUpdate{};
 
-    OT_ASSERT(1 == message.Body().size());
+    if (false == activity_.ParseThreadUpdate(message, threadUpdate)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid update" << std::endl;
+
+        return;
+    }
+
+    const auto& [id, sequence, change, item] = threadUpdate;
+    [[maybe_unused]] const auto& notUsed = item;
+    const bool missed = (sequence != (last_sequence_ + 1));
+    last_sequence_ = sequence;
+
+    if (missed) {
+        // A dropped update might have created a thread we don't know about.
+        // The current update is applied below as usual.
+        for (const auto& [threadID, alias] :
+             activity_.Threads(nym_id_, false)) {
+            [[maybe_unused]] const auto& unused = alias;
+
+            if (0 == names_.count(Identifier::Factory(threadID))) {
+                process_thread(threadID);
+            }
+        }
+    }
+
+    if (ThreadChange::REMOVED == change) { return; }
 
-    const std::string id(*message.Body().begin());
     const auto threadID = Identifier::Factory(id);
 
     OT_ASSERT(false == threadID->empty())
@@ -66,6 +66,7 @@ private:
     const Flag& running_;
     OTZMQListenCallback activity_subscriber_callback_;
     OTZMQSubscribeSocket activity_subscriber_;
+    std::uint64_t last_sequence_{0};
 
     ActivitySummaryID blank_id() const override;
     void construct_item(
@@ -115,6 +115,7 @@ ActivitySummaryItem::ActivitySummaryItem(
           }))
     , activity_subscriber_(
           zmq_.SubscribeSocket(activity_subscriber_callback_.get()))
+    , last_sequence_(activity.ThreadSequence(nymID))
 {
     const auto endpoint = activity_.ThreadPublisher(nymID);
     otWarn << OT_METHOD << __FUNCTION__ << ": Connecting to " << endpoint
@@ -272,23 +273,55 @@ const proto::StorageThreadItem& ActivitySummaryItem::newest_item(
 void ActivitySummaryItem::process_thread(
     const network::zeromq::Message& message)
 {
-    OT_ASSERT(1 == message.Body().size())
+    api::Activity::ThreadUpdate threadUpdate{};
+
+    if (false == activity_.ParseThreadUpdate(message, threadUpdate)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid update" << std::endl;
+
+        return;
+    }
+
+    const auto& [id, sequence, change, item] = threadUpdate;
+    const bool missed = (sequence != (last_sequence_ + 1));
+    last_sequence_ = sequence;
+
+    if (missed) {
+        otWarn << OT_METHOD << __FUNCTION__
+               << ": Missed an update. Reloading thread." << std::endl;
+        startup();
+
+        return;
+    }
 
-    const std::string id(*message.Body().begin());
     otWarn << OT_METHOD << __FUNCTION__ << ": Thread " << id << " has updated.."
            << std::endl;
-    const auto threadID = Identifier::Factory(id);
-
-    OT_ASSERT(false == threadID->empty())
 
-    if (id_ != threadID) {
+    if (id_->str() != id) {
         otWarn << OT_METHOD << __FUNCTION__ << ": Update not relevant to me ("
                << id_->str() << ")" << std::endl;
 
         return;
     }
 
-    startup();
+    switch (change) {
+        case ThreadChange::ADDED:
+        case ThreadChange::UPDATED: {
+            sLock lock(shared_lock_);
+            const auto time = std::chrono::system_clock::time_point(
+                std::chrono::seconds(item->time()));
+            const bool newer = (time >= time_);
+            lock.unlock();
+
+            // Items older than the one currently displayed do not change the
+            // summary
+            if (newer) { update(*item); }
+        } break;
+        case ThreadChange::REMOVED:
+        case ThreadChange::RELOAD:
+        default: {
+            startup();
+        }
+    }
 }
 
 void ActivitySummaryItem::startup()
@@ -334,7 +367,12 @@ void ActivitySummaryItem::update(const proto::StorageThread& thread)
 
     if (false == haveItems) { return; }
 
-    const auto& item = newest_item(thread);
+    update(newest_item(thread));
+}
+
+void ActivitySummaryItem::update(const proto::StorageThreadItem& item)
+{
+    eLock lock(shared_lock_, std::defer_lock);
     const auto time = std::chrono::system_clock::time_point(
         std::chrono::seconds(item.time()));
     const auto box = static_cast<StorageBox>(item.box());
@@ -342,6 +380,7 @@ void ActivitySummaryItem::update(const proto::StorageThread& thread)
     time_ = time;
     text_ = "";
     type_ = box;
+    const auto displayName = display_name_;
     lock.unlock();
     ItemLocator locator{item.id(), box, item.account()};
     newest_item_.Push(Identifier::Random(), locator);
@@ -76,6 +76,7 @@ private:
     UniqueQueue<ItemLocator> newest_item_;
     OTZMQListenCallback activity_subscriber_callback_;
     OTZMQSubscribeSocket activity_subscriber_;
+    std::uint64_t last_sequence_{0};
 
     bool check_thread(const proto::StorageThread& thread) const;
     std::string display_name(const proto::StorageThread& thread) const;
@@ -87,6 +88,7 @@ private:
     void process_thread(const network::zeromq::Message& message);
     void startup();
     void update(const proto::StorageThread& thread);
+    void update(const proto::StorageThreadItem& item);
 
     ActivitySummaryItem(
         const ActivitySummaryParent& parent,
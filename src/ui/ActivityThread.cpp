@@ -122,6 +122,7 @@ ActivityThread::ActivityThread(
     , draft_tasks_()
     , contact_(nullptr)
     , contact_thread_(nullptr)
+    , last_sequence_(activity.ThreadSequence(nymID))
 {
     OT_ASSERT(blank_p_)
 
@@ -393,19 +394,50 @@ void ActivityThread::process_thread(const network::zeromq::Message& message)
 {
     wait_for_startup();
     check_drafts();
+    api::Activity::ThreadUpdate threadUpdate{};
 
-    OT_ASSERT(1 == message.Body().size());
+    if (false == activity_.ParseThreadUpdate(message, threadUpdate)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid update" << std::endl;
 
-    const std::string id(*message.Body().begin());
-    const auto threadID = Identifier::Factory(id);
+        return;
+    }
+
+    const auto& [threadID, sequence, change, item] = threadUpdate;
+    const bool missed = (sequence != (last_sequence_ + 1));
+    last_sequence_ = sequence;
+
+    // Updates for other threads are not relevant unless one was dropped, in
+    // which case this thread might have been the one which changed
+    if (missed) {
+        otWarn << OT_METHOD << __FUNCTION__
+               << ": Missed an update. Reloading thread." << std::endl;
+        reload_thread();
+
+        return;
+    }
 
-    OT_ASSERT(false == threadID->empty())
+    if (threadID_->str() != threadID) { return; }
 
-    if (threadID_ != threadID) { return; }
+    switch (change) {
+        case ThreadChange::ADDED:
+        case ThreadChange::UPDATED: {
+            process_item(*item);
+        } break;
+        case ThreadChange::REMOVED: {
+            remove_item(*item);
+        } break;
+        case ThreadChange::RELOAD:
+        default: {
+            reload_thread();
+        }
+    }
+}
 
+void ActivityThread::reload_thread()
+{
     const auto thread = activity_.Thread(nym_id_, threadID_);
 
-    OT_ASSERT(thread)
+    if (false == bool(thread)) { return; }
 
     std::set<ActivityThreadID> active{};
 
@@ -417,6 +449,20 @@ void ActivityThread::process_thread(const network::zeromq::Message& message)
     delete_inactive(active);
 }
 
+void ActivityThread::remove_item(const proto::StorageThreadItem& item)
+{
+    const ActivityThreadID id{Identifier::Factory(item.id()),
+                              static_cast<StorageBox>(item.box()),
+                              Identifier::Factory(item.account())};
+    Lock lock(lock_);
+
+    if (0 == names_.count(id)) { return; }
+
+    delete_item(lock, id);
+    lock.unlock();
+    UpdateNotify();
+}
+
 bool ActivityThread::same(
     const ActivityThreadID& lhs,
     const ActivityThreadID& rhs) const
@@ -120,6 +120,7 @@ private:
     mutable std::set<ActivityThreadID> draft_tasks_;
     std::shared_ptr<const opentxs::Contact> contact_;
     std::unique_ptr<std::thread> contact_thread_{nullptr};
+    std::uint64_t last_sequence_{0};
 
     ActivityThreadID blank_id() const override;
     bool check_draft(const ActivityThreadID& id) const;
@@ -137,6 +138,8 @@ private:
     void new_thread();
     ActivityThreadID process_item(const proto::StorageThreadItem& item);
     void process_thread(const network::zeromq::Message& message);
+    void reload_thread();
+    void remove_item(const proto::StorageThreadItem& item);
     void startup();
 
     ActivityThread(
@@ -0,0 +1,231 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/api/crypto/Encode.hpp"
+
+#include <base64/base64.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+// Characters per line in encoded output
+const std::size_t line_width_{72};
+
+std::string random_bytes(const std::size_t size)
+{
+    std::mt19937 generator(static_cast<std::uint32_t>(size));
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::string output(size, '\0');
+
+    for (auto& byte : output) {
+        byte = static_cast<char>(distribution(generator));
+    }
+
+    return output;
+}
+
+// The encoder which was used before the current codec, including the
+// terminating null byte which was left inside the string
+std::string legacy_encode(const std::string& input)
+{
+    std::string encoded(::Base64encode_len(input.size()), '\0');
+    ::Base64encode(&encoded[0], input.data(), input.size());
+    std::string output{};
+
+    if (encoded.empty()) { return output; }
+
+    std::size_t width{0};
+
+    for (const auto& character : encoded) {
+        output.push_back(character);
+
+        if (++width >= line_width_) {
+            output.push_back('\n');
+            width = 0;
+        }
+    }
+
+    if ('\n' != output.back()) { output.push_back('\n'); }
+
+    return output;
+}
+
+const api::crypto::Encode& encode() { return OT::App().Crypto().Encode(); }
+}  // namespace
+
+TEST(Base64, rfc4648_vectors)
+{
+    EXPECT_EQ(encode().DataEncode(std::string("")), "");
+    EXPECT_EQ(encode().DataEncode(std::string("f")), "Zg==");
+    EXPECT_EQ(encode().DataEncode(std::string("fo")), "Zm8=");
+    EXPECT_EQ(encode().DataEncode(std::string("foo")), "Zm9v");
+    EXPECT_EQ(encode().DataEncode(std::string("foob")), "Zm9vYg==");
+    EXPECT_EQ(encode().DataEncode(std::string("fooba")), "Zm9vYmE=");
+    EXPECT_EQ(encode().DataEncode(std::string("foobar")), "Zm9vYmFy");
+
+    EXPECT_EQ(encode().DataDecode("Zg=="), "f");
+    EXPECT_EQ(encode().DataDecode("Zm8="), "fo");
+    EXPECT_EQ(encode().DataDecode("Zm9v"), "foo");
+    EXPECT_EQ(encode().DataDecode("Zm9vYg=="), "foob");
+    EXPECT_EQ(encode().DataDecode("Zm9vYmE="), "fooba");
+    EXPECT_EQ(encode().DataDecode("Zm9vYmFy"), "foobar");
+}
+
+TEST(Base64, padding_lengths)
+{
+    // Sizes long enough to take the vector paths, ending with zero, one and
+    // two padding characters
+    for (const std::size_t size : {3 * 100, (3 * 100) + 2, (3 * 100) + 1}) {
+        const auto plain = random_bytes(size);
+        auto encoded = encode().DataEncode(plain);
+        const auto padding = (3 - (size % 3)) % 3;
+        const auto sanitized = encode().SanatizeBase64(encoded);
+
+        ASSERT_EQ(sanitized.size(), ((size + 2) / 3) * 4);
+        EXPECT_EQ(
+            sanitized.substr(sanitized.size() - padding),
+            std::string(padding, '='));
+        EXPECT_NE(sanitized[sanitized.size() - padding - 1], '=');
+        EXPECT_EQ(encode().DataDecode(encoded), plain);
+
+        // Missing padding decodes the same way
+        while ('=' == encoded.back()) { encoded.pop_back(); }
+
+        EXPECT_EQ(encode().DataDecode(encoded), plain);
+    }
+}
+
+TEST(Base64, line_breaks)
+{
+    for (std::size_t size = 0; size < 1000; ++size) {
+        const auto plain = random_bytes(size);
+        const auto encoded = encode().DataEncode(plain);
+        std::size_t start{0};
+
+        while (start < encoded.size()) {
+            const auto end = encoded.find('\n', start);
+
+            if (std::string::npos == end) {
+                // A partial last line has no line break
+                EXPECT_LT(encoded.size() - start, line_width_);
+
+                break;
+            }
+
+            EXPECT_EQ(end - start, line_width_);
+            start = end + 1;
+        }
+
+        EXPECT_EQ(encode().DataDecode(encoded), plain);
+    }
+}
+
+TEST(Base64, embedded_whitespace)
+{
+    EXPECT_EQ(encode().DataDecode("Zm9v\nYmFy"), "foobar");
+    EXPECT_EQ(encode().DataDecode("Zm\r\n9v Ym\tFy\n"), "foobar");
+    EXPECT_EQ(encode().DataDecode("\n\nZm9vYg==\n"), "foob");
+
+    const auto plain = random_bytes(500);
+    std::string spaced{};
+
+    for (const auto& character : encode().DataEncode(plain)) {
+        spaced.push_back(character);
+        spaced.append(" \r\n");
+    }
+
+    EXPECT_EQ(encode().DataDecode(spaced), plain);
+}
+
+TEST(Base64, invalid_characters)
+{
+    EXPECT_EQ(encode().DataDecode("Zm9v*YmFy!"), "foobar");
+    EXPECT_EQ(encode().DataDecode("-Z_m9~vYm.Fy"), "foobar");
+    EXPECT_EQ(encode().DataDecode("!@#$%^&*"), "");
+    EXPECT_EQ(encode().DataDecode(""), "");
+    // Decoding stops at the first padding character
+    EXPECT_EQ(encode().DataDecode("Zg==Zm9v"), "f");
+    // A single leftover character doesn't hold a whole byte
+    EXPECT_EQ(encode().DataDecode("Zm9vY"), "foo");
+    EXPECT_EQ(
+        encode().SanatizeBase64("Zm9v*Ym\nFy!="), std::string("Zm9vYmFy="));
+}
+
+TEST(Base64, decode_legacy_encoding)
+{
+    for (std::size_t size = 0; size < 600; ++size) {
+        const auto plain = random_bytes(size);
+        const auto legacy = legacy_encode(plain);
+
+        EXPECT_EQ(encode().DataDecode(legacy), plain);
+        EXPECT_EQ(
+            encode().SanatizeBase64(encode().DataEncode(plain)),
+            encode().SanatizeBase64(legacy));
+    }
+}
+
+TEST(Base64, armor_round_trip)
+{
+    for (const std::size_t size : {1, 2, 3, 54, 55, 56, 1000, 100000}) {
+        const auto plain = random_bytes(size);
+        const auto input = Data::Factory(plain.data(), plain.size());
+        auto output = Data::Factory();
+        OTASCIIArmor armor(input.get());
+
+        ASSERT_TRUE(armor.GetData(output));
+        EXPECT_TRUE(output.get() == input.get());
+
+        String armored{};
+
+        ASSERT_TRUE(armor.WriteArmoredString(armored, "TEST"));
+
+        OTASCIIArmor loaded{};
+
+        ASSERT_TRUE(loaded.LoadFromString(armored));
+        ASSERT_TRUE(loaded.GetData(output));
+        EXPECT_TRUE(output.get() == input.get());
+    }
+}
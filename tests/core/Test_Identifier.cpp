@@ -0,0 +1,130 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <unordered_set>
+
+using namespace opentxs;
+
+namespace
+{
+OTIdentifier make_id(const std::string& bytes)
+{
+    auto output = Identifier::Factory();
+    output->Assign(bytes.data(), bytes.size());
+
+    return output;
+}
+}  // namespace
+
+TEST(Identifier, compare_equal_to_other_same)
+{
+    auto one = make_id("abcd");
+    auto other = make_id("abcd");
+
+    ASSERT_TRUE(one.get() == other.get());
+    ASSERT_FALSE(one.get() != other.get());
+    ASSERT_FALSE(one.get() < other.get());
+    ASSERT_TRUE(one.get() <= other.get());
+    ASSERT_TRUE(one.get() >= other.get());
+}
+
+TEST(Identifier, compare_binary_order)
+{
+    auto low = make_id("abcd");
+    auto high = make_id("abce");
+    auto longer = make_id("abcde");
+
+    ASSERT_TRUE(low.get() < high.get());
+    ASSERT_TRUE(high.get() > low.get());
+    ASSERT_TRUE(low.get() < longer.get());
+    ASSERT_TRUE(longer.get() < high.get());
+    ASSERT_TRUE(low.get() != high.get());
+}
+
+TEST(Identifier, empty_sorts_first)
+{
+    auto empty = Identifier::Factory();
+    auto other = make_id("abcd");
+
+    ASSERT_TRUE(empty.get() < other.get());
+    ASSERT_TRUE(empty.get() == Identifier::Factory().get());
+}
+
+TEST(Identifier, mutation_changes_comparison)
+{
+    auto one = make_id("abcd");
+    auto other = make_id("abcd");
+    other->Concatenate("e", 1);
+
+    ASSERT_TRUE(one.get() != other.get());
+
+    other->Assign(one.get());
+
+    ASSERT_TRUE(one.get() == other.get());
+}
+
+TEST(Identifier, hash_matches_equality)
+{
+    auto one = make_id("abcd");
+    auto other = make_id("abcd");
+
+    ASSERT_EQ(one->Hash(), other->Hash());
+    ASSERT_EQ(std::hash<OTIdentifier>()(one), std::hash<Identifier>()(other));
+}
+
+TEST(Identifier, containers)
+{
+    std::map<OTIdentifier, int> ordered{};
+    std::unordered_set<OTIdentifier> unordered{};
+
+    for (const auto& bytes : {"dddd", "aaaa", "cccc", "bbbb", "aaaa"}) {
+        ordered.emplace(make_id(bytes), 0);
+        unordered.emplace(make_id(bytes));
+    }
+
+    ASSERT_EQ(ordered.size(), 4);
+    ASSERT_EQ(unordered.size(), 4);
+    ASSERT_TRUE(ordered.begin()->first.get() == make_id("aaaa").get());
+    ASSERT_EQ(unordered.count(make_id("cccc")), 1);
+    ASSERT_EQ(unordered.count(make_id("eeee")), 0);
+}
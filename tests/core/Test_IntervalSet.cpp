@@ -0,0 +1,117 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+
+using namespace opentxs;
+
+TEST(IntervalSet, empty)
+{
+    IntervalSet<std::int64_t> set{};
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(0, set.size());
+    ASSERT_EQ(0, set.count(1));
+    ASSERT_EQ(0, set.erase(1));
+    ASSERT_TRUE(set.begin() == set.end());
+}
+
+TEST(IntervalSet, merge_consecutive)
+{
+    IntervalSet<std::int64_t> set{};
+
+    ASSERT_TRUE(set.insert(3));
+    ASSERT_TRUE(set.insert(1));
+    ASSERT_EQ(2, set.ranges().size());
+    ASSERT_TRUE(set.insert(2));
+    ASSERT_FALSE(set.insert(2));
+    ASSERT_EQ(1, set.ranges().size());
+    ASSERT_EQ(3, set.size());
+    ASSERT_EQ(1, set.front());
+    ASSERT_EQ(3, set.ranges().at(1));
+}
+
+TEST(IntervalSet, split_on_erase)
+{
+    IntervalSet<std::int64_t> set{};
+
+    for (std::int64_t i = 10; i < 20; ++i) { set.insert(i); }
+
+    ASSERT_EQ(1, set.ranges().size());
+    ASSERT_EQ(1, set.erase(15));
+    ASSERT_EQ(0, set.erase(15));
+    ASSERT_EQ(2, set.ranges().size());
+    ASSERT_EQ(9, set.size());
+    ASSERT_EQ(1, set.erase(10));
+    ASSERT_EQ(1, set.erase(19));
+    ASSERT_EQ(11, set.front());
+    ASSERT_EQ(14, set.ranges().at(11));
+    ASSERT_EQ(18, set.ranges().at(16));
+    ASSERT_EQ(0, set.count(15));
+    ASSERT_EQ(1, set.count(16));
+}
+
+TEST(IntervalSet, matches_std_set)
+{
+    std::mt19937 generator{1};
+    std::uniform_int_distribution<std::int64_t> values{0, 200};
+    IntervalSet<std::int64_t> set{};
+    std::set<std::int64_t> expected{};
+
+    for (int i = 0; i < 10000; ++i) {
+        const auto value = values(generator);
+
+        if (0 == (generator() % 3)) {
+            ASSERT_EQ(expected.erase(value), set.erase(value));
+        } else {
+            ASSERT_EQ(expected.insert(value).second, set.insert(value));
+        }
+
+        ASSERT_EQ(expected.size(), set.size());
+        ASSERT_EQ(expected.count(value), set.count(value));
+    }
+
+    ASSERT_EQ(expected, set.Copy());
+    ASSERT_TRUE(
+        std::equal(expected.begin(), expected.end(), set.begin(), set.end()));
+}
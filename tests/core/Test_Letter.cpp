@@ -0,0 +1,186 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/crypto/Letter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+const std::string plaintext_{"Letter test plaintext"};
+// Sealed letters end with the session key tag table: a two byte field key, a
+// one byte length, a version byte, then four bytes per session key.
+const std::size_t tag_header_{4};
+const std::size_t tag_size_{4};
+
+class Test_Letter : public ::testing::Test
+{
+public:
+    const ConstNym alice_;
+    const ConstNym bob_;
+    const ConstNym eve_;
+
+    static ConstNym create(const std::string& name)
+    {
+        const auto id = OT::App().API().Exec().CreateNymHD(
+            proto::CITEMTYPE_INDIVIDUAL, name);
+
+        return OT::App().Wallet().Nym(Identifier::Factory(id));
+    }
+
+    Test_Letter()
+        : alice_(create("Alice"))
+        , bob_(create("Bob"))
+        , eve_(create("Eve"))
+    {
+    }
+
+    OTData seal(const std::vector<ConstNym>& recipients) const
+    {
+        mapOfAsymmetricKeys keys{};
+
+        for (const auto& nym : recipients) {
+            keys.insert({"",
+                         const_cast<OTAsymmetricKey*>(
+                             &nym->GetPublicEncrKey())});
+        }
+
+        auto output = Data::Factory();
+
+        EXPECT_TRUE(Letter::Seal(keys, String(plaintext_), output));
+
+        return output;
+    }
+
+    bool open(const Data& letter, const ConstNym& nym) const
+    {
+        OTPasswordData password("Test_Letter");
+        String output{};
+
+        if (false == Letter::Open(letter, *nym, password, output)) {
+
+            return false;
+        }
+
+        EXPECT_STREQ(plaintext_.c_str(), output.Get());
+
+        return true;
+    }
+
+    static std::vector<std::uint8_t> bytes(const Data& letter)
+    {
+        const auto* start =
+            static_cast<const std::uint8_t*>(letter.GetPointer());
+
+        return {start, start + letter.GetSize()};
+    }
+};
+
+TEST_F(Test_Letter, tagged_round_trip)
+{
+    const auto letter = seal({alice_});
+    const auto raw = bytes(letter);
+
+    ASSERT_LT(tag_header_ + tag_size_, raw.size());
+    // Tag table version
+    ASSERT_EQ(1, raw[raw.size() - tag_size_ - 1]);
+    ASSERT_TRUE(open(letter, alice_));
+    ASSERT_FALSE(open(letter, eve_));
+}
+
+TEST_F(Test_Letter, untagged_letter)
+{
+    const auto letter = seal({alice_, bob_});
+    auto raw = bytes(letter);
+
+    ASSERT_LT(tag_header_ + 2 * tag_size_, raw.size());
+
+    // Letters sealed before the tags were added end with the envelope
+    raw.resize(raw.size() - tag_header_ - 2 * tag_size_);
+    const auto legacy = Data::Factory(raw.data(), raw.size());
+
+    ASSERT_TRUE(open(legacy, alice_));
+    ASSERT_TRUE(open(legacy, bob_));
+    ASSERT_FALSE(open(legacy, eve_));
+}
+
+TEST_F(Test_Letter, tag_collision)
+{
+    const auto letter = seal({alice_, bob_});
+    const auto raw = bytes(letter);
+
+    ASSERT_TRUE(open(letter, alice_));
+    ASSERT_TRUE(open(letter, bob_));
+    ASSERT_LT(tag_header_ + 2 * tag_size_, raw.size());
+
+    const auto first = raw.size() - 2 * tag_size_;
+    std::vector<bool> alice{};
+    std::vector<bool> bob{};
+
+    // Give both session keys the tag of one of them. Its owner has to skip
+    // the other recipient's entry, which carries the same tag.
+    for (std::size_t owner = 0; owner < 2; ++owner) {
+        auto collided = raw;
+
+        for (std::size_t entry = 0; entry < 2; ++entry) {
+            std::copy(
+                raw.begin() + first + owner * tag_size_,
+                raw.begin() + first + (owner + 1) * tag_size_,
+                collided.begin() + first + entry * tag_size_);
+        }
+
+        const auto modified = Data::Factory(collided.data(), collided.size());
+        alice.push_back(open(modified, alice_));
+        bob.push_back(open(modified, bob_));
+
+        ASSERT_NE(alice.back(), bob.back());
+        ASSERT_FALSE(open(modified, eve_));
+    }
+
+    ASSERT_NE(alice[0], alice[1]);
+    ASSERT_NE(bob[0], bob[1]);
+}
+}  // namespace
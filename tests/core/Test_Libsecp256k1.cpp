@@ -0,0 +1,174 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "opentxs/opentxs.hpp"
+
+#if OT_CRYPTO_USING_LIBSECP256K1
+#include "opentxs/core/crypto/Libsecp256k1.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+const std::size_t message_count_{64};
+
+class Test_Libsecp256k1 : public ::testing::Test
+{
+public:
+    const Libsecp256k1& engine_;
+    const ConstNym alice_;
+    const ConstNym bob_;
+    std::vector<OTData> messages_;
+
+    static ConstNym create(const std::string& name)
+    {
+        const auto id = OT::App().API().Exec().CreateNymHD(
+            proto::CITEMTYPE_INDIVIDUAL, name);
+
+        return OT::App().Wallet().Nym(Identifier::Factory(id));
+    }
+
+    Test_Libsecp256k1()
+        : engine_(dynamic_cast<const Libsecp256k1&>(
+              OT::App().Crypto().SECP256K1()))
+        , alice_(create("Alice"))
+        , bob_(create("Bob"))
+        , messages_()
+    {
+        for (std::size_t i = 0; i < message_count_; ++i) {
+            const std::string message = "message " + std::to_string(i);
+            messages_.emplace_back(
+                Data::Factory(message.data(), message.size()));
+        }
+    }
+
+    OTData sign(const Nym& nym, const Data& message) const
+    {
+        OTPasswordData password("Test_Libsecp256k1");
+        auto output = Data::Factory();
+
+        EXPECT_TRUE(engine_.Sign(
+            message,
+            nym.GetPrivateSignKey(),
+            proto::HASHTYPE_SHA256,
+            output,
+            &password));
+
+        return output;
+    }
+};
+
+TEST_F(Test_Libsecp256k1, batch_verify)
+{
+    const auto& alice = alice_->GetPublicSignKey();
+    const auto& bob = bob_->GetPublicSignKey();
+    std::vector<OTData> signatures{};
+    std::vector<Libsecp256k1::VerifyItem> items{};
+    std::vector<bool> expected{};
+
+    for (std::size_t i = 0; i < message_count_; ++i) {
+        signatures.emplace_back(sign(*alice_, messages_[i]));
+    }
+
+    for (std::size_t i = 0; i < message_count_; ++i) {
+        const auto& signature = signatures[i].get();
+
+        switch (i % 4) {
+            case 0: {
+                items.emplace_back(alice, messages_[i], signature);
+                expected.push_back(true);
+            } break;
+            case 1: {
+                // Wrong message
+                const auto& other = messages_[(i + 1) % message_count_];
+                items.emplace_back(alice, other, signature);
+                expected.push_back(false);
+            } break;
+            case 2: {
+                // Wrong key
+                items.emplace_back(bob, messages_[i], signature);
+                expected.push_back(false);
+            } break;
+            default: {
+                items.emplace_back(alice, messages_[i], signature);
+                expected.push_back(true);
+            }
+        }
+    }
+
+    std::vector<bool> results{};
+
+    ASSERT_FALSE(engine_.Verify(items, proto::HASHTYPE_SHA256, results));
+    ASSERT_EQ(expected, results);
+
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        const auto& [key, message, signature] = items[i];
+
+        EXPECT_EQ(
+            expected[i],
+            engine_.Verify(message, key, signature, proto::HASHTYPE_SHA256));
+    }
+}
+
+TEST_F(Test_Libsecp256k1, batch_verify_all_valid)
+{
+    const auto& alice = alice_->GetPublicSignKey();
+    std::vector<OTData> signatures{};
+    std::vector<Libsecp256k1::VerifyItem> items{};
+
+    for (std::size_t i = 0; i < message_count_; ++i) {
+        signatures.emplace_back(sign(*alice_, messages_[i]));
+    }
+
+    for (std::size_t i = 0; i < message_count_; ++i) {
+        items.emplace_back(alice, messages_[i], signatures[i]);
+    }
+
+    std::vector<bool> results{};
+
+    ASSERT_TRUE(engine_.Verify(items, proto::HASHTYPE_SHA256, results));
+    ASSERT_EQ(items.size(), results.size());
+}
+}  // namespace
+#endif  // OT_CRYPTO_USING_LIBSECP256K1
@@ -0,0 +1,83 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace opentxs;
+
+namespace
+{
+int count_evaluations(int& counter) { return ++counter; }
+}  // namespace
+
+TEST(Log, disabled_level_skips_arguments)
+{
+    ASSERT_FALSE(OT_LOG_ENABLED(Log::LogLevel() + 1));
+
+    int counter{0};
+    OT_LOG(Log::LogLevel() + 1, otLog5)
+        << count_evaluations(counter) << std::endl;
+
+    ASSERT_EQ(counter, 0);
+}
+
+TEST(Log, enabled_level_evaluates_arguments)
+{
+    ASSERT_TRUE(OT_LOG_ENABLED(-1));
+
+    int counter{0};
+    OT_LOG(-1, otErr) << "Log test " << count_evaluations(counter)
+                      << std::endl;
+
+    ASSERT_EQ(counter, 1);
+}
+
+TEST(Log, record_skips_arguments)
+{
+    int counter{0};
+    OT_LOG_RECORD(Log::LogLevel() + 1, "test")
+        .Add("count", count_evaluations(counter));
+
+    ASSERT_EQ(counter, 0);
+
+    OT_LOG_RECORD(-1, "Log test").Add("count", count_evaluations(counter));
+
+    ASSERT_EQ(counter, 1);
+}
@@ -0,0 +1,161 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+const std::string short_text_{"correct horse battery staple"};
+const std::string long_text_(1000, 'x');
+}  // namespace
+
+TEST(OTPassword, default_is_empty_text)
+{
+    OTPassword password;
+
+    ASSERT_TRUE(password.isPassword());
+    ASSERT_EQ(password.getPasswordSize(), 0);
+    ASSERT_STREQ(password.getPassword(), "");
+}
+
+TEST(OTPassword, set_password)
+{
+    OTPassword password;
+
+    ASSERT_EQ(password.setPassword(short_text_), short_text_.size());
+    ASSERT_EQ(password.getPasswordSize(), short_text_.size());
+    ASSERT_EQ(std::string(password.getPassword()), short_text_);
+}
+
+TEST(OTPassword, password_larger_than_default_block)
+{
+    OTPassword password;
+
+    ASSERT_EQ(password.setPassword(long_text_), long_text_.size());
+    ASSERT_EQ(std::string(password.getPassword()), long_text_);
+    ASSERT_GE(password.getBlockSize(), long_text_.size());
+}
+
+TEST(OTPassword, memory_larger_than_default_block)
+{
+    const std::vector<std::uint8_t> input(5000, 0xa5);
+    OTPassword password;
+
+    ASSERT_EQ(password.setMemory(input.data(), input.size()), input.size());
+    ASSERT_EQ(password.getMemorySize(), input.size());
+    ASSERT_EQ(
+        0, std::memcmp(password.getMemory(), input.data(), input.size()));
+}
+
+TEST(OTPassword, add_memory_grows)
+{
+    const std::vector<std::uint8_t> first(200, 0x01);
+    const std::vector<std::uint8_t> second(200, 0x02);
+    OTPassword password;
+    password.setMemory(first.data(), first.size());
+
+    ASSERT_EQ(password.addMemory(second.data(), second.size()), second.size());
+    ASSERT_EQ(password.getMemorySize(), first.size() + second.size());
+
+    const auto* data = password.getMemory_uint8();
+
+    ASSERT_EQ(0, std::memcmp(data, first.data(), first.size()));
+    ASSERT_EQ(
+        0, std::memcmp(data + first.size(), second.data(), second.size()));
+}
+
+TEST(OTPassword, add_char_grows)
+{
+    OTPassword password;
+
+    for (std::size_t i = 0; i < long_text_.size(); ++i) {
+        ASSERT_TRUE(password.addChar('x'));
+    }
+
+    ASSERT_EQ(std::string(password.getPassword()), long_text_);
+}
+
+TEST(OTPassword, copy)
+{
+    OTPassword password;
+    password.setPassword(long_text_);
+    OTPassword copy(password);
+
+    ASSERT_TRUE(copy.isPassword());
+    ASSERT_TRUE(copy.Compare(password));
+
+    OTPassword assigned;
+    assigned.setMemory(short_text_.data(), short_text_.size());
+    assigned = password;
+
+    ASSERT_TRUE(assigned.isPassword());
+    ASSERT_TRUE(assigned.Compare(password));
+}
+
+TEST(OTPassword, set_size_preserves_contents)
+{
+    OTPassword password;
+    password.setPassword(short_text_);
+
+    ASSERT_TRUE(password.SetSize(5));
+    ASSERT_EQ(std::string(password.getPassword()), short_text_.substr(0, 5));
+    ASSERT_TRUE(password.SetSize(2000));
+    ASSERT_EQ(password.getPasswordSize(), 2000);
+    ASSERT_EQ(std::string(password.getPassword()), short_text_.substr(0, 5));
+}
+
+TEST(OTPassword, zero_memory)
+{
+    OTPassword password;
+    password.setPassword(short_text_);
+    password.zeroMemory();
+
+    ASSERT_EQ(password.getPasswordSize(), 0);
+    ASSERT_STREQ(password.getPassword(), "");
+
+    password.setPassword(long_text_);
+
+    ASSERT_EQ(std::string(password.getPassword()), long_text_);
+}
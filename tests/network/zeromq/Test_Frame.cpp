@@ -69,6 +69,31 @@ TEST(Frame, Factory3)
     ASSERT_STREQ("testString", messageString.c_str());
 }
 
+TEST(Frame, Factory4)
+{
+    std::string input(1024, 'x');
+    const void* buffer = input.data();
+
+    OTZMQFrame message = network::zeromq::Frame::Factory(std::move(input));
+
+    ASSERT_NE(nullptr, &message.get());
+    ASSERT_EQ(1024, message->size());
+    ASSERT_EQ(buffer, message->data());
+    std::string messageString = message.get();
+    ASSERT_EQ(std::string(1024, 'x'), messageString);
+}
+
+TEST(Frame, copy_shares_buffer)
+{
+    OTZMQFrame message =
+        network::zeromq::Frame::Factory(std::string(1024, 'x'));
+    OTZMQFrame copy = message;
+
+    ASSERT_NE(&message.get(), &copy.get());
+    ASSERT_EQ(message->size(), copy->size());
+    ASSERT_EQ(message->data(), copy->data());
+}
+
 TEST(Frame, operator_string)
 {
     auto message =
@@ -347,3 +347,60 @@ TEST_F(Test_PublishSubscribe, Publish_2_Subscribe_2)
     subscribeSocketThread1.join();
     subscribeSocketThread2.join();
 }
+
+TEST_F(Test_PublishSubscribe, Many_Subscribers)
+{
+    // All of these are serviced by the context's shared poller
+    const int subscribers{200};
+    auto publishSocket = network::zeromq::PublishSocket::Factory(
+        Test_PublishSubscribe::context_);
+
+    ASSERT_NE(nullptr, &publishSocket.get());
+
+    publishSocket->SetTimeouts(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(30000),
+        std::chrono::milliseconds(-1));
+    publishSocket->Start(endpoint2_);
+
+    auto listenCallback = network::zeromq::ListenCallback::Factory(
+        [this](const network::zeromq::Message& input) -> void {
+            const std::string& inputString = *input.Body().begin();
+            EXPECT_EQ(testMessage2_, inputString);
+            ++callbackFinishedCount_;
+        });
+
+    ASSERT_NE(nullptr, &listenCallback.get());
+
+    std::vector<OTZMQSubscribeSocket> subscribeSockets{};
+
+    for (int i = 0; i < subscribers; ++i) {
+        subscribeSockets.emplace_back(network::zeromq::SubscribeSocket::Factory(
+            Test_PublishSubscribe::context_, listenCallback));
+        auto& subscribeSocket = subscribeSockets.back();
+
+        ASSERT_NE(nullptr, &subscribeSocket.get());
+
+        subscribeSocket->SetTimeouts(
+            std::chrono::milliseconds(0),
+            std::chrono::milliseconds(-1),
+            std::chrono::milliseconds(30000));
+        subscribeSocket->Start(endpoint2_);
+    }
+
+    // Give the subscriptions time to reach the publisher
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    bool sent = publishSocket->Publish(testMessage2_);
+
+    ASSERT_TRUE(sent);
+
+    auto end = std::time(nullptr) + 30;
+    while (callbackFinishedCount_ < subscribers && std::time(nullptr) < end)
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    ASSERT_EQ(subscribers, callbackFinishedCount_);
+
+    // Destroying sockets must not disturb the ones still registered
+    subscribeSockets.clear();
+}
@@ -0,0 +1,157 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_RequestRouter : public ::testing::Test
+{
+public:
+    static OTZMQContext context_;
+
+    const std::string testMessage_{"zeromq test message"};
+    const std::string testMessage2_{"zeromq test message 2"};
+    const std::string testMessage3_{"zeromq test message 3"};
+    const std::string endpoint_{"inproc://opentxs/test/request_router_test"};
+
+    void requestSocketThread(const std::string& msg);
+};
+
+OTZMQContext Test_RequestRouter::context_{
+    network::zeromq::Context::Factory()};
+
+void Test_RequestRouter::requestSocketThread(const std::string& msg)
+{
+    auto requestSocket =
+        network::zeromq::RequestSocket::Factory(Test_RequestRouter::context_);
+
+    ASSERT_NE(nullptr, &requestSocket.get());
+
+    requestSocket->SetTimeouts(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(-1),
+        std::chrono::milliseconds(30000));
+    requestSocket->Start(endpoint_);
+
+    auto [result, message] = requestSocket->SendRequest(msg);
+
+    ASSERT_EQ(result, SendResult::VALID_REPLY);
+
+    const std::string& messageString = *message->Body().begin();
+    ASSERT_EQ(msg, messageString);
+}
+}  // namespace
+
+TEST_F(Test_RequestRouter, Request_Router)
+{
+    ASSERT_NE(nullptr, &Test_RequestRouter::context_.get());
+
+    OTZMQRouterSocket* router{nullptr};
+    auto routerCallback = network::zeromq::ListenCallback::Factory(
+        [&](const network::zeromq::Message& input) -> void {
+            const std::string& inputString = *input.Body().begin();
+            EXPECT_EQ(testMessage_, inputString);
+
+            auto reply = network::zeromq::Message::ReplyFactory(input);
+            reply->AddFrame(inputString);
+            ASSERT_NE(nullptr, router);
+            (*router)->Send(reply);
+        });
+    auto routerSocket = network::zeromq::RouterSocket::Factory(
+        Test_RequestRouter::context_, routerCallback);
+    router = &routerSocket;
+
+    ASSERT_EQ(SocketType::Router, routerSocket->Type());
+
+    routerSocket->SetTimeouts(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(30000),
+        std::chrono::milliseconds(-1));
+    routerSocket->Start(endpoint_);
+
+    requestSocketThread(testMessage_);
+}
+
+// The replies are sent from another thread, in the reverse order of the
+// requests.
+TEST_F(Test_RequestRouter, Request_Router_Out_Of_Order)
+{
+    std::mutex lock{};
+    std::vector<OTZMQMessage> pending{};
+    auto routerCallback = network::zeromq::ListenCallback::Factory(
+        [&](const network::zeromq::Message& input) -> void {
+            auto reply = network::zeromq::Message::ReplyFactory(input);
+            reply->AddFrame(std::string(*input.Body().begin()));
+            Lock guard(lock);
+            pending.emplace_back(reply);
+        });
+    auto routerSocket = network::zeromq::RouterSocket::Factory(
+        Test_RequestRouter::context_, routerCallback);
+    routerSocket->SetTimeouts(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(30000),
+        std::chrono::milliseconds(-1));
+    routerSocket->Start(endpoint_);
+
+    std::thread requestSocketThread1(
+        &Test_RequestRouter::requestSocketThread, this, testMessage2_);
+    std::thread requestSocketThread2(
+        &Test_RequestRouter::requestSocketThread, this, testMessage3_);
+
+    for (bool waiting = true; waiting;) {
+        Log::Sleep(std::chrono::milliseconds(10));
+        Lock guard(lock);
+        waiting = (2 > pending.size());
+    }
+
+    for (auto i = pending.rbegin(); i != pending.rend(); ++i) {
+        EXPECT_TRUE(routerSocket->Send(*i));
+    }
+
+    requestSocketThread1.join();
+    requestSocketThread2.join();
+}
@@ -0,0 +1,182 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "server/HotCache.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace opentxs;
+using namespace opentxs::server;
+
+namespace
+{
+const auto key_a_ = HotCache::Key("accounts", "aaaa");
+const auto key_b_ = HotCache::Key("accounts", "bbbb");
+const auto key_c_ = HotCache::Key("accounts", "cccc");
+const std::string contents_(100, 'x');
+// Enough for two of the entries above, but not three
+const std::size_t budget_ = 2 * (key_a_.size() + contents_.size()) + 1;
+}  // namespace
+
+TEST(HotCache, get_after_put)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    cache.Put(key_a_, contents_, cache.Snapshot());
+    std::string out{};
+
+    ASSERT_TRUE(cache.Get(key_a_, out));
+    ASSERT_EQ(out, contents_);
+    ASSERT_FALSE(cache.Get(key_b_, out));
+}
+
+TEST(HotCache, evicts_least_recently_used)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    cache.Put(key_a_, contents_, cache.Snapshot());
+    cache.Put(key_b_, contents_, cache.Snapshot());
+    std::string out{};
+
+    // Using a makes b the least recently used entry
+    ASSERT_TRUE(cache.Get(key_a_, out));
+
+    cache.Put(key_c_, contents_, cache.Snapshot());
+
+    ASSERT_TRUE(cache.Get(key_a_, out));
+    ASSERT_FALSE(cache.Get(key_b_, out));
+    ASSERT_TRUE(cache.Get(key_c_, out));
+}
+
+TEST(HotCache, shrinking_budget_evicts)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    cache.Put(key_a_, contents_, cache.Snapshot());
+    cache.Put(key_b_, contents_, cache.Snapshot());
+    cache.SetBudget(key_b_.size() + contents_.size());
+    std::string out{};
+
+    ASSERT_FALSE(cache.Get(key_a_, out));
+    ASSERT_TRUE(cache.Get(key_b_, out));
+}
+
+TEST(HotCache, zero_budget_disables)
+{
+    HotCache cache;
+    cache.SetBudget(0);
+    cache.Put(key_a_, contents_, cache.Snapshot());
+    std::string out{};
+
+    ASSERT_FALSE(cache.Get(key_a_, out));
+}
+
+TEST(HotCache, put_rejected_after_write)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    const auto snapshot = cache.Snapshot();
+    cache.Update(key_b_, &contents_);
+    cache.Put(key_a_, contents_, snapshot);
+    std::string out{};
+
+    ASSERT_FALSE(cache.Get(key_a_, out));
+}
+
+TEST(HotCache, update_replaces_cached_contents)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    cache.Put(key_a_, contents_, cache.Snapshot());
+    const std::string updated(50, 'y');
+    cache.Update(key_a_, &updated);
+    std::string out{};
+
+    ASSERT_TRUE(cache.Get(key_a_, out));
+    ASSERT_EQ(out, updated);
+}
+
+TEST(HotCache, update_does_not_insert)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    cache.Update(key_a_, &contents_);
+    std::string out{};
+
+    ASSERT_FALSE(cache.Get(key_a_, out));
+}
+
+TEST(HotCache, update_with_nullptr_drops_entry)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    cache.Put(key_a_, contents_, cache.Snapshot());
+    cache.Put(key_b_, contents_, cache.Snapshot());
+    cache.Update(key_a_, nullptr);
+    std::string out{};
+
+    ASSERT_FALSE(cache.Get(key_a_, out));
+    ASSERT_TRUE(cache.Get(key_b_, out));
+}
+
+TEST(HotCache, bypassed_for_staged_writes)
+{
+    HotCache cache;
+    cache.SetBudget(budget_);
+    cache.Put(key_a_, contents_, cache.Snapshot());
+    std::string out{};
+
+    {
+        // There is no default storage here, so nothing is ever committed
+        OTDB::WriteBatch batch{};
+        batch.Store("staged", "accounts", "aaaa");
+        batch.Erase("accounts", "bbbb");
+
+        ASSERT_FALSE(cache.Get(key_a_, out));
+
+        cache.Put(key_b_, contents_, cache.Snapshot());
+
+        ASSERT_FALSE(cache.Get(key_b_, out));
+    }
+
+    ASSERT_TRUE(cache.Get(key_a_, out));
+    ASSERT_EQ(out, contents_);
+    ASSERT_FALSE(cache.Get(key_b_, out));
+}
@@ -0,0 +1,125 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#ifndef OPENTXS_TESTS_STORAGE_MEMORYDRIVER_HPP
+#define OPENTXS_TESTS_STORAGE_MEMORYDRIVER_HPP
+
+#include "opentxs/api/storage/Driver.hpp"
+
+#include <functional>
+#include <future>
+#include <map>
+#include <string>
+
+namespace opentxs
+{
+namespace test
+{
+// A content-addressed in-memory backend which counts the objects read and
+// written
+class MemoryDriver : public opentxs::api::storage::Driver
+{
+public:
+    mutable std::map<std::string, std::string> objects_{};
+    mutable std::size_t loads_{0};
+    mutable std::size_t writes_{0};
+
+    bool EmptyBucket(const bool) const override { return true; }
+    bool Load(const std::string& key, const bool, std::string& value)
+        const override
+    {
+        const auto it = objects_.find(key);
+
+        if (objects_.end() == it) { return false; }
+
+        value = it->second;
+        ++loads_;
+
+        return true;
+    }
+    bool LoadFromBucket(const std::string& key, std::string& value, const bool)
+        const override
+    {
+        return Load(key, false, value);
+    }
+    bool Store(
+        const bool,
+        const std::string& key,
+        const std::string& value,
+        const bool) const override
+    {
+        objects_[key] = value;
+
+        return true;
+    }
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const override
+    {
+        promise.set_value(Store(isTransaction, key, value, bucket));
+    }
+    bool Store(const bool, const std::string& value, std::string& key)
+        const override
+    {
+        key = std::to_string(std::hash<std::string>{}(value));
+        objects_[key] = value;
+        ++writes_;
+
+        return true;
+    }
+    bool Migrate(const std::string& key, const Driver& to) const override
+    {
+        std::string value{};
+
+        if (false == Load(key, false, value)) { return false; }
+
+        return to.Store(true, key, value, false);
+    }
+    std::string LoadRoot() const override { return {}; }
+    bool StoreRoot(const bool, const std::string&) const override
+    {
+        return true;
+    }
+};
+}  // namespace test
+}  // namespace opentxs
+#endif  // OPENTXS_TESTS_STORAGE_MEMORYDRIVER_HPP
@@ -0,0 +1,216 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "opentxs/opentxs.hpp"
+
+#include "storage/tree/IndexTrie.hpp"
+
+#include "MemoryDriver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+
+using namespace opentxs;
+using namespace opentxs::storage;
+using opentxs::test::MemoryDriver;
+
+namespace
+{
+const std::size_t count_{1000};
+
+bool valid(const std::string& hash) { return false == hash.empty(); }
+
+class Test_IndexTrie : public ::testing::Test
+{
+public:
+    MemoryDriver driver_{};
+    IndexTrie::Items items_{};
+    std::set<std::string> all_{};
+    std::string meta_{};
+    std::string root_{};
+
+    Test_IndexTrie()
+    {
+        for (std::size_t i = 0; i < count_; ++i) {
+            const auto id = "item-" + std::to_string(i);
+            items_[id] = IndexTrie::Items::mapped_type{
+                "hash-" + std::to_string(i), "alias " + std::to_string(i), 0,
+                false};
+            all_.emplace(id);
+        }
+
+        driver_.Store(true, "metadata", meta_);
+    }
+
+    // Load root from driver and check the result against items_
+    void verify(const MemoryDriver& driver, const std::string& root)
+    {
+        std::string raw{};
+        std::string meta{};
+        IndexTrie::Entries entries{};
+        IndexTrie trie(driver);
+
+        ASSERT_TRUE(driver.Load(root, false, raw));
+        ASSERT_TRUE(IndexTrie::Check(raw));
+        ASSERT_TRUE(trie.Load(raw, meta, entries));
+        ASSERT_EQ(meta, meta_);
+        ASSERT_EQ(entries.size(), items_.size());
+
+        for (const auto& [id, item] : items_) {
+            const auto it = entries.find(id);
+
+            ASSERT_TRUE(entries.end() != it);
+            ASSERT_EQ(it->second.first, std::get<0>(item));
+            ASSERT_EQ(it->second.second, std::get<1>(item));
+        }
+    }
+};
+}  // namespace
+
+TEST_F(Test_IndexTrie, round_trip)
+{
+    IndexTrie trie(driver_);
+
+    ASSERT_TRUE(trie.Store(meta_, items_, all_, valid, root_));
+
+    verify(driver_, root_);
+}
+
+TEST_F(Test_IndexTrie, invalid_hashes_are_not_stored)
+{
+    IndexTrie trie(driver_);
+    std::get<0>(items_.at("item-7")) = "";
+
+    ASSERT_TRUE(trie.Store(meta_, items_, all_, valid, root_));
+
+    items_.erase("item-7");
+    verify(driver_, root_);
+}
+
+TEST_F(Test_IndexTrie, update_rewrites_one_path)
+{
+    IndexTrie trie(driver_);
+
+    ASSERT_TRUE(trie.Store(meta_, items_, all_, valid, root_));
+
+    driver_.writes_ = 0;
+
+    ASSERT_TRUE(trie.Store(meta_, items_, {}, valid, root_));
+    // Nothing changed, so only the root object is written
+    ASSERT_EQ(driver_.writes_, 1u);
+
+    driver_.writes_ = 0;
+    std::get<1>(items_.at("item-42")) = "renamed";
+
+    ASSERT_TRUE(trie.Store(meta_, items_, {"item-42"}, valid, root_));
+    // A thousand entries need two levels of branches above the leaves
+    ASSERT_LE(driver_.writes_, 4u);
+
+    verify(driver_, root_);
+}
+
+TEST_F(Test_IndexTrie, update_after_load)
+{
+    {
+        IndexTrie trie(driver_);
+
+        ASSERT_TRUE(trie.Store(meta_, items_, all_, valid, root_));
+    }
+
+    std::string raw{};
+    std::string meta{};
+    IndexTrie::Entries entries{};
+    IndexTrie trie(driver_);
+
+    ASSERT_TRUE(driver_.Load(root_, false, raw));
+    ASSERT_TRUE(trie.Load(raw, meta, entries));
+
+    items_.erase("item-1");
+    items_["item-new"] = IndexTrie::Items::mapped_type{"hash", "", 0, false};
+
+    ASSERT_TRUE(
+        trie.Store(meta_, items_, {"item-1", "item-new"}, valid, root_));
+
+    verify(driver_, root_);
+}
+
+TEST_F(Test_IndexTrie, erase_merges_branches)
+{
+    IndexTrie trie(driver_);
+
+    ASSERT_TRUE(trie.Store(meta_, items_, all_, valid, root_));
+
+    std::set<std::string> removed{};
+
+    for (std::size_t i = 10; i < count_; ++i) {
+        const auto id = "item-" + std::to_string(i);
+        items_.erase(id);
+        removed.emplace(id);
+    }
+
+    driver_.writes_ = 0;
+
+    ASSERT_TRUE(trie.Store(meta_, items_, removed, valid, root_));
+    // The remaining entries fit in one leaf, which is the only node left
+    ASSERT_EQ(driver_.writes_, 2u);
+
+    verify(driver_, root_);
+
+    MemoryDriver target{};
+
+    ASSERT_TRUE(trie.Migrate(target));
+    // The metadata object and the leaf
+    ASSERT_EQ(target.objects_.size(), 2u);
+}
+
+TEST_F(Test_IndexTrie, migrate)
+{
+    IndexTrie trie(driver_);
+
+    ASSERT_TRUE(trie.Store(meta_, items_, all_, valid, root_));
+
+    MemoryDriver target{};
+
+    ASSERT_TRUE(driver_.Migrate(root_, target));
+    ASSERT_TRUE(trie.Migrate(target));
+
+    verify(target, root_);
+}
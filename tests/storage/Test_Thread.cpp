@@ -0,0 +1,260 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+
+#include "opentxs/opentxs.hpp"
+
+#include "storage/tree/Mailbox.hpp"
+#include "storage/tree/Thread.hpp"
+#include "storage/Plugin.hpp"
+
+#include "MemoryDriver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <string>
+
+using namespace opentxs;
+using opentxs::test::MemoryDriver;
+
+namespace
+{
+// More than two pages
+const std::size_t count_{600};
+const std::size_t read_{10};
+
+// Pads n to the length of a plausible identifier
+std::string make_id(const std::string& prefix, const std::size_t n)
+{
+    const auto number = std::to_string(n);
+
+    return prefix + std::string(40 - prefix.size() - number.size(), '0') +
+           number;
+}
+
+class Test_Thread : public ::testing::Test
+{
+public:
+    const std::string thread_id_{make_id("thread", 0)};
+    const std::set<std::string> participants_{thread_id_};
+    MemoryDriver driver_{};
+    std::unique_ptr<storage::Mailbox> inbox_{
+        Factory::StorageMailbox(driver_, "")};
+    std::unique_ptr<storage::Mailbox> outbox_{
+        Factory::StorageMailbox(driver_, "")};
+
+    std::unique_ptr<storage::Thread> load(const std::string& hash)
+    {
+        return std::unique_ptr<storage::Thread>(Factory::StorageThread(
+            driver_, thread_id_, hash, "", *inbox_, *outbox_));
+    }
+
+    // Creates a thread with count_ incoming items, of which the first read_
+    // are marked as read
+    std::string populate()
+    {
+        std::unique_ptr<storage::Thread> thread(Factory::StorageThread(
+            driver_, thread_id_, participants_, *inbox_, *outbox_));
+
+        EXPECT_TRUE(thread);
+
+        for (std::size_t i = 0; i < count_; ++i) {
+            EXPECT_TRUE(thread->Add(
+                make_id("item", i),
+                i,
+                StorageBox::INCOMINGBLOCKCHAIN,
+                "",
+                ""));
+        }
+
+        for (std::size_t i = 0; i < read_; ++i) {
+            EXPECT_TRUE(thread->Read(make_id("item", i), false));
+        }
+
+        return thread->Root();
+    }
+
+    void verify(const proto::StorageThread& serialized)
+    {
+        ASSERT_TRUE(proto::Validate(serialized, VERBOSE));
+        ASSERT_EQ(serialized.id(), thread_id_);
+        ASSERT_EQ(serialized.participant_size(), 1);
+        ASSERT_EQ(serialized.participant(0), thread_id_);
+        ASSERT_EQ(serialized.item_size(), int(count_));
+
+        for (std::size_t i = 0; i < count_; ++i) {
+            const auto& item = serialized.item(i);
+
+            ASSERT_EQ(item.id(), make_id("item", i));
+            ASSERT_EQ(item.index(), i);
+            ASSERT_EQ(item.unread(), (i >= read_));
+        }
+    }
+};
+}  // namespace
+
+TEST_F(Test_Thread, save_and_reload)
+{
+    const auto root = populate();
+    const auto loads = driver_.loads_;
+    auto thread = load(root);
+
+    ASSERT_TRUE(thread);
+    // The unread count comes from the page table
+    ASSERT_EQ(thread->UnreadCount(), count_ - read_);
+
+    const auto tableLoads = driver_.loads_ - loads;
+
+    verify(thread->Items());
+    // Every page is loaded by Items, and none of them before
+    ASSERT_EQ(driver_.loads_ - loads - tableLoads, 3u);
+}
+
+TEST_F(Test_Thread, pages_load_on_demand)
+{
+    auto thread = load(populate());
+
+    ASSERT_TRUE(thread);
+
+    const auto loads = driver_.loads_;
+    proto::StorageThreadItem item;
+
+    // The item index leads straight to the page of each item
+    ASSERT_TRUE(thread->Item(make_id("item", count_ - 1), item));
+    ASSERT_EQ(driver_.loads_ - loads, 1u);
+    ASSERT_EQ(item.index(), count_ - 1);
+    ASSERT_TRUE(thread->Check(make_id("item", 0)));
+    ASSERT_EQ(driver_.loads_ - loads, 2u);
+    ASSERT_FALSE(thread->Check(make_id("missing", 0)));
+    ASSERT_EQ(driver_.loads_ - loads, 2u);
+}
+
+TEST_F(Test_Thread, append_loads_last_page)
+{
+    auto thread = load(populate());
+
+    ASSERT_TRUE(thread);
+
+    const auto loads = driver_.loads_;
+
+    ASSERT_TRUE(thread->Add(
+        make_id("item", count_), 0, StorageBox::INCOMINGBLOCKCHAIN, "", ""));
+    // Only the page which receives the new item
+    ASSERT_EQ(driver_.loads_ - loads, 1u);
+
+    auto reloaded = load(thread->Root());
+
+    ASSERT_TRUE(reloaded);
+    ASSERT_TRUE(reloaded->Check(make_id("item", count_)));
+    ASSERT_EQ(reloaded->UnreadCount(), count_ - read_ + 1);
+}
+
+TEST_F(Test_Thread, modify_after_reload)
+{
+    auto thread = load(populate());
+
+    ASSERT_TRUE(thread);
+    ASSERT_TRUE(thread->Read(make_id("item", 0), true));
+    ASSERT_TRUE(thread->Remove(make_id("item", 1)));
+    ASSERT_TRUE(thread->Add(
+        make_id("item", count_), 0, StorageBox::INCOMINGBLOCKCHAIN, "", ""));
+
+    auto reloaded = load(thread->Root());
+
+    ASSERT_TRUE(reloaded);
+    // item 0 is unread again, item 1 was already read and the new item is
+    // unread
+    ASSERT_EQ(reloaded->UnreadCount(), count_ - read_ + 2);
+
+    proto::StorageThreadItem item;
+
+    ASSERT_FALSE(reloaded->Check(make_id("item", 1)));
+    ASSERT_TRUE(reloaded->Item(make_id("item", 0), item));
+    ASSERT_TRUE(item.unread());
+    // Indices continue after the highest index in any page
+    ASSERT_TRUE(reloaded->Item(make_id("item", count_), item));
+    ASSERT_EQ(item.index(), count_);
+    ASSERT_EQ(reloaded->Items().item_size(), int(count_));
+}
+
+TEST_F(Test_Thread, legacy_thread_is_converted)
+{
+    auto original = load(populate());
+
+    ASSERT_TRUE(original);
+
+    std::string legacy{};
+
+    ASSERT_TRUE(driver_.StoreProto(original->Items(), legacy));
+
+    auto thread = load(legacy);
+
+    ASSERT_TRUE(thread);
+    ASSERT_EQ(thread->UnreadCount(), count_ - read_);
+    // Two changes which cancel out, so the reloaded thread matches the
+    // original
+    ASSERT_TRUE(thread->Read(make_id("item", 0), true));
+    ASSERT_TRUE(thread->Read(make_id("item", 0), false));
+    ASSERT_NE(thread->Root(), legacy);
+
+    auto reloaded = load(thread->Root());
+
+    ASSERT_TRUE(reloaded);
+    ASSERT_EQ(reloaded->UnreadCount(), count_ - read_);
+    verify(reloaded->Items());
+}
+
+TEST_F(Test_Thread, migrate)
+{
+    auto thread = load(populate());
+
+    ASSERT_TRUE(thread);
+
+    MemoryDriver target{};
+
+    ASSERT_TRUE(thread->Migrate(target));
+
+    std::unique_ptr<storage::Thread> copy(Factory::StorageThread(
+        target, thread_id_, thread->Root(), "", *inbox_, *outbox_));
+
+    ASSERT_TRUE(copy);
+
+    verify(copy->Items());
+}